@@ -24,12 +24,24 @@
 
 #include <systemc.h>
 #include "node.h"
+#include "async_throughput.h"
+#include <cstring>
 #include <vector>
 
 #define NODES 10
 
 int sc_main(int argc, char **argv)
 {
+    // async_suspend throughput [producers] [messages]
+    if (argc > 1 && std::strcmp(argv[1], "throughput") == 0)
+    {
+        unsigned producers = (argc > 2) ? std::atoi(argv[2]) : 4;
+        unsigned messages = (argc > 3) ? std::atoi(argv[3]) : 250000;
+        throughput_test test("throughput", producers, messages);
+        sc_start();
+        return 0;
+    }
+
     collector col;
     srand(0); // try to keep things as determanistic as possible....
 
@@ -0,0 +1,155 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+#ifndef ASYNC_THROUGHPUT_H
+#define ASYNC_THROUGHPUT_H
+
+#include <systemc>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Throughput of messages, which are injected from host threads.
+ *
+ * A number of producer threads each send a sequence of messages to the
+ * simulation, where a SystemC thread receives and checks them. This is done
+ * twice: first through a channel in the style of async_event, which takes
+ * a mutex and requests an update for every message, and then through an
+ * sc_async_fifo, whose writers never block and whose values are taken in
+ * batches in the update phase.
+ */
+
+// a message channel with a mutex-protected queue
+class locked_fifo : public sc_core::sc_prim_channel
+{
+public:
+    locked_fifo() : sc_core::sc_prim_channel(sc_core::sc_gen_unique_name("locked_fifo"))
+    {
+        async_attach_suspending();
+    }
+
+    void write(sc_dt::uint64 v)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_in.push_back(v);
+        }
+        async_request_update();
+    }
+
+    bool nb_read(sc_dt::uint64& v)
+    {
+        if (m_pos == m_out.size())
+            return false;
+        v = m_out[m_pos++];
+        return true;
+    }
+
+    const sc_core::sc_event& data_written_event() const { return m_event; }
+
+    void detach_suspending() { async_detach_suspending(); }
+
+protected:
+    void update()
+    {
+        m_out.erase(m_out.begin(), m_out.begin() + m_pos);
+        m_pos = 0;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_out.insert(m_out.end(), m_in.begin(), m_in.end());
+        m_in.clear();
+        m_event.notify(sc_core::SC_ZERO_TIME);
+    }
+
+private:
+    std::mutex                 m_mutex;
+    std::vector<sc_dt::uint64> m_in;
+    std::vector<sc_dt::uint64> m_out;
+    size_t                     m_pos = 0;
+    sc_core::sc_event          m_event;
+};
+
+SC_MODULE (throughput_test)
+{
+    SC_CTOR (throughput_test, unsigned producers, unsigned messages)
+      : m_producers(producers), m_messages(messages), m_async("async_fifo")
+    {
+        SC_THREAD(run);
+    }
+
+    template <class Fifo>
+    void measure(const char* name, Fifo& fifo)
+    {
+        std::chrono::steady_clock::time_point start =
+          std::chrono::steady_clock::now();
+        sc_dt::uint64 deltas = sc_core::sc_delta_count();
+
+        std::vector<std::thread> threads;
+        for (unsigned p = 0; p < m_producers; p++) {
+            threads.emplace_back([this, p, &fifo] {
+                for (unsigned i = 0; i < m_messages; i++)
+                    fifo.write((sc_dt::uint64(p) << 32) | i);
+            });
+        }
+
+        // the messages of each producer must arrive in order
+        std::vector<unsigned> next(m_producers, 0);
+        sc_dt::uint64 received = 0, errors = 0;
+        sc_dt::uint64 total = sc_dt::uint64(m_producers) * m_messages;
+        while (received < total) {
+            sc_dt::uint64 v;
+            while (fifo.nb_read(v)) {
+                unsigned p = unsigned(v >> 32);
+                if (p >= m_producers || unsigned(v) != next[p]++)
+                    errors++;
+                received++;
+            }
+            if (received < total)
+                wait(fifo.data_written_event());
+        }
+        for (std::thread& t : threads)
+            t.join();
+
+        std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - start;
+        std::cout << name << ": " << received << " messages in "
+                  << elapsed.count() << " s, "
+                  << unsigned(received / elapsed.count()) << " messages/s, "
+                  << sc_core::sc_delta_count() - deltas << " delta cycles, "
+                  << errors << " errors" << std::endl;
+    }
+
+    void run()
+    {
+        std::cout << m_producers << " producers, " << m_messages
+                  << " messages each" << std::endl;
+        measure("mutex and update request per message", m_locked);
+        measure("sc_async_fifo", m_async);
+        m_locked.detach_suspending();
+        m_async.detach_suspending();
+    }
+
+    unsigned                              m_producers;
+    unsigned                              m_messages;
+    locked_fifo                           m_locked;
+    sc_core::sc_async_fifo<sc_dt::uint64> m_async;
+};
+
+#endif
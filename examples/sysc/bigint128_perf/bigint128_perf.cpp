@@ -0,0 +1,260 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  bigint128_perf.cpp -- Operators of sc_bigint<W> and sc_biguint<W> values
+                        between 65 and 128 bits wide.
+
+                        Each operation is timed on sc_bigint<W> and
+                        sc_biguint<W> operands, whose operators are
+                        computed with native 128-bit integers when
+                        SC_BIGINT_CONFIG_NATIVE_INT128 is defined, and on
+                        sc_signed and sc_unsigned operands of the same
+                        width, which use the digit vector routines.
+
+                        Usage:
+                          bigint128_perf [repeats]
+
+                        The checksum covers the sc_bigint<W> and
+                        sc_biguint<W> results, the sc_signed and
+                        sc_unsigned ones must be the same.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using sc_dt::sc_bigint;
+using sc_dt::sc_biguint;
+using sc_dt::sc_signed;
+using sc_dt::sc_unsigned;
+
+static const int values_n = 256;   // operands per operation.
+
+// xorshift64 random digits
+static sc_dt::uint64 state = 0x2545f4914f6cdd1dULL;
+
+template< typename T >
+static void
+randomize( T& value )
+{
+    for( int i = 0; i < value.length(); i += 32 ) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        int high = i + 31 < value.length() ? i + 31 : value.length() - 1;
+        value.range( high, i ) = state;
+    }
+    if( value == 0 )
+        value = 1;  // keep the value usable as a denominator
+}
+
+// FNV-1a style mixing of the results
+template< typename T >
+static void
+mix( sc_dt::uint64& hash, const T& value )
+{
+    std::string digits = value.to_string( sc_dt::SC_HEX_US );
+    for( unsigned i = 0; i < digits.size(); ++i ) {
+        hash ^= static_cast<unsigned char>( digits[i] );
+        hash *= 0x100000001b3ULL;
+    }
+}
+
+// nanoseconds per operation, the best of several rounds
+template< typename Operation >
+double
+measure( Operation operation, unsigned repeats )
+{
+    double best = 0;
+    for( int round = 0; round < 3; ++round ) {
+        std::chrono::steady_clock::time_point start =
+          std::chrono::steady_clock::now();
+        for( unsigned i = 0; i < repeats; ++i ) {
+            for( int value_i = 0; value_i < values_n; ++value_i )
+                operation( value_i );
+        }
+        std::chrono::duration<double, std::nano> elapsed =
+          std::chrono::steady_clock::now() - start;
+        double time = elapsed.count() / ( repeats * values_n );
+        if( round == 0 || time < best )
+            best = time;
+    }
+    return best;
+}
+
+// Times each operation on the template type T<W>, and on the base type B
+// with the same width. The products are of W/2-bit operands.
+template< template<int> class T, typename B, int W >
+void
+sweep( const char* name, unsigned repeats, sc_dt::uint64& hash, bool& match )
+{
+    std::vector< T<W> >   left( values_n ), right( values_n );
+    std::vector< T<W> >   result( values_n );
+    std::vector< T<W/2> > half_left( values_n ), half_right( values_n );
+    std::vector< B >      base_left( values_n, B( W ) );
+    std::vector< B >      base_right( values_n, B( W ) );
+    std::vector< B >      base_result( values_n, B( W ) );
+    std::vector< B >      base_half_left( values_n, B( W/2 ) );
+    std::vector< B >      base_half_right( values_n, B( W/2 ) );
+    int                   shifts[values_n];
+    int                   count = 0, base_count = 0;
+
+    for( int i = 0; i < values_n; ++i ) {
+        randomize( left[i] );
+        randomize( right[i] );
+        randomize( half_left[i] );
+        randomize( half_right[i] );
+        base_left[i] = left[i];
+        base_right[i] = right[i];
+        base_half_left[i] = half_left[i];
+        base_half_right[i] = half_right[i];
+        shifts[i] = static_cast<int>( state % W );
+    }
+
+    // compares the results of the two types and mixes them into the hash
+    auto check = [&]() {
+        for( int i = 0; i < values_n; ++i ) {
+            match = match && result[i] == base_result[i];
+            mix( hash, result[i] );
+        }
+    };
+
+    std::cout << std::setw( 10 ) << name << std::setw( 4 ) << W;
+
+    double time = measure( [&]( int i ) {
+        result[i] = left[i] + right[i]; }, repeats );
+    double base_time = measure( [&]( int i ) {
+        base_result[i] = base_left[i] + base_right[i]; }, repeats );
+    check();
+    std::cout << std::setw( 8 ) << std::fixed << std::setprecision( 1 )
+              << time << std::setw( 7 ) << base_time;
+
+    time = measure( [&]( int i ) {
+        result[i] = left[i] - right[i]; }, repeats );
+    base_time = measure( [&]( int i ) {
+        base_result[i] = base_left[i] - base_right[i]; }, repeats );
+    check();
+    std::cout << std::setw( 8 ) << time << std::setw( 7 ) << base_time;
+
+    time = measure( [&]( int i ) {
+        result[i] = half_left[i] * half_right[i]; }, repeats );
+    base_time = measure( [&]( int i ) {
+        base_result[i] = base_half_left[i] * base_half_right[i]; }, repeats );
+    check();
+    std::cout << std::setw( 8 ) << time << std::setw( 7 ) << base_time;
+
+    time = measure( [&]( int i ) {
+        result[i] = left[i] / right[( i + 1 ) % values_n]; }, repeats );
+    base_time = measure( [&]( int i ) {
+        base_result[i] = base_left[i] / base_right[( i + 1 ) % values_n]; },
+        repeats );
+    check();
+    std::cout << std::setw( 8 ) << time << std::setw( 7 ) << base_time;
+
+    time = measure( [&]( int i ) {
+        result[i] = left[i] % half_right[i]; }, repeats );
+    base_time = measure( [&]( int i ) {
+        base_result[i] = base_left[i] % base_half_right[i]; }, repeats );
+    check();
+    std::cout << std::setw( 8 ) << time << std::setw( 7 ) << base_time;
+
+    time = measure( [&]( int i ) {
+        result[i] = ( left[i] & right[i] ) ^ ( left[i] | half_left[i] ); },
+        repeats );
+    base_time = measure( [&]( int i ) {
+        base_result[i] = ( base_left[i] & base_right[i] ) ^
+                         ( base_left[i] | base_half_left[i] ); }, repeats );
+    check();
+    std::cout << std::setw( 8 ) << time << std::setw( 7 ) << base_time;
+
+    time = measure( [&]( int i ) {
+        count += ( left[i] < right[i] ) + ( left[i] == half_left[i] ); },
+        repeats );
+    base_time = measure( [&]( int i ) {
+        base_count += ( base_left[i] < base_right[i] ) +
+                      ( base_left[i] == base_half_left[i] ); }, repeats );
+    count = base_count = 0;
+    for( int i = 0; i < values_n; ++i ) {
+        count += ( left[i] < right[i] ) + ( left[i] == half_left[i] );
+        base_count += ( base_left[i] < base_right[i] ) +
+                      ( base_left[i] == base_half_left[i] );
+    }
+    match = match && count == base_count;
+    hash ^= count;
+    std::cout << std::setw( 8 ) << time << std::setw( 7 ) << base_time;
+
+    time = measure( [&]( int i ) {
+        result[i] = left[i];
+        result[i] <<= shifts[i];
+        result[i] >>= shifts[( i + 1 ) % values_n]; }, repeats );
+    base_time = measure( [&]( int i ) {
+        base_result[i] = base_left[i];
+        base_result[i] <<= shifts[i];
+        base_result[i] >>= shifts[( i + 1 ) % values_n]; }, repeats );
+    check();
+    std::cout << std::setw( 8 ) << time << std::setw( 7 ) << base_time
+              << std::endl;
+}
+
+int sc_main( int argc, char* argv[] )
+{
+    unsigned repeats = ( argc > 1 ) ? std::atoi( argv[1] ) : 200;
+
+#if defined(SC_BIGINT_CONFIG_NATIVE_INT128)
+    std::cout << "native 128-bit operators: yes" << std::endl;
+#else
+    std::cout << "native 128-bit operators: no" << std::endl;
+#endif
+    std::cout << "  (ns per operation: template type, base type)" << std::endl;
+    std::cout << "      type   W     add           sub           mul"
+                 "           div           mod         logic"
+                 "       compare         shift" << std::endl;
+
+    sc_dt::uint64 hash = 0xcbf29ce484222325ULL;
+    bool          match = true;
+
+    sweep<sc_bigint, sc_signed, 72>( "sc_bigint", repeats, hash, match );
+    sweep<sc_bigint, sc_signed, 96>( "sc_bigint", repeats, hash, match );
+    sweep<sc_bigint, sc_signed, 127>( "sc_bigint", repeats, hash, match );
+    sweep<sc_biguint, sc_unsigned, 72>( "sc_biguint", repeats, hash, match );
+    sweep<sc_biguint, sc_unsigned, 96>( "sc_biguint", repeats, hash, match );
+    sweep<sc_biguint, sc_unsigned, 127>( "sc_biguint", repeats, hash, match );
+
+    std::cout << "checksum: " << std::hex << hash << std::dec
+              << ( match ? "" : " MISMATCH" ) << std::endl;
+    return match ? 0 : 1;
+}
@@ -0,0 +1,80 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  alloc_counter.cpp -- Replacements of the global operator new and operator
+                       delete that count the allocations made while
+                       counting is enabled.
+
+                       They are kept apart from the code that allocates so
+                       that the compiler does not pair the inlined calls of
+                       operator new with std::free.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <cstdlib>
+#include <new>
+
+#include "alloc_counter.h"
+
+static long allocations = 0;
+static bool counting = false;
+
+void alloc_counter::start()
+{
+    allocations = 0;
+    counting = true;
+}
+
+long alloc_counter::stop()
+{
+    counting = false;
+    return allocations;
+}
+
+void* operator new( std::size_t size )
+{
+    if( counting )
+        ++allocations;
+    void* p = std::malloc( size ? size : 1 );
+    if( p == 0 )
+        throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[]( std::size_t size )
+{
+    return operator new( size );
+}
+
+void operator delete( void* p ) noexcept { std::free( p ); }
+void operator delete[]( void* p ) noexcept { std::free( p ); }
+void operator delete( void* p, std::size_t ) noexcept { std::free( p ); }
+void operator delete[]( void* p, std::size_t ) noexcept { std::free( p ); }
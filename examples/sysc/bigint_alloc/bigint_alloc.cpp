@@ -0,0 +1,139 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  bigint_alloc.cpp -- Heap allocations made by sc_signed and sc_unsigned
+                      expressions.
+
+                      Global operator new is replaced by a counting one,
+                      see alloc_counter.cpp.
+                      Each expression is evaluated twice to populate the
+                      storage pools, then the allocations made by a further
+                      100 evaluations are counted. The temporaries of
+                      values up to SC_DIGIT_POOL_DIGITS digits wide are
+                      taken from sc_digit_pool, so every count is 0.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+
+#include <iomanip>
+#include <iostream>
+
+#include "alloc_counter.h"
+
+using namespace sc_dt;
+
+// allocations made by 100 evaluations of an expression
+template< typename Expression >
+long
+count( Expression expression )
+{
+    expression();
+    expression();
+    alloc_counter::start();
+    for( int i = 0; i < 100; ++i )
+        expression();
+    return alloc_counter::stop();
+}
+
+void
+run( int w )
+{
+    sc_signed   a( w ), b( w ), c( w ), r( w );
+    sc_unsigned ua( w ), ub( w ), uc( w ), ur( w );
+    sc_int<16>  si = 3;
+    sc_uint<16> su = 4;
+
+    a = -12345; b = 678; c = 99;
+    ua = 5; ub = 7; uc = 11;
+
+    std::cout << std::setw( 5 ) << w;
+
+    // arithmetic
+    std::cout << std::setw( 7 ) << count( [&] { r = a + b * c; } )
+              << std::setw( 7 ) << count( [&] { r = ( a - b ) / c + a % c; } )
+              << std::setw( 7 ) << count( [&] { ur = ua + ub * uc - su; } )
+              << std::setw( 7 ) << count( [&] { ur = ( ua - ub ) / uc + ua % uc; } )
+              << std::setw( 7 ) << count( [&] { r = a + ua * b; } )
+              << std::setw( 7 ) << count( [&] { r = a + 5 - 7L * b + si; } );
+
+    // bitwise, shifts and negation
+    std::cout << std::setw( 7 ) << count( [&] { r = ( a & b ) | ( c ^ a ); } )
+              << std::setw( 7 ) << count( [&] { r = ( a << 3 ) >> 2; } )
+              << std::setw( 7 ) << count( [&] { r = -a + ~b; } );
+
+    // part selects and concatenation
+    std::cout << std::setw( 7 ) << count( [&] {
+                     r = a.range( w/2, 1 ) + b( w-1, w/2 ); } )
+              << std::setw( 7 ) << count( [&] {
+                     r.range( w/2, 1 ) = a.range( w/2-1, 0 ); } )
+              << std::setw( 7 ) << count( [&] {
+                     r = ( a.range( w/2-1, 0 ), b.range( w/2-1, 0 ) ); } )
+              << std::setw( 7 ) << count( [&] {
+                     ( r.range( w-1, w/2 ), c.range( w/2-1, 0 ) ) =
+                         sc_signed( ( a, b ) ).range( w-1, 0 ); } );
+
+    // conversions of temporaries
+    std::cout << std::setw( 7 ) << count( [&] {
+                     volatile bool x = ( a + b ) < c; (void)x; } )
+              << std::setw( 7 ) << count( [&] {
+                     volatile int x = ( a * b ).to_int(); (void)x; } )
+              << std::endl;
+}
+
+int sc_main( int, char*[] )
+{
+    std::cout << "heap allocations per 100 evaluations" << std::endl;
+    const char* names[] = { "a+b*c", "a-b/c", "u+u*u", "u-u/u", "s+u*s",
+                            "s+int", "&|^", "<<>>", "-a+~b", "range",
+                            "rng=", "cat", "cat=", "cmp", "to_int" };
+    std::cout << std::setw( 5 ) << "W";
+    for( const char* name : names )
+        std::cout << std::setw( 7 ) << name;
+    std::cout << std::endl;
+    const int widths[] = { 32, 64, 100, 128, 200, 256, 300, 512, 1000 };
+    for( int w : widths )
+        run( w );
+
+    sc_bigint<300>  big_a = -12345, big_b = 678, big_r;
+    sc_biguint<300> big_ua = 5, big_ub = 7, big_ur;
+    std::cout << "sc_bigint<300>: "
+              << std::setw( 7 ) << count( [&] { big_r = big_a + big_b * big_a; } )
+              << std::setw( 7 ) << count( [&] { big_r = big_a / big_b - big_a % big_b; } )
+              << std::setw( 7 ) << count( [&] { big_r = ( big_a << 7 ) ^ big_b; } )
+              << std::endl;
+    std::cout << "sc_biguint<300>:"
+              << std::setw( 7 ) << count( [&] { big_ur = big_ua + big_ub * big_ua; } )
+              << std::setw( 7 ) << count( [&] { big_ur = big_ua / big_ub - big_ua % big_ub; } )
+              << std::setw( 7 ) << count( [&] { big_ur = ( big_ua << 7 ) ^ big_ub; } )
+              << std::endl;
+    return 0;
+}
@@ -0,0 +1,98 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  bigint_ops.cpp -- Results of sc_bigint/sc_biguint operators whose widths
+                    select the special cases of sc_big_ops.h:
+
+                      - division and modulo with a one-digit result and
+                        wider operands,
+                      - modulo of an unsigned numerator by a signed
+                        denominator,
+                      - the result type of sc_biguint % sc_biguint.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+
+#include <iostream>
+
+using sc_dt::sc_bigint;
+using sc_dt::sc_biguint;
+using sc_dt::sc_signed;
+using sc_dt::sc_unsigned;
+
+static const char* kind( const sc_signed& )   { return "signed"; }
+static const char* kind( const sc_unsigned& ) { return "unsigned"; }
+
+int
+sc_main( int argc, char* argv[] )
+{
+    // one-digit result, two-digit numerator
+
+    sc_bigint<40> wide_numer = 1;
+    wide_numer = ( wide_numer << 32 ) + sc_bigint<40>( 1 );
+    std::cout << "sc_bigint<40>(2^32+1) % sc_bigint<4>(3) = "
+              << ( wide_numer % sc_bigint<4>( 3 ) ) << std::endl;
+
+    sc_bigint<40> neg_numer = -wide_numer;
+    std::cout << "sc_bigint<40>(-2^32-1) % sc_bigint<4>(3) = "
+              << ( neg_numer % sc_bigint<4>( 3 ) ) << std::endl;
+
+    // one-digit result, two-digit denominator
+
+    sc_biguint<40> wide_denom = 1;
+    wide_denom = ( wide_denom << 32 ) + sc_biguint<40>( 1 );
+    std::cout << "sc_biguint<8>(200) / sc_biguint<40>(2^32+1) = "
+              << ( sc_biguint<8>( 200 ) / wide_denom ) << std::endl;
+
+    // unsigned numerator, signed denominator
+
+    std::cout << "sc_biguint<8>(255) % sc_bigint<8>(100) = "
+              << ( sc_biguint<8>( 255 ) % sc_bigint<8>( 100 ) ) << std::endl;
+    std::cout << "sc_biguint<8>(255) % sc_bigint<8>(-100) = "
+              << ( sc_biguint<8>( 255 ) % sc_bigint<8>( -100 ) ) << std::endl;
+    std::cout << "sc_biguint<8>(255) % sc_bigint<16>(1000) = "
+              << ( sc_biguint<8>( 255 ) % sc_bigint<16>( 1000 ) ) << std::endl;
+
+    // result types of modulo
+
+    std::cout << "sc_biguint % sc_biguint is "
+              << kind( sc_biguint<8>( 255 ) % sc_biguint<16>( 1000 ) )
+              << std::endl;
+    std::cout << "sc_biguint % sc_bigint is "
+              << kind( sc_biguint<8>( 255 ) % sc_bigint<16>( 1000 ) )
+              << std::endl;
+    std::cout << "sc_bigint % sc_biguint is "
+              << kind( sc_bigint<8>( 100 ) % sc_biguint<16>( 1000 ) )
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,202 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  bigint_perf.cpp -- Width sweep of the multiplication and division of
+                     wide sc_unsigned values.
+
+                     For each width W the product of two W-bit values and
+                     the quotient and remainder of a 2W-bit value by a
+                     W-bit value are timed with each algorithm selected
+                     for the top level of the operation, using the
+                     thresholds in sc_vector_utils.h:
+
+                       multiplication: schoolbook, Karatsuba, Toom-3
+                       division:       long division, Barrett
+
+                     The algorithm is the fastest one below the width at
+                     which the next one becomes faster, which gives the
+                     crossover points of the thresholds.
+
+                     Usage:
+                       bigint_perf [max_bits] [work]
+
+                     The checksum covers the results of the default
+                     thresholds, all algorithms must give the same ones.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using sc_dt::sc_unsigned;
+
+// xorshift64 random digits
+static sc_dt::uint64 state = 0x2545f4914f6cdd1dULL;
+
+static void
+randomize( sc_unsigned& value )
+{
+    for( int i = 0; i < value.length(); i += 32 ) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        int high = i + 31 < value.length() ? i + 31 : value.length() - 1;
+        value.range( high, i ) = state;
+    }
+    value[value.length() - 1] = 1;  // keep the width significant
+}
+
+// FNV-1a style mixing of the results
+static void
+mix( sc_dt::uint64& hash, const sc_unsigned& value )
+{
+    std::string digits = value.to_string( sc_dt::SC_HEX_US );
+    for( unsigned i = 0; i < digits.size(); ++i ) {
+        hash ^= static_cast<unsigned char>( digits[i] );
+        hash *= 0x100000001b3ULL;
+    }
+}
+
+// thresholds of the algorithms in bits
+struct thresholds
+{
+    int karatsuba;
+    int toom3;
+    int barrett;
+
+    void apply() const
+    {
+        sc_dt::vector_karatsuba_bits = karatsuba;
+        sc_dt::vector_toom3_bits = toom3;
+        sc_dt::vector_barrett_bits = barrett;
+    }
+};
+
+// nanoseconds per call of the operation, the best of several rounds
+template< typename Operation >
+double
+measure( Operation operation, unsigned repeats )
+{
+    double best = 0;
+    for( int round = 0; round < 3; ++round ) {
+        std::chrono::steady_clock::time_point start =
+          std::chrono::steady_clock::now();
+        for( unsigned i = 0; i < repeats; ++i )
+            operation();
+        std::chrono::duration<double, std::nano> elapsed =
+          std::chrono::steady_clock::now() - start;
+        double time = elapsed.count() / repeats;
+        if( round == 0 || time < best )
+            best = time;
+    }
+    return best;
+}
+
+int sc_main( int argc, char* argv[] )
+{
+    int      max_bits = ( argc > 1 ) ? std::atoi( argv[1] ) : 8192;
+    unsigned work     = ( argc > 2 ) ? std::atoi( argv[2] ) : 2000000;
+
+    const thresholds defaults = { sc_dt::vector_karatsuba_bits,
+                                  sc_dt::vector_toom3_bits,
+                                  sc_dt::vector_barrett_bits };
+
+    std::cout << "thresholds: karatsuba " << defaults.karatsuba
+              << ", toom-3 " << defaults.toom3 << ", barrett "
+              << defaults.barrett << " bits" << std::endl;
+    std::cout << "  bits   schoolbook  karatsuba     toom-3"
+                 "  |       long    barrett   (ns)" << std::endl;
+
+    sc_dt::uint64 hash = 0xcbf29ce484222325ULL;
+    bool          match = true;
+
+    for( int bits = 256; bits <= max_bits; bits *= 2 ) {
+        sc_unsigned left( bits ), right( bits ), numerator( 2 * bits );
+        sc_unsigned product( 2 * bits ), quotient( 2 * bits );
+        sc_unsigned remainder( bits );
+        randomize( left );
+        randomize( right );
+        randomize( numerator );
+
+        // the same amount of work per width for the quadratic algorithms
+        unsigned words = bits / 32;
+        unsigned repeats = work / ( words * words ) + 1;
+
+        // each algorithm is used at the top level of the operation, the
+        // default ones below it
+        const thresholds selected[] = {
+          { INT_MAX, INT_MAX, INT_MAX },
+          { bits < defaults.karatsuba ? bits : defaults.karatsuba,
+            INT_MAX, INT_MAX },
+          { defaults.karatsuba, bits, INT_MAX },
+          { defaults.karatsuba, defaults.toom3, INT_MAX },
+          { defaults.karatsuba, defaults.toom3, bits }
+        };
+
+        defaults.apply();
+        sc_unsigned expected_product( left * right );
+        sc_unsigned expected_quotient( numerator / left );
+        sc_unsigned expected_remainder( numerator % left );
+        mix( hash, expected_product );
+        mix( hash, expected_quotient );
+        mix( hash, expected_remainder );
+
+        std::cout << std::setw( 6 ) << bits;
+        for( int i = 0; i < 5; ++i ) {
+            selected[i].apply();
+            double time;
+            if( i < 3 ) {
+                time = measure( [&] { product = left * right; }, repeats );
+                match = match && product == expected_product;
+            } else {
+                time = measure( [&] { quotient = numerator / left;
+                                      remainder = numerator % left; },
+                                repeats );
+                match = match && quotient == expected_quotient &&
+                        remainder == expected_remainder;
+            }
+            std::cout << ( i == 3 ? "  | " : " " ) << std::setw( 10 )
+                      << static_cast<long>( time );
+        }
+        std::cout << std::endl;
+    }
+    defaults.apply();
+
+    std::cout << "checksum: " << std::hex << hash << std::dec
+              << ( match ? "" : " MISMATCH" ) << std::endl;
+    return match ? 0 : 1;
+}
@@ -0,0 +1,200 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  clock_perf.cpp -- Benchmark of clocks, which are mostly idle.
+
+                    Each clock drives a block, whose thread waits for a
+                    request and then works for a burst of clock cycles.
+                    An observer samples the values of all clocks at
+                    times on and between their edges. Running the
+                    benchmark with and without lazy clocks gives the
+                    cost of the unobserved clock edges.
+
+                    Usage:
+                      clock_perf [clocks] [cycles] [lazy] [activity]
+
+                    The checksum covers the clock values seen by the
+                    blocks and by the observer, it is the same with and
+                    without lazy clocks.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace sc_core;
+
+static const unsigned burst = 10; // clock cycles of work per request
+
+// FNV-1a style mixing of the observed values
+static void
+mix( sc_dt::uint64& hash, sc_dt::uint64 value )
+{
+    hash ^= value;
+    hash *= 0x100000001b3ULL;
+}
+
+// ----------------------------------------------------------------------------
+//  block: works for a burst of clock cycles after each request
+// ----------------------------------------------------------------------------
+
+SC_MODULE( block )
+{
+    sc_in<bool> clk;
+
+    SC_CTOR( block, unsigned idx, unsigned activity )
+      : clk( "clk" ), m_interval( burst * 100 / activity )
+      , m_idx( idx ), m_edges( 0 ), m_hash( 0xcbf29ce484222325ULL )
+    {
+        SC_THREAD( run );
+          sensitive << clk.pos();
+          dont_initialize();
+        SC_THREAD( generate );
+    }
+
+    void run()
+    {
+        for(;;) {
+            wait( m_request );
+            for( unsigned i = 0; i < burst; ++i ) {
+                wait();
+                ++m_edges;
+                mix( m_hash, sc_time_stamp().value() );
+                mix( m_hash, clk.read() + 2 * clk.posedge() );
+            }
+        }
+    }
+
+    // requests at irregular intervals, on average every m_interval ns
+    void generate()
+    {
+        for( unsigned n = 0;; ++n ) {
+            unsigned jitter = ( n * 7919 + m_idx * 104729 ) % m_interval;
+            wait( sc_time( m_interval / 2 + jitter, SC_NS ) );
+            m_request.notify();
+        }
+    }
+
+    sc_event      m_request;
+    unsigned      m_interval;
+    unsigned      m_idx;
+    sc_dt::uint64 m_edges;
+    sc_dt::uint64 m_hash;
+};
+
+// ----------------------------------------------------------------------------
+//  observer: reads the clocks at times on and between their edges
+// ----------------------------------------------------------------------------
+
+SC_MODULE( observer )
+{
+    SC_CTOR( observer, const std::vector<sc_clock*>& clocks )
+      : m_clocks( clocks ), m_hash( 0xcbf29ce484222325ULL )
+    {
+        SC_THREAD( run );
+    }
+
+    void run()
+    {
+        for( unsigned n = 0;; ++n ) {
+            // a multiple of 50 ps, like all clock edges
+            wait( sc_time( 50 * ( 40 + ( n * 37 ) % 101 ), SC_PS ) );
+            sample();
+            wait( SC_ZERO_TIME );
+            sample();
+        }
+    }
+
+    void sample()
+    {
+        for( unsigned i = 0; i < m_clocks.size(); ++i ) {
+            const sc_clock& c = *m_clocks[i];
+            mix( m_hash, sc_time_stamp().value() );
+            mix( m_hash, c.read() + 2 * c.event()
+                         + 4 * c.posedge() + 8 * c.negedge() );
+        }
+    }
+
+    std::vector<sc_clock*> m_clocks;
+    sc_dt::uint64          m_hash;
+};
+
+int sc_main( int argc, char* argv[] )
+{
+    unsigned n        = ( argc > 1 ) ? std::atoi( argv[1] ) : 16;
+    unsigned cycles   = ( argc > 2 ) ? std::atoi( argv[2] ) : 20000;
+    bool     lazy     = ( argc > 3 ) ? std::atoi( argv[3] ) != 0 : true;
+    unsigned activity = ( argc > 4 ) ? std::atoi( argv[4] ) : 2;
+    if( activity == 0 || activity > 100 )
+        activity = 2;
+
+    // clocks of different periods, duty cycles, start times and first edges
+    std::vector<sc_clock*> clocks;
+    std::vector<block*>    blocks;
+    for( unsigned i = 0; i < n; ++i ) {
+        sc_clock* clk = new sc_clock( sc_gen_unique_name( "clk" ),
+                                      sc_time( 1000 + 100 * ( i % 7 ), SC_PS ),
+                                      ( i % 2 ) ? 0.3 : 0.5,
+                                      sc_time( 250 * ( i % 4 ), SC_PS ),
+                                      i % 3 != 2 );
+        clk->set_lazy( lazy );
+        block* b = new block( sc_gen_unique_name( "block" ), i, activity );
+        b->clk( *clk );
+        clocks.push_back( clk );
+        blocks.push_back( b );
+    }
+    observer obs( "observer", clocks );
+
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+    sc_start( sc_time( cycles, SC_NS ) );
+    std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+    std::cout << n << " clocks, " << cycles << " cycles, " << activity
+              << "% active, lazy " << ( lazy ? "on" : "off" ) << ": "
+              << elapsed.count() << " s" << std::endl;
+
+    sc_dt::uint64 edges = 0;
+    sc_dt::uint64 hash  = obs.m_hash;
+    for( unsigned i = 0; i < n; ++i ) {
+        edges += blocks[i]->m_edges;
+        mix( hash, blocks[i]->m_hash );
+    }
+    std::cout << "edges seen by the blocks: " << edges << std::endl;
+    std::cout << "clock checksum: " << std::hex << hash << std::dec
+              << std::endl;
+    return 0;
+}
@@ -0,0 +1,293 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  coro_thread_perf.cpp -- Benchmark of stackless coroutine threads.
+
+                     A number of processes is spawned, each waiting for
+                     its own period a number of times. This is done first
+                     with SC_THREAD processes, which run on a coroutine
+                     stack of the kernel (e.g. sc_cor_pkg_qt), then with
+                     coroutine threads (sc_spawn_coro), which run on the
+                     method process scheduling without a stack.
+
+                     A small model checks that coroutine threads work
+                     together with events, signals, method processes and
+                     TLM sockets.
+
+                     Usage:
+                       coro_thread_perf [processes] [iterations] [threads]
+
+                     Both kinds of processes produce the same checksum.
+                     With threads = 0, only coroutine threads are run, to
+                     scale beyond the number of stacks, which fit into
+                     the memory.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc>
+#include <tlm>
+#include <tlm_utils/simple_initiator_socket.h>
+#include <tlm_utils/simple_target_socket.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+using namespace sc_core;
+
+// resident memory of the process in bytes, 0 if unknown
+static double
+resident_bytes()
+{
+    std::ifstream statm( "/proc/self/statm" );
+    double pages = 0, resident = 0;
+    if( !( statm >> pages >> resident ) )
+        return 0;
+    return resident * 4096;
+}
+
+// ----------------------------------------------------------------------------
+//  workers: the processes of the benchmark
+// ----------------------------------------------------------------------------
+
+struct workers
+{
+    workers( unsigned n, unsigned iterations )
+      : m_n( n ), m_iterations( iterations ), m_checksum( 0 )
+      , m_rss( 0 ), m_frame_bytes( 0 )
+    {}
+
+    void thread( unsigned id )
+    {
+        const sc_time period( 1 + id % 7, SC_NS );
+        for( unsigned i = 0; i < m_iterations; ++i ) {
+            wait( period );
+            m_checksum += id ^ i;
+            if( id == 0 && i == m_iterations / 2 )
+                m_rss = resident_bytes();
+        }
+    }
+
+    sc_coro_task coro( unsigned id )
+    {
+        const sc_time period( 1 + id % 7, SC_NS );
+        for( unsigned i = 0; i < m_iterations; ++i ) {
+            co_await co_wait( period );
+            m_checksum += id ^ i;
+            if( id == 0 && i == m_iterations / 2 ) {
+                m_rss = resident_bytes();
+                m_frame_bytes = sc_coro_task::promise_type::frame_bytes();
+            }
+        }
+    }
+
+    unsigned           m_n;
+    unsigned           m_iterations;
+    unsigned long long m_checksum;
+    double             m_rss;
+    std::size_t        m_frame_bytes;
+};
+
+// ----------------------------------------------------------------------------
+//  memory: TLM target without wait() in its b_transport
+// ----------------------------------------------------------------------------
+
+SC_MODULE( memory )
+{
+    tlm_utils::simple_target_socket<memory> socket;
+
+    SC_CTOR( memory ) : socket( "socket" )
+    {
+        for( unsigned i = 0; i < 256; ++i )
+            m_data[i] = i * 7;
+        socket.register_b_transport( this, &memory::b_transport );
+    }
+
+    void b_transport( tlm::tlm_generic_payload& trans, sc_time& delay )
+    {
+        unsigned* data = reinterpret_cast<unsigned*>( trans.get_data_ptr() );
+        sc_dt::uint64 addr = trans.get_address() % 256;
+        if( trans.is_write() )
+            m_data[addr] = *data;
+        else
+            *data = m_data[addr];
+        delay += sc_time( 10, SC_NS );
+        trans.set_response_status( tlm::TLM_OK_RESPONSE );
+    }
+
+    unsigned m_data[256];
+};
+
+// ----------------------------------------------------------------------------
+//  interop: coroutine threads talking to events, signals, methods and TLM
+// ----------------------------------------------------------------------------
+
+SC_MODULE( interop )
+{
+    tlm_utils::simple_initiator_socket<interop> socket;
+
+    sc_signal<unsigned> value;
+    sc_event            ack;
+
+    SC_CTOR( interop )
+      : socket( "socket" ), value( "value" ), m_sum( 0 ), m_reads( 0 )
+    {
+        SC_CORO_THREAD( producer );
+
+        SC_CORO_THREAD( initiator );
+
+        SC_METHOD( observe );
+        sensitive << value;
+        dont_initialize();
+    }
+
+    // write the signal, wait for the acknowledge of the observer
+    sc_coro_task producer()
+    {
+        for( unsigned i = 1; i <= 100; ++i ) {
+            value.write( i );
+            co_await co_wait( sc_time( 100, SC_NS ), ack );
+            if( !ack.triggered() )
+                SC_REPORT_ERROR( "interop", "missing acknowledge" );
+        }
+    }
+
+    void observe()
+    {
+        m_sum += value.read();
+        ack.notify( 5, SC_NS );
+    }
+
+    // read-modify-write of the memory through the socket
+    sc_coro_task initiator()
+    {
+        for( unsigned i = 0; i < 128; ++i ) {
+            unsigned addr = i % 64;
+            unsigned data = 0;
+            co_await transport( tlm::TLM_READ_COMMAND, addr, data );
+            m_reads += data;
+            data += value.read();
+            co_await transport( tlm::TLM_WRITE_COMMAND, addr, data );
+        }
+    }
+
+    // a nested coroutine, consuming the annotated delay
+    sc_coro_task transport( tlm::tlm_command cmd, unsigned addr,
+                            unsigned& data )
+    {
+        tlm::tlm_generic_payload trans;
+        sc_time delay = SC_ZERO_TIME;
+        trans.set_command( cmd );
+        trans.set_address( addr );
+        trans.set_data_ptr( reinterpret_cast<unsigned char*>( &data ) );
+        trans.set_data_length( sizeof( data ) );
+        trans.set_streaming_width( sizeof( data ) );
+        trans.set_byte_enable_ptr( 0 );
+        trans.set_dmi_allowed( false );
+        trans.set_response_status( tlm::TLM_INCOMPLETE_RESPONSE );
+        socket->b_transport( trans, delay );
+        if( trans.is_response_error() )
+            SC_REPORT_ERROR( "interop", "transaction failed" );
+        co_await co_wait( delay );
+    }
+
+    unsigned long m_sum;
+    unsigned long m_reads;
+};
+
+// ----------------------------------------------------------------------------
+//  sc_main
+// ----------------------------------------------------------------------------
+
+int sc_main( int argc, char* argv[] )
+{
+    unsigned n          = ( argc > 1 ) ? std::atoi( argv[1] ) : 10000;
+    unsigned iterations = ( argc > 2 ) ? std::atoi( argv[2] ) : 100;
+    bool     run_threads = ( argc > 3 ) ? std::atoi( argv[3] ) != 0 : true;
+
+    interop top( "top" );
+    memory  mem( "mem" );
+    top.socket.bind( mem.socket );
+
+    sc_start( SC_ZERO_TIME );
+    double rss_base = resident_bytes();
+
+    // SC_THREAD processes
+
+    workers threads( n, iterations );
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+    if( run_threads ) {
+        for( unsigned i = 0; i < n; ++i )
+            sc_spawn( sc_bind( &workers::thread, &threads, i ) );
+        sc_start( sc_time( 7 * iterations + 1, SC_NS ) );
+    }
+    std::chrono::duration<double> thread_time =
+      std::chrono::steady_clock::now() - start;
+
+    double rss_threads = resident_bytes();
+
+    // coroutine threads
+
+    workers coros( n, iterations );
+    start = std::chrono::steady_clock::now();
+    for( unsigned i = 0; i < n; ++i )
+        sc_spawn_coro( [&coros, i]() { return coros.coro( i ); } );
+    sc_start( sc_time( 7 * iterations + 1, SC_NS ) );
+    std::chrono::duration<double> coro_time =
+      std::chrono::steady_clock::now() - start;
+
+    sc_start();
+
+    const double activations = double( n ) * iterations;
+    std::cout << n << " processes, " << iterations << " iterations"
+              << std::endl;
+    if( run_threads ) {
+        std::cout << "  SC_THREAD:     " << thread_time.count() << " s, "
+                  << activations / thread_time.count() << " activations/s, "
+                  << ( threads.m_rss - rss_base ) / n << " bytes/process"
+                  << std::endl;
+    }
+    std::cout << "  sc_spawn_coro: " << coro_time.count() << " s, "
+              << activations / coro_time.count() << " activations/s, "
+              << ( coros.m_rss - rss_threads ) / n << " bytes/process, "
+              << coros.m_frame_bytes / n << " bytes/frame"
+              << std::endl;
+
+    std::cout << "thread checksum: " << threads.m_checksum << std::endl;
+    std::cout << "coroutine checksum: " << coros.m_checksum << std::endl;
+    std::cout << "interop checksum: " << top.m_sum << " " << top.m_reads
+              << " at " << sc_time_stamp() << std::endl;
+
+    return ( !run_threads || threads.m_checksum == coros.m_checksum ) ? 0 : 1;
+}
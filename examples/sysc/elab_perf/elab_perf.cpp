@@ -0,0 +1,257 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  elab_perf.cpp -- Benchmark of the elaboration of a deep hierarchy.
+
+                   Builds a tree of modules with the given depth and
+                   fanout. Each module holds signals, input ports and
+                   method processes, and its children share a leaf name,
+                   so that each of them gets a unique name generated by
+                   the kernel. The ports of a child are bound to the
+                   ports or to the signals of its parent, the methods
+                   are sensitive to the ports. All objects are then
+                   looked up by their hierarchical name.
+
+                   The elaboration profile of the kernel reports the
+                   time and the allocations of each elaboration stage,
+                   which are counted by the global operator new.
+
+                   Usage:
+                     elab_perf [depth] [fanout] [ports] [processes]
+
+                   The checksum covers the names of all objects, in the
+                   order of the object hierarchy, and the number of
+                   method activations in the first delta cycle.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+using namespace sc_core;
+
+// FNV-1a style mixing of the object names
+static void
+mix( sc_dt::uint64& hash, const char* name )
+{
+    for( ; *name; ++name ) {
+        hash ^= static_cast<unsigned char>( *name );
+        hash *= 0x100000001b3ULL;
+    }
+}
+
+// ----------------------------------------------------------------------------
+//  allocations of the program, for the elaboration profile
+// ----------------------------------------------------------------------------
+
+static sc_dt::uint64 allocations = 0;
+static sc_dt::uint64 allocated_bytes = 0;
+
+void* operator new( std::size_t size )
+{
+    ++allocations;
+    allocated_bytes += size;
+    void* p = std::malloc( size ? size : 1 );
+    if( !p )
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete( void* p ) noexcept
+{
+    std::free( p );
+}
+
+void operator delete( void* p, std::size_t ) noexcept
+{
+    std::free( p );
+}
+
+static void
+count_allocations( sc_dt::uint64& count, sc_dt::uint64& bytes )
+{
+    count = allocations;
+    bytes = allocated_bytes;
+}
+
+// peak resident set size in kB, 0 if unknown
+static long
+peak_memory()
+{
+#if !defined(_WIN32)
+    struct rusage usage;
+    if( getrusage( RUSAGE_SELF, &usage ) == 0 )
+#   if defined(__APPLE__)
+        return usage.ru_maxrss / 1024;
+#   else
+        return usage.ru_maxrss;
+#   endif
+#endif
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+//  node: module of the hierarchy with signals, ports, methods and children
+// ----------------------------------------------------------------------------
+
+SC_MODULE( node )
+{
+    sc_vector< sc_signal<int> > sig;
+    sc_vector< sc_in<int> >     in;
+    sc_event                    ev;
+
+    SC_CTOR( node, node* parent, unsigned depth, unsigned fanout,
+             unsigned ports, unsigned processes )
+      : sig( "sig", ports ), in( "in", ports ), ev( "ev" ), m_runs( 0 )
+    {
+        // alternate between hierarchical binding and binding to a channel
+        for( unsigned i = 0; i < ports; ++i ) {
+            if( !parent )
+                in[i]( sig[i] );
+            else if( parent->m_children.size() % 2 )
+                in[i]( parent->sig[i] );
+            else
+                in[i]( parent->in[i] );
+        }
+
+        for( unsigned i = 0; i < processes; ++i ) {
+            sc_spawn_options opt;
+            opt.spawn_method();
+            if( ports )
+                opt.set_sensitivity( &in[i % ports] );
+            sc_spawn( sc_bind( &node::run, this ), "run", &opt );
+        }
+
+        if( depth > 1 ) {
+            for( unsigned i = 0; i < fanout; ++i )
+                m_children.push_back(
+                  new node( "child", this, depth - 1, fanout, ports,
+                            processes ) );
+        }
+    }
+
+    ~node()
+    {
+        for( unsigned i = 0; i < m_children.size(); ++i )
+            delete m_children[i];
+    }
+
+    void run()
+        { ++m_runs; }
+
+    // method activations of this node and its children
+    sc_dt::uint64 runs() const
+    {
+        sc_dt::uint64 n = m_runs;
+        for( unsigned i = 0; i < m_children.size(); ++i )
+            n += m_children[i]->runs();
+        return n;
+    }
+
+    std::vector<node*> m_children;
+    sc_dt::uint64      m_runs;
+};
+
+// names of the objects below the given ones, in the order of the hierarchy
+static void
+collect( const std::vector<sc_object*>& objects,
+         std::vector<std::string>& names )
+{
+    for( unsigned i = 0; i < objects.size(); ++i ) {
+        names.push_back( objects[i]->name() );
+        collect( objects[i]->get_child_objects(), names );
+    }
+}
+
+int sc_main( int argc, char* argv[] )
+{
+    unsigned depth     = ( argc > 1 ) ? std::atoi( argv[1] ) : 6;
+    unsigned fanout    = ( argc > 2 ) ? std::atoi( argv[2] ) : 6;
+    unsigned ports     = ( argc > 3 ) ? std::atoi( argv[3] ) : 2;
+    unsigned processes = ( argc > 4 ) ? std::atoi( argv[4] ) : 2;
+
+    // the children of a module share their leaf name
+    sc_report_handler::set_actions( SC_ID_INSTANCE_EXISTS_, SC_DO_NOTHING );
+
+    sc_set_elab_profiling( true );
+    sc_set_elab_allocation_counter( &count_allocations );
+
+    long memory = peak_memory();
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+
+    node* top = new node( "top", 0, depth, fanout, ports, processes );
+    sc_start( SC_ZERO_TIME );
+
+    std::chrono::duration<double> elaboration =
+      std::chrono::steady_clock::now() - start;
+    memory = peak_memory() - memory;
+
+    std::vector<std::string> names;
+    collect( sc_get_top_level_objects(), names );
+
+    start = std::chrono::steady_clock::now();
+    unsigned found = 0;
+    for( unsigned i = 0; i < names.size(); ++i ) {
+        if( sc_find_object( names[i].c_str() ) )
+            ++found;
+    }
+    std::chrono::duration<double> lookup =
+      std::chrono::steady_clock::now() - start;
+
+    std::cout << "depth " << depth << ", fanout " << fanout << ", "
+              << ports << " ports, " << processes << " processes: "
+              << names.size() << " objects, elaboration "
+              << elaboration.count() << " s, " << memory << " kB, lookup "
+              << lookup.count() << " s" << std::endl;
+
+    sc_dt::uint64 hash = 0xcbf29ce484222325ULL;
+    for( unsigned i = 0; i < names.size(); ++i )
+        mix( hash, names[i].c_str() );
+    hash ^= top->runs();
+    hash *= 0x100000001b3ULL;
+    std::cout << "objects found: " << found << std::endl;
+    std::cout << "name checksum: " << std::hex << hash << std::dec
+              << std::endl;
+
+    delete top;
+    return 0;
+}
@@ -0,0 +1,357 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  lv_perf.cpp -- Operations on wide sc_lv_base values.
+
+                 Each operation is timed twice: bit by bit through
+                 get_bit() and set_bit(), and through the sc_lv_base
+                 operators, which work on whole data and control words.
+
+                 Usage:
+                   lv_perf [repeats]
+
+                 The checksum covers the results of the operators, the
+                 bit by bit results must be the same.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using sc_dt::sc_logic;
+using sc_dt::sc_logic_value_t;
+using sc_dt::sc_lv_base;
+using sc_dt::sc_unsigned;
+
+static const int values_n = 16;   // operands per operation.
+
+// xorshift64 random numbers
+static sc_dt::uint64 state = 0x2545f4914f6cdd1dULL;
+
+static sc_dt::uint64
+next()
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+// a string of '0' and '1' characters, with 'X' and 'Z' if unknown is true
+static std::string
+random_string( int width, bool unknown )
+{
+    std::string s( width, '0' );
+    for( int i = 0; i < width; ++i ) {
+        sc_dt::uint64 r = next();
+        s[i] = ( unknown && ( r & 0xf0 ) == 0 ) ? "XZ"[r & 1] : "01"[r & 1];
+    }
+    if( s[0] == '0' )
+        s[0] = '1';   // not to be read as a prefix such as "0x"
+    return s;
+}
+
+// FNV-1a style mixing of the results
+static void
+mix( sc_dt::uint64& hash, const std::string& digits )
+{
+    for( unsigned i = 0; i < digits.size(); ++i ) {
+        hash ^= static_cast<unsigned char>( digits[i] );
+        hash *= 0x100000001b3ULL;
+    }
+}
+
+// nanoseconds per operation, the best of several rounds
+template< typename Operation >
+double
+measure( Operation operation, unsigned repeats )
+{
+    double best = 0;
+    for( int round = 0; round < 3; ++round ) {
+        std::chrono::steady_clock::time_point start =
+          std::chrono::steady_clock::now();
+        for( unsigned i = 0; i < repeats; ++i ) {
+            for( int value_i = 0; value_i < values_n; ++value_i )
+                operation( value_i );
+        }
+        std::chrono::duration<double, std::nano> elapsed =
+          std::chrono::steady_clock::now() - start;
+        double time = elapsed.count() / ( repeats * values_n );
+        if( round == 0 || time < best )
+            best = time;
+    }
+    return best;
+}
+
+// bit by bit versions of the operations
+
+static void
+bit_assign( sc_lv_base& x, const std::string& s )
+{
+    int len = x.length();
+    for( int i = 0; i < len; ++i )
+        x.set_bit( i, sc_logic::char_to_logic[(int)s[len - i - 1]] );
+}
+
+static std::string
+bit_to_string( const sc_lv_base& x )
+{
+    int len = x.length();
+    std::string s;
+    for( int i = 0; i < len; ++i )
+        s += sc_logic::logic_to_char[x.get_bit( len - i - 1 )];
+    return s;
+}
+
+static sc_logic_value_t
+bit_reduce( const sc_lv_base& x, const sc_logic_value_t table[4][4],
+            sc_logic_value_t result )
+{
+    int len = x.length();
+    for( int i = 0; i < len; ++i )
+        result = table[result][x.get_bit( i )];
+    return result;
+}
+
+static bool
+bit_is_01( const sc_lv_base& x, int hi, int lo )
+{
+    for( int i = lo; i <= hi; ++i ) {
+        if( x.get_bit( i ) > sc_dt::Log_1 )
+            return false;
+    }
+    return true;
+}
+
+static void
+bit_range_read( sc_lv_base& r, const sc_lv_base& x, int lo )
+{
+    int len = r.length();
+    for( int i = 0; i < len; ++i )
+        r.set_bit( i, x.get_bit( lo + i ) );
+}
+
+static void
+bit_range_write( sc_lv_base& x, int lo, const sc_lv_base& r )
+{
+    int len = r.length();
+    for( int i = 0; i < len; ++i )
+        x.set_bit( lo + i, r.get_bit( i ) );
+}
+
+static void
+bit_assign( sc_lv_base& x, const sc_unsigned& u )
+{
+    int len = x.length();
+    for( int i = 0; i < len; ++i )
+        x.set_bit( i, sc_logic_value_t( (bool) u[i] ) );
+}
+
+static bool
+bit_equal( const sc_lv_base& x, const sc_lv_base& y )
+{
+    int len = x.length();
+    for( int i = 0; i < len; ++i ) {
+        if( x.get_bit( i ) != y.get_bit( i ) )
+            return false;
+    }
+    return true;
+}
+
+// Times each operation bit by bit and on words for values W bits wide.
+void
+sweep( int w, unsigned repeats, sc_dt::uint64& hash, bool& match )
+{
+    std::vector<std::string> strings( values_n );
+    std::vector<sc_lv_base>  values( values_n, sc_lv_base( w ) );
+    std::vector<sc_lv_base>  others( values_n, sc_lv_base( w ) );
+    std::vector<sc_lv_base>  results( values_n, sc_lv_base( w ) );
+    std::vector<sc_lv_base>  bit_results( values_n, sc_lv_base( w ) );
+    std::vector<sc_lv_base>  ranges( values_n, sc_lv_base( w / 2 ) );
+    std::vector<sc_lv_base>  bit_ranges( values_n, sc_lv_base( w / 2 ) );
+    std::vector<sc_unsigned> numbers( values_n, sc_unsigned( w ) );
+    std::vector<sc_lv_base>  ones( values_n, sc_lv_base( w ) );
+    std::vector<int>         offsets( values_n );
+    int                      count = 0, bit_count = 0;
+
+    for( int i = 0; i < values_n; ++i ) {
+        strings[i] = random_string( w, true );
+        values[i] = strings[i].c_str();
+        others[i] = i % 2 ? values[i] : sc_lv_base( random_string( w, true ).c_str() );
+        numbers[i] = random_string( w, false ).insert( 0, "0b" ).c_str();
+        ones[i] = sc_lv_base( sc_logic( 1 ), w );
+        if( i % 2 )
+            ones[i][( next() % w )] = sc_logic( 'Z' );
+        offsets[i] = static_cast<int>( next() % ( w / 2 ) );
+    }
+
+    // compares the bit by bit and word results and mixes them into the hash
+    auto check = [&]( std::vector<sc_lv_base>& result,
+                      std::vector<sc_lv_base>& bit_result ) {
+        for( int i = 0; i < values_n; ++i ) {
+            match = match && result[i] == bit_result[i];
+            mix( hash, result[i].to_string() );
+        }
+    };
+    auto check_count = [&]() {
+        match = match && count == bit_count;
+        hash ^= count;
+        hash *= 0x100000001b3ULL;
+        count = bit_count = 0;
+    };
+    auto print = [&]( double bit_time, double time ) {
+        std::cout << std::setw( 8 ) << std::fixed << std::setprecision( 1 )
+                  << bit_time << std::setw( 7 ) << time;
+    };
+
+    std::cout << std::setw( 5 ) << w;
+
+    double bit_time = measure( [&]( int i ) {
+        bit_assign( bit_results[i], strings[i] ); }, repeats );
+    double time = measure( [&]( int i ) {
+        results[i] = strings[i].c_str(); }, repeats );
+    check( results, bit_results );
+    print( bit_time, time );
+
+    std::vector<std::string> texts( values_n ), bit_texts( values_n );
+    bit_time = measure( [&]( int i ) {
+        bit_texts[i] = bit_to_string( values[i] ); }, repeats );
+    time = measure( [&]( int i ) {
+        texts[i] = values[i].to_string(); }, repeats );
+    for( int i = 0; i < values_n; ++i ) {
+        match = match && texts[i] == bit_texts[i];
+        mix( hash, texts[i] );
+    }
+    print( bit_time, time );
+
+    // the and/or reductions see all the bits of the ones vectors
+    bit_time = measure( [&]( int i ) {
+        bit_count += bit_reduce( ones[i], sc_logic::and_table, sc_dt::Log_1 ) +
+                     bit_reduce( ones[i], sc_logic::or_table, sc_dt::Log_0 ) +
+                     bit_reduce( values[i], sc_logic::xor_table, sc_dt::Log_0 ); },
+        repeats );
+    time = measure( [&]( int i ) {
+        count += ones[i].and_reduce() + ones[i].or_reduce() +
+                 values[i].xor_reduce(); }, repeats );
+    count = bit_count = 0;
+    for( int i = 0; i < values_n; ++i ) {
+        count += ones[i].and_reduce() * 16 + ones[i].or_reduce() * 4 +
+                 values[i].xor_reduce();
+        bit_count += bit_reduce( ones[i], sc_logic::and_table, sc_dt::Log_1 ) * 16 +
+                     bit_reduce( ones[i], sc_logic::or_table, sc_dt::Log_0 ) * 4 +
+                     bit_reduce( values[i], sc_logic::xor_table, sc_dt::Log_0 );
+        count += values[i].and_reduce() * 64 + values[i].or_reduce() * 256;
+        bit_count += bit_reduce( values[i], sc_logic::and_table, sc_dt::Log_1 ) * 64 +
+                     bit_reduce( values[i], sc_logic::or_table, sc_dt::Log_0 ) * 256;
+    }
+    check_count();
+    print( bit_time, time );
+
+    bit_time = measure( [&]( int i ) {
+        bit_count += bit_is_01( ones[i], offsets[i] + w / 2 - 1, offsets[i] ); },
+        repeats );
+    time = measure( [&]( int i ) {
+        count += ones[i].range( offsets[i] + w / 2 - 1, offsets[i] ).is_01(); },
+        repeats );
+    count = bit_count = 0;
+    for( int i = 0; i < values_n; ++i ) {
+        count += ones[i].range( offsets[i] + w / 2 - 1, offsets[i] ).is_01();
+        bit_count += bit_is_01( ones[i], offsets[i] + w / 2 - 1, offsets[i] );
+    }
+    check_count();
+    print( bit_time, time );
+
+    bit_time = measure( [&]( int i ) {
+        bit_range_read( bit_ranges[i], values[i], offsets[i] ); }, repeats );
+    time = measure( [&]( int i ) {
+        ranges[i] = values[i].range( offsets[i] + w / 2 - 1, offsets[i] ); },
+        repeats );
+    check( ranges, bit_ranges );
+    print( bit_time, time );
+
+    for( int i = 0; i < values_n; ++i )
+        bit_results[i] = results[i] = others[i];
+    bit_time = measure( [&]( int i ) {
+        bit_range_write( bit_results[i], offsets[i], ranges[i] ); }, repeats );
+    time = measure( [&]( int i ) {
+        results[i].range( offsets[i] + w / 2 - 1, offsets[i] ) = ranges[i]; },
+        repeats );
+    check( results, bit_results );
+    print( bit_time, time );
+
+    bit_time = measure( [&]( int i ) {
+        bit_assign( bit_results[i], numbers[i] ); }, repeats );
+    time = measure( [&]( int i ) {
+        results[i] = numbers[i]; }, repeats );
+    check( results, bit_results );
+    print( bit_time, time );
+
+    bit_time = measure( [&]( int i ) {
+        bit_count += bit_equal( values[i], others[i] ); }, repeats );
+    time = measure( [&]( int i ) {
+        count += values[i] == others[i]; }, repeats );
+    count = bit_count = 0;
+    for( int i = 0; i < values_n; ++i ) {
+        count += values[i] == others[i];
+        bit_count += bit_equal( values[i], others[i] );
+    }
+    check_count();
+    print( bit_time, time );
+    std::cout << std::endl;
+}
+
+int sc_main( int argc, char* argv[] )
+{
+    unsigned repeats = ( argc > 1 ) ? std::atoi( argv[1] ) : 100;
+
+    std::cout << "  (ns per operation: bit by bit, words)" << std::endl;
+    std::cout << "    W    string      to_string        reduce"
+                 "        is_01    range read   range write"
+                 "   sc_unsigned            ==" << std::endl;
+
+    sc_dt::uint64 hash = 0xcbf29ce484222325ULL;
+    bool          match = true;
+
+    sweep( 64, repeats, hash, match );
+    sweep( 512, repeats, hash, match );
+    sweep( 1024, repeats, hash, match );
+    sweep( 4096, repeats, hash, match );
+
+    std::cout << "checksum: " << std::hex << hash << std::dec
+              << ( match ? "" : " MISMATCH" ) << std::endl;
+    return match ? 0 : 1;
+}
@@ -0,0 +1,263 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  parallel_pkt_switch.cpp -- Scaling benchmark for the parallel evaluation
+                             of method processes.
+
+                     The model is a generalization of the multicast helix
+                     packet switch of the pkt_switch example to an
+                     arbitrary number of ports. Every port consists of
+                     a sender and a stage of the self-routing ring of
+                     shift registers. Both are modelled as SC_METHODs,
+                     which are marked as parallel-safe: they only read
+                     signals and write signals owned by the same port.
+
+                     Usage:
+                       parallel_pkt_switch [ports] [cycles] [threads] [work]
+
+                       ports   = number of switch ports (2..64, default 16)
+                       cycles  = number of simulated clock cycles
+                       threads = host threads used for the evaluation,
+                                 1 disables the parallel evaluation
+                       work    = payload processing rounds per delivered
+                                 packet, to scale the load of the methods
+
+                     The checksum of the delivered payload is independent
+                     of the number of threads.
+
+  Original Author: Rashmi Goswami, Synopsys, Inc. (pkt_switch)
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace sc_core;
+
+typedef unsigned long long mask_type;
+
+// ----------------------------------------------------------------------------
+//  pkt: a multicast packet, an empty ring slot has no destinations.
+// ----------------------------------------------------------------------------
+
+struct pkt
+{
+    pkt() : data(0), id(0), dest(0) {}
+
+    unsigned  data;
+    unsigned  id;
+    mask_type dest;
+
+    bool operator == ( const pkt& rhs ) const
+      { return data == rhs.data && id == rhs.id && dest == rhs.dest; }
+};
+
+inline std::ostream&
+operator << ( std::ostream& os, const pkt& p )
+{
+    return os << "pkt(" << p.id << "," << p.data << "," << p.dest << ")";
+}
+
+inline void
+sc_trace( sc_trace_file* tf, const pkt& p, const std::string& name )
+{
+    sc_trace( tf, p.data, name + ".data" );
+    sc_trace( tf, p.id, name + ".id" );
+}
+
+// ----------------------------------------------------------------------------
+//  port: sender and ring stage of a single switch port
+// ----------------------------------------------------------------------------
+
+SC_MODULE( port )
+{
+    sc_in<bool>  clk;
+    sc_in<pkt>   ring_in;    // register of the previous ring stage
+    sc_out<pkt>  ring_out;   // register of this ring stage
+
+    sc_signal<pkt> incoming;
+
+    port( sc_module_name, unsigned id, unsigned n_ports, unsigned work )
+      : m_id( id )
+      , m_n_ports( n_ports )
+      , m_work( work )
+      , m_lfsr( 0x9e3779b9u ^ ( id * 0x85ebca6bu ) )
+      , m_seq( 0 )
+      , m_checksum( 0 )
+      , m_delivered( 0 )
+      , m_dropped( 0 )
+    {
+        SC_METHOD( send );
+        sensitive << clk.pos();
+        dont_initialize();
+        set_parallel_safe();
+
+        SC_METHOD( route );
+        sensitive << clk.pos();
+        dont_initialize();
+        set_parallel_safe();
+    }
+
+    unsigned           checksum()  const { return m_checksum; }
+    unsigned long long delivered() const { return m_delivered; }
+    unsigned long long dropped()   const { return m_dropped; }
+
+private:
+
+    unsigned random()
+    {
+        // xorshift32
+        m_lfsr ^= m_lfsr << 13;
+        m_lfsr ^= m_lfsr >> 17;
+        m_lfsr ^= m_lfsr << 5;
+        return m_lfsr;
+    }
+
+    // generate a new packet for one to three random destinations
+    void send()
+    {
+        pkt p;
+        p.data = random();
+        p.id   = m_id | ( ++m_seq << 6 );
+        for( unsigned i = random() % 3; i < 3; ++i )
+            p.dest |= mask_type(1) << ( random() % m_n_ports );
+        p.dest &= ~( mask_type(1) << m_id );
+        incoming.write( p );
+    }
+
+    // shift the ring, deliver to this port and inject the incoming packet
+    void route()
+    {
+        pkt p = ring_in.read();
+        const mask_type self = mask_type(1) << m_id;
+
+        if( p.dest & self ) {
+            m_checksum += process( p );
+            ++m_delivered;
+            p.dest &= ~self;
+        }
+
+        if( p.dest == 0 ) {
+            p = incoming.read();
+        } else if( incoming.read().dest != 0 ) {
+            ++m_dropped;
+        }
+        ring_out.write( p );
+    }
+
+    // CRC-32 over the payload, repeated to scale the method run time
+    unsigned process( const pkt& p ) const
+    {
+        unsigned crc = ~0u;
+        for( unsigned round = 0; round < m_work; ++round ) {
+            unsigned word = p.data ^ p.id ^ round;
+            for( int bit = 0; bit < 32; ++bit ) {
+                unsigned lsb = ( crc ^ word ) & 1u;
+                crc = ( crc >> 1 ) ^ ( lsb ? 0xedb88320u : 0u );
+                word >>= 1;
+            }
+        }
+        return ~crc;
+    }
+
+    const unsigned     m_id;
+    const unsigned     m_n_ports;
+    const unsigned     m_work;
+    unsigned           m_lfsr;
+    unsigned           m_seq;
+    unsigned           m_checksum;
+    unsigned long long m_delivered;
+    unsigned long long m_dropped;
+};
+
+// ----------------------------------------------------------------------------
+//  sc_main
+// ----------------------------------------------------------------------------
+
+int sc_main( int argc, char* argv[] )
+{
+    unsigned n_ports = ( argc > 1 ) ? std::atoi( argv[1] ) : 16;
+    unsigned cycles  = ( argc > 2 ) ? std::atoi( argv[2] ) : 2000;
+    unsigned threads = ( argc > 3 ) ? std::atoi( argv[3] ) : 4;
+    unsigned work    = ( argc > 4 ) ? std::atoi( argv[4] ) : 16;
+
+    if( n_ports < 2 || n_ports > 64 ) {
+        std::cerr << "number of ports must be within 2..64" << std::endl;
+        return 1;
+    }
+
+    sc_set_parallel_evaluate( threads );
+
+    sc_clock clk( "clk", 10, SC_NS );
+
+    std::vector<port*>            ports;
+    std::vector<sc_signal<pkt>*>  ring;
+    for( unsigned i = 0; i < n_ports; ++i ) {
+        ports.push_back( new port( sc_gen_unique_name("port"),
+                                   i, n_ports, work ) );
+        ring.push_back( new sc_signal<pkt>( sc_gen_unique_name("ring") ) );
+    }
+    for( unsigned i = 0; i < n_ports; ++i ) {
+        ports[i]->clk( clk );
+        ports[i]->ring_in( *ring[ ( i + n_ports - 1 ) % n_ports ] );
+        ports[i]->ring_out( *ring[i] );
+    }
+
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+    sc_start( sc_time( 10, SC_NS ) * cycles );
+    std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+    unsigned checksum = 0;
+    unsigned long long delivered = 0;
+    unsigned long long dropped = 0;
+    for( unsigned i = 0; i < n_ports; ++i ) {
+        checksum  += ports[i]->checksum();
+        delivered += ports[i]->delivered();
+        dropped   += ports[i]->dropped();
+    }
+
+    std::cout << "ports: " << n_ports << ", cycles: " << cycles
+              << ", threads: " << sc_get_parallel_evaluate()
+              << ", work: " << work << std::endl;
+    std::cout << "elapsed: " << elapsed.count() << " s" << std::endl;
+    std::cout << "checksum: 0x" << std::hex << std::setw(8)
+              << std::setfill('0') << checksum << std::dec
+              << ", delivered: " << delivered
+              << ", dropped: " << dropped << std::endl;
+    return 0;
+}
@@ -0,0 +1,175 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  payload_pool_perf.cpp -- Rate of generic payload transactions, which are
+                           allocated, acquired, filled with an 8 byte write
+                           and released:
+
+                             new/delete: a memory manager, which creates
+                                         each payload and its buffer with
+                                         new and deletes them when they
+                                         are released,
+                             pool:       tlm_utils::payload_pool,
+                             pool, host thread after retired pools:
+                                         payload_pool on a host thread,
+                                         whose per-thread free lists have
+                                         all been taken by pools, which
+                                         have since been destroyed or
+                                         reset.
+
+                           The last case must run at the rate of the pool,
+                           as the thread reuses the free lists of the
+                           retired pools.
+
+                           Usage:
+                             payload_pool_perf [transactions]
+
+                           The checksum covers the data of all
+                           transactions.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+#include <tlm>
+#include "tlm_utils/payload_pool.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+// creates each transaction with new, deletes it when it is released
+
+class new_delete_mm : public tlm::tlm_mm_interface
+{
+public:
+    tlm::tlm_generic_payload* allocate( unsigned int length )
+    {
+        tlm::tlm_generic_payload* trans = new tlm::tlm_generic_payload( this );
+        trans->set_data_ptr( new unsigned char[length] );
+        trans->set_data_length( length );
+        trans->set_streaming_width( length );
+        return trans;
+    }
+
+    virtual void free( tlm::tlm_generic_payload* trans )
+    {
+        delete[] trans->get_data_ptr();
+        delete trans;
+    }
+};
+
+// one transaction: an 8 byte write to address i
+
+template<typename MM>
+inline sc_dt::uint64
+transaction( MM& mm, sc_dt::uint64 i )
+{
+    tlm::tlm_generic_payload* trans = mm.allocate( 8 );
+    trans->acquire();
+    trans->set_command( tlm::TLM_WRITE_COMMAND );
+    trans->set_address( i );
+    std::memcpy( trans->get_data_ptr(), &i, 8 );
+    trans->set_response_status( tlm::TLM_OK_RESPONSE );
+
+    sc_dt::uint64 value;
+    std::memcpy( &value, trans->get_data_ptr(), 8 );
+    value ^= trans->get_address() << 1;
+    trans->release();
+    return value;
+}
+
+template<typename MM>
+sc_dt::uint64
+run( const char* name, MM& mm, sc_dt::uint64 n )
+{
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+
+    sc_dt::uint64 hash = 0;
+    for( sc_dt::uint64 i = 0; i < n; ++i )
+        hash = hash * 31 + transaction( mm, i );
+
+    std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+    std::cout << std::left << std::setw( 42 ) << name << std::right
+              << std::fixed << std::setprecision( 1 ) << std::setw( 8 )
+              << n / elapsed.count() / 1e6 << " M/s" << std::endl;
+    return hash;
+}
+
+int
+sc_main( int argc, char* argv[] )
+{
+    sc_dt::uint64 n = ( argc > 1 ) ? std::atoll( argv[1] ) : 10000000;
+    sc_dt::uint64 hash = 0;
+
+    new_delete_mm mm;
+    hash ^= run( "new/delete", mm, n );
+
+    tlm_utils::payload_pool pool;
+    hash ^= run( "pool", pool, n ) * 3;
+
+    // The host thread uses more pools than it keeps free lists for. These
+    // pools are destroyed or reset while it waits, then it runs the
+    // benchmark with another one.
+
+    {
+        tlm_utils::payload_pool  retired[8];
+        tlm_utils::payload_pool* destroyed = new tlm_utils::payload_pool[8];
+        tlm_utils::payload_pool  last;
+
+        std::promise<void> used, go;
+        std::thread thread( [&]() {
+            for( int i = 0; i < 8; ++i ) {
+                transaction( retired[i], i );
+                transaction( destroyed[i], i );
+            }
+            used.set_value();
+            go.get_future().wait();
+            hash ^= run( "pool, host thread after retired pools", last, n )
+                    * 5;
+        } );
+
+        used.get_future().wait();
+        delete[] destroyed;
+        for( int i = 0; i < 8; ++i )
+            retired[i].reset();
+        go.set_value();
+        thread.join();
+    }
+
+    std::cout << "checksum: " << std::hex << hash << std::dec << std::endl;
+    return 0;
+}
@@ -0,0 +1,209 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  timed_queue_perf.cpp -- Microbenchmark of the timed event queues.
+
+                     Compares the binary heap (sc_ppq) with the timing
+                     wheel (sc_timing_wheel) in the classic "hold" model:
+                     the queue is filled with a number of pending
+                     elements, then the earliest element is repeatedly
+                     extracted and re-inserted with a random delay.
+
+                     The second part simulates a number of method
+                     processes, each waiting for a random delay, with the
+                     queue selected by the environment variable
+                     SC_TIMED_EVENT_QUEUE (WHEEL or the default heap).
+
+                     Usage:
+                       timed_queue_perf [pending] [operations] [processes]
+
+                     Both queues extract the elements in the same order
+                     of time stamps, which is checked via a checksum.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+#include "sysc/utils/sc_pq.h"
+#include "sysc/utils/sc_timing_wheel.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace sc_core;
+
+typedef sc_dt::uint64 key_type;
+
+struct item
+{
+    key_type time;
+};
+
+static int
+item_compare( const void* p1, const void* p2 )
+{
+    key_type t1 = static_cast<const item*>( p1 )->time;
+    key_type t2 = static_cast<const item*>( p2 )->time;
+    return ( t1 < t2 ) ? 1 : ( ( t1 > t2 ) ? -1 : 0 );
+}
+
+static key_type
+item_key( const void* p )
+{
+    return static_cast<const item*>( p )->time;
+}
+
+// xorshift64, a mix of short delays (clock edges, bus cycles) and
+// occasional long ones (timeouts)
+struct delay_generator
+{
+    delay_generator() : state( 0x2545f4914f6cdd1dULL ) {}
+
+    key_type operator()()
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        if( ( state & 0xff ) == 0 )
+            return 1000000 + state % 100000000;     // 1us .. 100us
+        return 1000 * ( 1 + ( state >> 8 ) % 20 );  // 1ns .. 20ns
+    }
+
+    key_type state;
+};
+
+template< typename Queue >
+double hold( Queue& queue, unsigned pending, unsigned operations,
+             key_type& checksum )
+{
+    std::vector<item> items( pending );
+    delay_generator delay;
+
+    for( unsigned i = 0; i < pending; ++i ) {
+        items[i].time = delay();
+        queue.insert( &items[i] );
+    }
+
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+
+    checksum = 0;
+    for( unsigned i = 0; i < operations; ++i ) {
+        item* it = queue.extract_top();
+        checksum = checksum * 31 + it->time;
+        it->time += delay();
+        queue.insert( it );
+    }
+
+    std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+    while( queue.size() )
+        queue.extract_top();
+    return elapsed.count();
+}
+
+// ----------------------------------------------------------------------------
+//  waiter: method process with a random delay between its activations
+// ----------------------------------------------------------------------------
+
+SC_MODULE( waiter )
+{
+    SC_CTOR( waiter, unsigned id ) : m_activations( 0 )
+    {
+        // decorrelate the delay sequences of the processes
+        for( unsigned i = 0; i < id; ++i )
+            m_delay();
+        SC_METHOD( run );
+    }
+
+    void run()
+    {
+        ++m_activations;
+        next_trigger( sc_time::from_value( m_delay() ) );
+    }
+
+    delay_generator m_delay;
+    unsigned long   m_activations;
+};
+
+int sc_main( int argc, char* argv[] )
+{
+    unsigned pending    = ( argc > 1 ) ? std::atoi( argv[1] ) : 10000;
+    unsigned operations = ( argc > 2 ) ? std::atoi( argv[2] ) : 1000000;
+    unsigned processes  = ( argc > 3 ) ? std::atoi( argv[3] ) : 1000;
+
+    // hold model
+
+    key_type heap_checksum = 0;
+    key_type wheel_checksum = 0;
+
+    sc_ppq<item*> heap( 128, item_compare );
+    double heap_time = hold( heap, pending, operations, heap_checksum );
+
+    sc_timing_wheel<item*> wheel( item_key );
+    double wheel_time = hold( wheel, pending, operations, wheel_checksum );
+
+    std::cout << "hold model: " << pending << " pending, "
+              << operations << " operations" << std::endl;
+    std::cout << "  sc_ppq:          " << heap_time << " s" << std::endl;
+    std::cout << "  sc_timing_wheel: " << wheel_time << " s" << std::endl;
+    std::cout << "hold checksum: "
+              << ( heap_checksum == wheel_checksum ? "match" : "MISMATCH" )
+              << std::endl;
+
+    // simulation
+
+    const char* queue = std::getenv( "SC_TIMED_EVENT_QUEUE" );
+    std::vector<waiter*> waiters;
+    for( unsigned i = 0; i < processes; ++i )
+        waiters.push_back( new waiter( sc_gen_unique_name( "waiter" ), i ) );
+
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+    sc_start( 1, SC_MS );
+    std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+    unsigned long activations = 0;
+    for( unsigned i = 0; i < processes; ++i )
+        activations += waiters[i]->m_activations;
+
+    std::cout << "simulation: " << processes << " processes, "
+              << ( queue ? queue : "HEAP" ) << ": "
+              << elapsed.count() << " s" << std::endl;
+    std::cout << "simulation checksum: " << activations << " activations"
+              << std::endl;
+
+    return heap_checksum == wheel_checksum ? 0 : 1;
+}
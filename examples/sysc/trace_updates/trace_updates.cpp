@@ -0,0 +1,148 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  trace_updates.cpp -- Value changes of a VCD file, whose traces of signals
+                       are only checked after an update of the signal, next
+                       to polled traces of plain variables.
+
+                       The signal of a user-defined type adds no trace, as
+                       its sc_trace() is empty, so the variable traced
+                       before it must still be polled, also while the
+                       signal is not written. The signals of an
+                       sc_in port and of a type with several traces report
+                       their updates to all of their traces.
+
+                       The value change section of the file is printed.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace sc_core;
+
+// not traced
+
+struct opaque
+{
+    int value;
+
+    opaque( int v = 0 ) : value( v ) {}
+    bool operator == ( const opaque& other ) const
+        { return value == other.value; }
+};
+
+std::ostream& operator << ( std::ostream& os, const opaque& v )
+    { return os << v.value; }
+
+void sc_trace( sc_trace_file*, const opaque&, const std::string& ) {}
+
+// traced as two variables
+
+struct pair_value
+{
+    int low;
+    int high;
+
+    pair_value( int l = 0, int h = 0 ) : low( l ), high( h ) {}
+    bool operator == ( const pair_value& other ) const
+        { return low == other.low && high == other.high; }
+};
+
+std::ostream& operator << ( std::ostream& os, const pair_value& v )
+    { return os << v.low << ":" << v.high; }
+
+void sc_trace( sc_trace_file* tf, const pair_value& v,
+               const std::string& name )
+{
+    sc_trace( tf, v.low, name + ".low" );
+    sc_trace( tf, v.high, name + ".high" );
+}
+
+SC_MODULE( top )
+{
+    sc_in<int>               in;
+    sc_signal<int>           s;
+    sc_signal<opaque>        o;
+    sc_signal<pair_value>    p;
+    int                      x;
+
+    SC_CTOR( top )
+      : in( "in" ), s( "s" ), o( "o" ), p( "p" ), x( 0 )
+    {
+        in( s );
+        SC_THREAD( run );
+    }
+
+    void run()
+    {
+        for( int i = 1; i <= 5; ++i ) {
+            wait( 1, SC_NS );
+            x = i;
+            if( i % 2 )
+                s.write( 10 * i );
+            if( i == 2 )
+                o.write( opaque( i ) );
+            if( i > 3 )
+                p.write( pair_value( i, 2 * i ) );
+        }
+        wait( 1, SC_NS );
+    }
+};
+
+int
+sc_main( int argc, char* argv[] )
+{
+    top t( "top" );
+
+    sc_trace_file* tf = sc_create_vcd_trace_file( "trace_updates" );
+    sc_trace( tf, t.x, "x" );
+    sc_trace( tf, t.o, "o" );
+    sc_trace( tf, t.in, "in" );
+    sc_trace( tf, t.p, "p" );
+
+    sc_start();
+    sc_close_vcd_trace_file( tf );
+
+    std::ifstream vcd( "trace_updates.vcd" );
+    std::string line;
+    bool changes = false;
+    while( std::getline( vcd, line ) ) {
+        if( changes )
+            std::cout << line << std::endl;
+        else if( line.find( "$enddefinitions" ) != std::string::npos )
+            changes = true;
+    }
+    return 0;
+}
@@ -0,0 +1,262 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  vcd_trace_perf.cpp -- Benchmark of VCD and FST tracing.
+
+                     A number of signals of different types is traced,
+                     a method process changes about half of them in each
+                     clock cycle, or the given percentage of them.
+                     Running the benchmark with and without tracing gives
+                     the cost of the tracing.
+
+                     Usage:
+                       vcd_trace_perf [signals] [cycles] [tracing] [format]
+                                      [activity]
+
+                     The checksum covers the value changes in the VCD file
+                     (the header with the date is excluded). Compressed
+                     files (SC_VCD_COMPRESS) and FST files are not checked.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace sc_core;
+
+// ----------------------------------------------------------------------------
+//  design: signals of different types, driven by one method process
+// ----------------------------------------------------------------------------
+
+SC_MODULE( design )
+{
+    sc_in<bool> clk;
+
+    SC_CTOR( design, unsigned n, unsigned activity )
+      : clk( "clk" ), m_n( n ), m_activity( activity )
+      , m_state( 0x9e3779b97f4a7c15ULL )
+    {
+        for( unsigned i = 0; i < n; ++i ) {
+            switch( i % 5 ) {
+              case 0: m_bits.push_back( new sc_signal<bool>(
+                        sc_gen_unique_name( "bit" ) ) ); break;
+              case 1: m_ints.push_back( new sc_signal<int>(
+                        sc_gen_unique_name( "int" ) ) ); break;
+              case 2: m_uints.push_back( new sc_signal<sc_dt::sc_uint<24> >(
+                        sc_gen_unique_name( "uint" ) ) ); break;
+              case 3: m_bigs.push_back( new sc_signal<sc_dt::sc_biguint<100> >(
+                        sc_gen_unique_name( "big" ) ) ); break;
+              case 4: m_lvs.push_back( new sc_signal<sc_dt::sc_lv<64> >(
+                        sc_gen_unique_name( "lv" ) ) ); break;
+            }
+        }
+
+        SC_METHOD( drive );
+        sensitive << clk.pos();
+        dont_initialize();
+    }
+
+    ~design()
+    {
+        for( unsigned i = 0; i < m_bits.size(); ++i ) delete m_bits[i];
+        for( unsigned i = 0; i < m_ints.size(); ++i ) delete m_ints[i];
+        for( unsigned i = 0; i < m_uints.size(); ++i ) delete m_uints[i];
+        for( unsigned i = 0; i < m_bigs.size(); ++i ) delete m_bigs[i];
+        for( unsigned i = 0; i < m_lvs.size(); ++i ) delete m_lvs[i];
+    }
+
+    void trace( sc_trace_file* tf ) const
+    {
+        for( unsigned i = 0; i < m_bits.size(); ++i )
+            sc_trace( tf, *m_bits[i], m_bits[i]->name() );
+        for( unsigned i = 0; i < m_ints.size(); ++i )
+            sc_trace( tf, *m_ints[i], m_ints[i]->name() );
+        for( unsigned i = 0; i < m_uints.size(); ++i )
+            sc_trace( tf, *m_uints[i], m_uints[i]->name() );
+        for( unsigned i = 0; i < m_bigs.size(); ++i )
+            sc_trace( tf, *m_bigs[i], m_bigs[i]->name() );
+        for( unsigned i = 0; i < m_lvs.size(); ++i )
+            sc_trace( tf, *m_lvs[i], m_lvs[i]->name() );
+    }
+
+    // xorshift64
+    sc_dt::uint64 next()
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 7;
+        m_state ^= m_state << 17;
+        return m_state;
+    }
+
+    // change signal i of all n signals
+    void change( unsigned i )
+    {
+        unsigned k = i / 5;
+        switch( i % 5 ) {
+          case 0: m_bits[k]->write( !m_bits[k]->read() ); break;
+          case 1: m_ints[k]->write( static_cast<int>( next() >> 20 ) ); break;
+          case 2: m_uints[k]->write( next() >> 40 ); break;
+          case 3: m_bigs[k]->write( sc_dt::sc_biguint<100>( next() ) << 36 ); break;
+          case 4: m_lvs[k]->write( sc_dt::sc_lv<64>( next() ) ); break;
+        }
+    }
+
+    void drive()
+    {
+        if( m_activity ) {
+            for( unsigned i = m_n * m_activity / 100; i > 0; --i )
+                change( static_cast<unsigned>( next() % m_n ) );
+            return;
+        }
+
+        for( unsigned i = 0; i < m_bits.size(); ++i )
+            if( next() & 1 )
+                m_bits[i]->write( !m_bits[i]->read() );
+        for( unsigned i = 0; i < m_ints.size(); ++i )
+            if( next() & 1 )
+                m_ints[i]->write( static_cast<int>( m_state >> 20 ) );
+        for( unsigned i = 0; i < m_uints.size(); ++i )
+            if( next() & 1 )
+                m_uints[i]->write( m_state >> 40 );
+        for( unsigned i = 0; i < m_bigs.size(); ++i ) {
+            if( next() & 1 ) {
+                sc_dt::sc_biguint<100> v = m_state;
+                v = ( v << 36 ) | sc_dt::sc_biguint<100>( next() >> 28 );
+                m_bigs[i]->write( v );
+            }
+        }
+        for( unsigned i = 0; i < m_lvs.size(); ++i ) {
+            if( next() & 1 ) {
+                sc_dt::sc_lv<64> v = m_state;
+                if( ( m_state & 0xf0 ) == 0 ) // some unknown bits
+                    v.range( 7, 4 ) = "XXZZ";
+                m_lvs[i]->write( v );
+            }
+        }
+    }
+
+    std::vector<sc_signal<bool>*>                     m_bits;
+    std::vector<sc_signal<int>*>                      m_ints;
+    std::vector<sc_signal<sc_dt::sc_uint<24> >*>      m_uints;
+    std::vector<sc_signal<sc_dt::sc_biguint<100> >*>  m_bigs;
+    std::vector<sc_signal<sc_dt::sc_lv<64> >*>        m_lvs;
+    unsigned                                          m_n;
+    unsigned                                          m_activity;
+    sc_dt::uint64                                     m_state;
+};
+
+// ----------------------------------------------------------------------------
+//  checksum of the value changes in a VCD file (FNV-1a)
+// ----------------------------------------------------------------------------
+
+static sc_dt::uint64
+vcd_checksum( const char* filename, std::size_t& bytes )
+{
+    std::ifstream file( filename, std::ios::binary );
+    std::stringstream ss;
+    ss << file.rdbuf();
+    std::string content = ss.str();
+    bytes = content.size();
+
+    std::size_t pos = content.find( "$enddefinitions" );
+    if( pos == std::string::npos )
+        return 0;
+
+    sc_dt::uint64 hash = 0xcbf29ce484222325ULL;
+    for( ; pos < content.size(); ++pos ) {
+        hash ^= static_cast<unsigned char>( content[pos] );
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+int sc_main( int argc, char* argv[] )
+{
+    unsigned n      = ( argc > 1 ) ? std::atoi( argv[1] ) : 1000;
+    unsigned cycles = ( argc > 2 ) ? std::atoi( argv[2] ) : 200;
+    bool     tracing = ( argc > 3 ) ? std::atoi( argv[3] ) != 0 : true;
+    bool     fst     = ( argc > 4 ) && std::string( argv[4] ) == "fst";
+    unsigned activity = ( argc > 5 ) ? std::atoi( argv[5] ) : 0;
+
+    sc_clock clk( "clk", 10, SC_NS );
+    design   top( "top", n, activity );
+    top.clk( clk );
+
+    sc_trace_file* tf = 0;
+    if( tracing ) {
+        tf = fst ? sc_create_fst_trace_file( "vcd_trace_perf" )
+                 : sc_create_vcd_trace_file( "vcd_trace_perf" );
+        sc_trace( tf, clk, "clk" );
+        top.trace( tf );
+    }
+
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+    sc_start( sc_time( 10.0 * cycles, SC_NS ) );
+    if( tf && fst )
+        sc_close_fst_trace_file( tf );
+    else if( tf )
+        sc_close_vcd_trace_file( tf );
+    std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+    std::cout << n << " signals, " << cycles << " cycles, tracing "
+              << ( tracing ? ( fst ? "fst" : "vcd" ) : "off" ) << ": "
+              << elapsed.count() << " s" << std::endl;
+
+    if( !tracing )
+        return 0;
+
+    std::size_t bytes = 0;
+    if( fst ) {
+        std::ifstream file( "vcd_trace_perf.fst", std::ios::binary );
+        file.seekg( 0, std::ios::end );
+        std::cout << "  " << file.tellg() << " bytes written" << std::endl;
+        std::cout << "fst checksum: not checked" << std::endl;
+        return 0;
+    }
+
+    sc_dt::uint64 checksum = vcd_checksum( "vcd_trace_perf.vcd", bytes );
+    if( std::getenv( "SC_VCD_COMPRESS" ) ) {
+        std::cout << "vcd checksum: not checked (compressed)" << std::endl;
+    } else {
+        std::cout << "  " << bytes << " bytes written" << std::endl;
+        std::cout << "vcd checksum: " << std::hex << checksum << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+//==============================================================================
+/// @file peq_stress_top.h
+//
+/// @brief AT system with thousands of outstanding transactions per target
+//
+/// @details
+///    Two initiators issue read requests as fast as the targets accept them,
+///    through the SimpleBusAT of the at_4_phase example. The targets answer
+///    each request after a random latency of up to some microseconds, so
+///    their payload event queues hold thousands of transactions. The
+///    initiators compute a checksum of the data in the order the responses
+///    arrive, which depends on the order the queues deliver them.
+//
+//==============================================================================
+
+#ifndef __PEQ_STRESS_TOP_H__
+#define __PEQ_STRESS_TOP_H__
+
+#include "tlm.h"                                      // TLM headers
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "tlm_utils/peq_with_cb_and_phase.h"
+#include "tlm_utils/payload_pool.h"
+#include "models/SimpleBusAT.h"                       // Bus/Router Implementation
+
+//==============================================================================
+///  @brief Target, which keeps all open transactions in its PEQ
+//==============================================================================
+class stress_target
+  : public sc_core::sc_module
+{
+public:
+  stress_target
+  ( sc_core::sc_module_name name                    ///< module name
+  , unsigned int            max_latency             ///< response latency (ns)
+  , unsigned int            seed                    ///< latency generator seed
+  );
+
+  tlm_utils::simple_target_socket<stress_target> target_socket;
+
+private:
+  tlm::tlm_sync_enum
+  nb_transport_fw
+  ( tlm::tlm_generic_payload  &payload              ///< transaction
+  , tlm::tlm_phase            &phase                ///< transaction phase
+  , sc_core::sc_time          &delay                ///< annotated delay
+  );
+
+  void
+  peq_callback
+  ( tlm::tlm_generic_payload  &payload              ///< transaction
+  , const tlm::tlm_phase      &phase                ///< phase to process
+  );
+
+  const unsigned int          m_max_latency;        ///< response latency (ns)
+  unsigned int                m_random;             ///< xorshift state
+  const sc_core::sc_time      m_accept_delay;       ///< until END_REQ
+  tlm_utils::peq_with_cb_and_phase<stress_target> m_peq;
+};
+
+//==============================================================================
+///  @brief Initiator, which keeps the request channel busy
+//==============================================================================
+class stress_initiator
+  : public sc_core::sc_module
+{
+public:
+  stress_initiator
+  ( sc_core::sc_module_name name                    ///< module name
+  , unsigned long           transactions            ///< requests to send
+  , unsigned int            seed                    ///< address generator seed
+  );
+
+  unsigned int checksum() const { return m_checksum; }
+  unsigned long responses() const { return m_responses; }
+
+  tlm_utils::simple_initiator_socket<stress_initiator> initiator_socket;
+
+private:
+  void initiator_thread();                          ///< SC_THREAD
+
+  tlm::tlm_sync_enum
+  nb_transport_bw
+  ( tlm::tlm_generic_payload  &payload              ///< transaction
+  , tlm::tlm_phase            &phase                ///< transaction phase
+  , sc_core::sc_time          &delay                ///< annotated delay
+  );
+
+  const unsigned long         m_transactions;       ///< requests to send
+  unsigned int                m_random;             ///< xorshift state
+  unsigned int                m_checksum;           ///< of the data read
+  unsigned long               m_responses;          ///< responses received
+  sc_core::sc_event           m_end_request_event;  ///< END_REQ received
+  tlm_utils::payload_pool     m_pool;               ///< transactions
+};
+
+//==============================================================================
+///  @brief Top level of the PEQ stress benchmark
+//==============================================================================
+class peq_stress_top
+  : public sc_core::sc_module
+{
+public:
+  peq_stress_top
+  ( sc_core::sc_module_name name                    ///< module name
+  , unsigned long           transactions            ///< requests per initiator
+  , unsigned int            max_latency             ///< response latency (ns)
+  );
+
+  void report(std::ostream& os) const;              ///< print the checksum
+
+private:
+  SimpleBusAT<2, 2>           m_bus;                ///< simple bus
+  stress_target               m_target_1;           ///< instance 1 target
+  stress_target               m_target_2;           ///< instance 2 target
+  stress_initiator            m_initiator_1;        ///< instance 1 initiator
+  stress_initiator            m_initiator_2;        ///< instance 2 initiator
+};
+
+#endif /* __PEQ_STRESS_TOP_H__ */
@@ -37,7 +37,55 @@
 
 #include "reporting.h"              // reporting utilities
 #include "at_4_phase_top.h"  		    // top module
+#include "peq_stress_top.h"         // PEQ stress benchmark
 #include "tlm.h"            			  // TLM header
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+//=====================================================================
+///  @fn run_peq_stress
+//
+///  @brief Runs the PEQ stress benchmark and reports the wall clock time
+//
+///  @details
+///    Usage: at_4_phase stress [transactions] [max latency]
+///
+///    Each of the two initiators sends the given number of requests. The
+///    targets respond after up to max latency nanoseconds, so they have
+///    about max latency / 2 transactions in flight each.
+//
+//=====================================================================
+static int
+run_peq_stress
+( int    argc
+, char*  argv[]
+)
+{
+  if (std::strcmp(argv[1], "stress") != 0) {
+    std::cerr << "Usage: " << argv[0]
+              << " [stress [transactions] [max latency (ns)]]" << std::endl;
+    return 1;
+  }
+  unsigned long transactions = (argc > 2) ? std::atol(argv[2]) : 1000000;
+  unsigned int  max_latency  = (argc > 3) ? std::atoi(argv[3]) : 10000;
+  if (max_latency == 0)
+    max_latency = 1;
+
+  peq_stress_top top("top", transactions, max_latency);
+
+  std::chrono::steady_clock::time_point start =
+    std::chrono::steady_clock::now();
+  sc_core::sc_start();
+  std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - start;
+
+  top.report(std::cout);
+  std::cout << transactions << " transactions per initiator, latency up to "
+            << max_latency << " ns: simulated " << sc_core::sc_time_stamp()
+            << " in " << elapsed.count() << " s" << std::endl;
+  return 0;
+}
 
 //=====================================================================
 ///  @fn sc_main
@@ -45,18 +93,22 @@
 ///  @brief SystemC entry point
 //  
 ///  @details
-///    This is the SystemC entry point for the example system.  The argc and argv 
-///    parameters are not used.  Simulation runtime is not specified when 
-///    sc_start() is called, the examples traffic generator will run to 
-///    completion, ending the simulation. 
+///    This is the SystemC entry point for the example system.  Without 
+///    arguments, the example system is simulated.  Simulation runtime is not 
+///    specified when sc_start() is called, the examples traffic 
+///    generator will run to completion, ending the simulation.  With 
+///    arguments, the PEQ stress benchmark is run instead (see run_peq_stress). 
 ///
 //=====================================================================
 int                                     // return status
 sc_main                                 // SystemC entry point
-( int    /*argc*/                       // argument count
-, char*  /*argv*/[]                     // argument vector
+( int    argc                           // argument count
+, char*  argv[]                         // argument vector
 )
 {
+  if (argc > 1)
+    return run_peq_stress(argc, argv);
+
   REPORT_ENABLE_ALL_REPORTING ();
 //  REPORT_DISABLE_INFO_REPORTING ();
   
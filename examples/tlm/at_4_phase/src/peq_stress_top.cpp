@@ -0,0 +1,204 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+//==============================================================================
+/// @file peq_stress_top.cpp
+//
+/// @brief AT system with thousands of outstanding transactions per target
+//
+/// @details
+///    A target accepts each request after its accept delay, and schedules
+///    the response in the same PEQ. The latencies are whole nanoseconds, so
+///    many responses fall on the same time and come out in the order they
+///    were scheduled.
+//
+//==============================================================================
+
+#include "peq_stress_top.h"                          // header for this module
+#include <cstring>
+#include <iomanip>
+
+using namespace sc_core;
+
+//==============================================================================
+//  stress_target
+//==============================================================================
+
+stress_target::stress_target
+( sc_module_name  name
+, unsigned int    max_latency
+, unsigned int    seed
+)
+  : sc_module       (name)
+  , target_socket   ("target_socket")
+  , m_max_latency   (max_latency)
+  , m_random        (seed)
+  , m_accept_delay  (1, SC_NS)
+  , m_peq           ("m_peq", this, &stress_target::peq_callback)
+{
+  target_socket.register_nb_transport_fw(this, &stress_target::nb_transport_fw);
+}
+
+tlm::tlm_sync_enum
+stress_target::nb_transport_fw
+( tlm::tlm_generic_payload  &payload
+, tlm::tlm_phase            &phase
+, sc_time                   &delay
+)
+{
+  if (phase == tlm::END_RESP)
+    return tlm::TLM_COMPLETED;
+
+  m_peq.notify(payload, phase, delay);
+  return tlm::TLM_ACCEPTED;
+}
+
+void
+stress_target::peq_callback
+( tlm::tlm_generic_payload  &payload
+, const tlm::tlm_phase      &phase
+)
+{
+  tlm::tlm_phase  next_phase;
+  sc_time         delay;
+
+  if (phase == tlm::BEGIN_REQ)
+  {
+    // accept the request, and schedule the response behind END_REQ
+    next_phase = tlm::END_REQ;
+    delay = m_accept_delay;
+    target_socket->nb_transport_bw(payload, next_phase, delay);
+
+    m_random ^= m_random << 13;
+    m_random ^= m_random >> 17;
+    m_random ^= m_random << 5;
+    m_peq.notify(payload, tlm::BEGIN_RESP,
+                 m_accept_delay + sc_time(m_random % m_max_latency, SC_NS));
+  }
+  else
+  {
+    unsigned int data =
+      static_cast<unsigned int>(payload.get_address()) * 2654435761u;
+    std::memcpy(payload.get_data_ptr(), &data, sizeof(data));
+    payload.set_response_status(tlm::TLM_OK_RESPONSE);
+
+    next_phase = tlm::BEGIN_RESP;
+    delay = SC_ZERO_TIME;
+    target_socket->nb_transport_bw(payload, next_phase, delay);
+  }
+}
+
+//==============================================================================
+//  stress_initiator
+//==============================================================================
+
+stress_initiator::stress_initiator
+( sc_module_name  name
+, unsigned long   transactions
+, unsigned int    seed
+)
+  : sc_module         (name)
+  , initiator_socket  ("initiator_socket")
+  , m_transactions    (transactions)
+  , m_random          (seed)
+  , m_checksum        (0)
+  , m_responses       (0)
+{
+  initiator_socket.register_nb_transport_bw
+    (this, &stress_initiator::nb_transport_bw);
+
+  SC_THREAD(initiator_thread);
+}
+
+void
+stress_initiator::initiator_thread()
+{
+  for (unsigned long i = 0; i < m_transactions; ++i)
+  {
+    m_random ^= m_random << 13;
+    m_random ^= m_random >> 17;
+    m_random ^= m_random << 5;
+
+    // a word in one of the targets
+    tlm::tlm_generic_payload* payload = m_pool.allocate(4);
+    payload->acquire();
+    payload->set_read();
+    payload->set_address(m_random & 0x10000ffc);
+
+    tlm::tlm_phase  phase = tlm::BEGIN_REQ;
+    sc_time         delay = SC_ZERO_TIME;
+    initiator_socket->nb_transport_fw(*payload, phase, delay);
+
+    wait(m_end_request_event);
+  }
+}
+
+tlm::tlm_sync_enum
+stress_initiator::nb_transport_bw
+( tlm::tlm_generic_payload  &payload
+, tlm::tlm_phase            &phase
+, sc_time                   &delay
+)
+{
+  if (phase == tlm::END_REQ)
+  {
+    m_end_request_event.notify(delay);
+    return tlm::TLM_ACCEPTED;
+  }
+
+  unsigned int data;
+  std::memcpy(&data, payload.get_data_ptr(), sizeof(data));
+  m_checksum = m_checksum * 31 + data;
+  ++m_responses;
+  payload.release();
+  return tlm::TLM_COMPLETED;
+}
+
+//==============================================================================
+//  peq_stress_top
+//==============================================================================
+
+peq_stress_top::peq_stress_top
+( sc_module_name  name
+, unsigned long   transactions
+, unsigned int    max_latency
+)
+  : sc_module      (name)
+  , m_bus          ("m_bus")
+  , m_target_1     ("m_target_1", max_latency, 0x2545f491)
+  , m_target_2     ("m_target_2", max_latency, 0x9e3779b9)
+  , m_initiator_1  ("m_initiator_1", transactions, 0x12345678)
+  , m_initiator_2  ("m_initiator_2", transactions, 0x87654321)
+{
+  m_initiator_1.initiator_socket(m_bus.target_socket[0]);
+  m_initiator_2.initiator_socket(m_bus.target_socket[1]);
+  m_bus.initiator_socket[0](m_target_1.target_socket);
+  m_bus.initiator_socket[1](m_target_2.target_socket);
+}
+
+void
+peq_stress_top::report(std::ostream& os) const
+{
+  os << "checksums: 0x" << std::hex << std::setfill('0')
+     << std::setw(8) << m_initiator_1.checksum() << " 0x"
+     << std::setw(8) << m_initiator_2.checksum()
+     << std::dec << std::setfill(' ') << ", "
+     << m_initiator_1.responses() + m_initiator_2.responses()
+     << " responses" << std::endl;
+}
@@ -46,6 +46,7 @@ public:
   {
     for (unsigned int i = 0; i < NR_OF_INITIATORS; ++i) {
       target_socket[i].register_b_transport(this, &SimpleBusLT::initiatorBTransport, i);
+      target_socket[i].register_b_transport_batch(this, &SimpleBusLT::initiatorBTransportBatch, i);
       target_socket[i].register_transport_dbg(this, &SimpleBusLT::transportDebug, i);
       target_socket[i].register_get_direct_mem_ptr(this, &SimpleBusLT::getDMIPointer, i);
     }
@@ -104,6 +105,29 @@ public:
     (*decodeSocket)->b_transport(trans, t);
   }
 
+  //
+  // - forward each run of transactions to the same target as one batch
+  //
+  void initiatorBTransportBatch(int /*SocketId*/,
+                                transaction_type** trans,
+                                std::size_t n,
+                                sc_core::sc_time& t)
+  {
+    std::size_t first = 0;
+    while (first < n) {
+      unsigned int portId = decode(trans[first]->get_address());
+      assert(portId < NR_OF_TARGETS);
+      std::size_t last = first;
+      do {
+        trans[last]->set_address(trans[last]->get_address() & getAddressMask(portId));
+        ++last;
+      } while (last < n && decode(trans[last]->get_address()) == portId);
+
+      initiator_socket[portId]->b_transport_batch(trans + first, last - first, t);
+      first = last;
+    }
+  }
+
   unsigned int transportDebug(int /*SocketId*/,
                               transaction_type& trans)
   {
@@ -0,0 +1,141 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+//==============================================================================
+/// @file burst_top.h
+//
+/// @brief Cache line traffic through the LT bus, one by one or in batches
+//
+/// @details
+///    An initiator copies cache lines between two memories behind a
+///    SimpleBusLT. Each burst of consecutive cache lines is either sent as
+///    single b_transport calls, or with one b_transport_batch call, which
+///    the bus decodes once per run of lines to the same memory. The
+///    checksum and the simulated time do not depend on the mode.
+//
+//==============================================================================
+
+#ifndef __BURST_TOP_H__
+#define __BURST_TOP_H__
+
+#include "tlm.h"                                      // TLM headers
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "tlm_utils/payload_pool.h"
+#include "tlm_utils/tlm_quantumkeeper.h"
+#include "models/SimpleBusLT.h"                       // Bus/Router Implementation
+#include <vector>
+
+//==============================================================================
+///  @brief Memory with a blocking and a batch transport callback
+//==============================================================================
+class burst_memory
+  : public sc_core::sc_module
+{
+public:
+  burst_memory
+  ( sc_core::sc_module_name name                    ///< module name
+  , unsigned int            size                    ///< memory size (bytes)
+  );
+
+  tlm_utils::simple_target_socket<burst_memory> target_socket;
+
+private:
+  void
+  custom_b_transport
+  ( tlm::tlm_generic_payload  &payload              ///< transaction
+  , sc_core::sc_time          &delay                ///< annotated delay
+  );
+
+  void
+  custom_b_transport_batch
+  ( tlm::tlm_generic_payload  **payloads            ///< transactions
+  , std::size_t               n                     ///< number of transactions
+  , sc_core::sc_time          &delay                ///< annotated delay
+  );
+
+  void access(tlm::tlm_generic_payload &payload);
+
+  std::vector<unsigned char>  m_memory;             ///< memory contents
+  const sc_core::sc_time      m_access_delay;       ///< delay per access
+};
+
+//==============================================================================
+///  @brief Initiator, which copies bursts of cache lines
+//==============================================================================
+class burst_initiator
+  : public sc_core::sc_module
+{
+public:
+  burst_initiator
+  ( sc_core::sc_module_name name                    ///< module name
+  , bool                    batch                   ///< use b_transport_batch
+  , unsigned long           lines                   ///< cache lines to copy
+  , unsigned int            burst_length            ///< lines per burst
+  , sc_dt::uint64           source                  ///< source base address
+  , sc_dt::uint64           destination             ///< destination address
+  , unsigned int            size                    ///< memory size (bytes)
+  );
+
+  unsigned int checksum() const { return m_checksum; }
+  unsigned int errors() const { return m_errors; }
+
+  tlm_utils::simple_initiator_socket<burst_initiator> initiator_socket;
+
+private:
+  void initiator_thread();                          ///< SC_THREAD
+  void transport(std::size_t n);                    ///< send m_payloads[0..n)
+
+  const bool                  m_batch;              ///< use b_transport_batch
+  const unsigned long         m_lines;              ///< cache lines to copy
+  const unsigned int          m_burst_length;       ///< lines per burst
+  const sc_dt::uint64         m_source;             ///< source base address
+  const sc_dt::uint64         m_destination;        ///< destination address
+  const unsigned int          m_size;               ///< memory size (bytes)
+  unsigned int                m_checksum;           ///< of the data read
+  unsigned int                m_errors;             ///< failed accesses
+  tlm_utils::payload_pool     m_pool;               ///< transactions
+  std::vector<tlm::tlm_generic_payload*> m_payloads; ///< current burst
+  tlm_utils::tlm_quantumkeeper m_quantum_keeper;
+};
+
+//==============================================================================
+///  @brief Top level of the burst benchmark
+//==============================================================================
+class burst_top
+  : public sc_core::sc_module
+{
+public:
+  burst_top
+  ( sc_core::sc_module_name name                    ///< module name
+  , bool                    batch                   ///< use b_transport_batch
+  , unsigned long           lines                   ///< cache lines to copy
+  , unsigned int            burst_length            ///< lines per burst
+  );
+
+  void report(std::ostream& os) const;              ///< print the checksum
+
+private:
+  SimpleBusLT<1, 2>           m_bus;                ///< simple bus
+  burst_memory                m_memory_1;           ///< source
+  burst_memory                m_memory_2;           ///< destination
+  burst_initiator             m_initiator;          ///< copying initiator
+};
+
+#endif /* __BURST_TOP_H__ */
@@ -0,0 +1,243 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+//==============================================================================
+/// @file burst_top.cpp
+//
+/// @brief Cache line traffic through the LT bus, one by one or in batches
+//
+/// @details
+///    Each burst reads a number of cache lines from the first memory and
+///    writes them to the second one. All transactions of a burst go into
+///    one b_transport_batch call in the batch mode; the bus splits it into
+///    one batch per memory.
+//
+//==============================================================================
+
+#include "burst_top.h"                               // header for this module
+#include <cstring>
+#include <iomanip>
+
+using namespace sc_core;
+
+static const unsigned int line_size = 64;           ///< bytes per cache line
+
+//==============================================================================
+//  burst_memory
+//==============================================================================
+
+burst_memory::burst_memory
+( sc_module_name  name
+, unsigned int    size
+)
+  : sc_module       (name)
+  , target_socket   ("target_socket")
+  , m_memory        (size)
+  , m_access_delay  (10, SC_NS)
+{
+  for (unsigned int i = 0; i < size; ++i)
+    m_memory[i] = static_cast<unsigned char>((i * 2654435761u) >> 24);
+
+  target_socket.register_b_transport(this, &burst_memory::custom_b_transport);
+  target_socket.register_b_transport_batch
+    (this, &burst_memory::custom_b_transport_batch);
+}
+
+void
+burst_memory::custom_b_transport
+( tlm::tlm_generic_payload  &payload
+, sc_time                   &delay
+)
+{
+  access(payload);
+  delay += m_access_delay;
+}
+
+void
+burst_memory::custom_b_transport_batch
+( tlm::tlm_generic_payload  **payloads
+, std::size_t               n
+, sc_time                   &delay
+)
+{
+  for (std::size_t i = 0; i < n; ++i)
+    access(*payloads[i]);
+  delay += static_cast<double>(n) * m_access_delay;
+}
+
+void
+burst_memory::access
+( tlm::tlm_generic_payload  &payload
+)
+{
+  sc_dt::uint64 address = payload.get_address();
+  unsigned int  length  = payload.get_data_length();
+
+  if (  address >= m_memory.size()
+     || length > m_memory.size() - address
+     || payload.get_byte_enable_ptr() )
+  {
+    payload.set_response_status(tlm::TLM_ADDRESS_ERROR_RESPONSE);
+    return;
+  }
+
+  if (payload.is_read())
+    std::memcpy(payload.get_data_ptr(), &m_memory[address], length);
+  else
+    std::memcpy(&m_memory[address], payload.get_data_ptr(), length);
+
+  payload.set_response_status(tlm::TLM_OK_RESPONSE);
+}
+
+//==============================================================================
+//  burst_initiator
+//==============================================================================
+
+burst_initiator::burst_initiator
+( sc_module_name  name
+, bool            batch
+, unsigned long   lines
+, unsigned int    burst_length
+, sc_dt::uint64   source
+, sc_dt::uint64   destination
+, unsigned int    size
+)
+  : sc_module         (name)
+  , initiator_socket  ("initiator_socket")
+  , m_batch           (batch)
+  , m_lines           (lines)
+  , m_burst_length    (burst_length)
+  , m_source          (source)
+  , m_destination     (destination)
+  , m_size            (size)
+  , m_checksum        (0)
+  , m_errors          (0)
+  , m_pool            (2 * burst_length)
+  , m_payloads        (2 * burst_length)
+{
+  SC_THREAD(initiator_thread);
+}
+
+void
+burst_initiator::initiator_thread()
+{
+  m_quantum_keeper.reset();
+
+  for (unsigned long line = 0; line < m_lines; line += m_burst_length)
+  {
+    std::size_t burst = m_burst_length;
+    if (burst > m_lines - line)
+      burst = m_lines - line;
+
+    // read the lines, then write them from the same buffers
+    for (std::size_t i = 0; i < burst; ++i)
+    {
+      sc_dt::uint64 offset = ((line + i) * line_size) % m_size;
+
+      tlm::tlm_generic_payload* read = m_pool.allocate(line_size);
+      read->acquire();
+      read->set_read();
+      read->set_address(m_source + offset);
+      m_payloads[i] = read;
+
+      tlm::tlm_generic_payload* write = m_pool.allocate();
+      write->acquire();
+      write->set_write();
+      write->set_address(m_destination + offset);
+      write->set_data_ptr(read->get_data_ptr());
+      write->set_data_length(line_size);
+      write->set_streaming_width(line_size);
+      m_payloads[burst + i] = write;
+    }
+
+    transport(2 * burst);
+
+    for (std::size_t i = 0; i < 2 * burst; ++i)
+    {
+      tlm::tlm_generic_payload* payload = m_payloads[i];
+      if (payload->is_response_error())
+        ++m_errors;
+      else if (payload->is_read())
+      {
+        unsigned int word;
+        for (unsigned int j = 0; j < line_size; j += 4)
+        {
+          std::memcpy(&word, payload->get_data_ptr() + j, 4);
+          m_checksum = m_checksum * 31 + word;
+        }
+      }
+      payload->release();
+    }
+
+    if (m_quantum_keeper.need_sync())
+      m_quantum_keeper.sync();
+  }
+
+  m_quantum_keeper.sync();                    // consume the local time
+}
+
+void
+burst_initiator::transport
+( std::size_t n
+)
+{
+  sc_time delay = m_quantum_keeper.get_local_time();
+
+  if (m_batch)
+    initiator_socket->b_transport_batch(&m_payloads[0], n, delay);
+  else
+    for (std::size_t i = 0; i < n; ++i)
+      initiator_socket->b_transport(*m_payloads[i], delay);
+
+  m_quantum_keeper.set(delay);
+}
+
+//==============================================================================
+//  burst_top
+//==============================================================================
+
+static const unsigned int memory_size = 1 << 20;    ///< bytes per memory
+
+burst_top::burst_top
+( sc_module_name  name
+, bool            batch
+, unsigned long   lines
+, unsigned int    burst_length
+)
+  : sc_module    (name)
+  , m_bus        ("m_bus")
+  , m_memory_1   ("m_memory_1", memory_size)
+  , m_memory_2   ("m_memory_2", memory_size)
+  , m_initiator  ("m_initiator", batch, lines, burst_length,
+                  0x00000000, 0x10000000, memory_size)
+{
+  m_initiator.initiator_socket(m_bus.target_socket[0]);
+  m_bus.initiator_socket[0](m_memory_1.target_socket);
+  m_bus.initiator_socket[1](m_memory_2.target_socket);
+}
+
+void
+burst_top::report(std::ostream& os) const
+{
+  os << "checksum: 0x" << std::hex << std::setw(8) << std::setfill('0')
+     << m_initiator.checksum() << std::dec << std::setfill(' ');
+  if (m_initiator.errors())
+    os << " (" << m_initiator.errors() << " failed accesses)";
+  os << std::endl;
+}
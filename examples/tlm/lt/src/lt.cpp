@@ -18,19 +18,74 @@
  *****************************************************************************/
 
 #include "lt_top.h"                     // top module
+#include "burst_top.h"                  // burst benchmark
 #include "tlm.h"                        // TLM header
 #define REPORT_DEFINE_GLOBALS           // reporting overhead
 #include "reporting.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+//==============================================================================
+///  @fn run_burst
+//
+///  @brief Runs the burst benchmark and reports the wall clock time
+//
+///  @details
+///    Usage: lt single|batch [lines] [burst length]
+///
+///    The bursts of cache lines are sent as single b_transport calls or as
+///    one b_transport_batch call each. The checksum and the simulated time
+///    are the same in both modes.
+//
+//==============================================================================
+static int
+run_burst
+  (int   argc
+  ,char* argv[]
+)
+{
+  bool batch;
+  if      (std::strcmp(argv[1], "single") == 0) batch = false;
+  else if (std::strcmp(argv[1], "batch")  == 0) batch = true;
+  else {
+    std::cerr << "Usage: " << argv[0]
+              << " [single|batch [lines] [burst length]]" << std::endl;
+    return 1;
+  }
+  unsigned long lines        = (argc > 2) ? std::atol(argv[2]) : 4000000;
+  unsigned int  burst_length = (argc > 3) ? std::atoi(argv[3]) : 16;
+  if (burst_length == 0)
+    burst_length = 1;
+
+  tlm_utils::tlm_quantumkeeper::set_global_quantum
+    (sc_core::sc_time(1, sc_core::SC_US));
+  burst_top top("top", batch, lines, burst_length);
+
+  std::chrono::steady_clock::time_point start =
+    std::chrono::steady_clock::now();
+  sc_core::sc_start();
+  std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - start;
+
+  top.report(std::cout);
+  std::cout << lines << " lines, bursts of " << burst_length << ", "
+            << argv[1] << ": simulated " << sc_core::sc_time_stamp()
+            << " in " << elapsed.count() << " s" << std::endl;
+  return 0;
+}
+
 //==============================================================================
 ///  @fn sc_main
 //  
 ///  @brief sc_main for lt with dmi example
 //  
 ///  @details
-///    This is the SystemC entry point for an example system.  The argc and argv 
-///    parameters are not used.  Simulation runtime is not specified when 
-///    sc_start() is called, the example traffic generator will run to 
-///    completion, ending the simulation. 
+///    This is the SystemC entry point for an example system.  Without
+///    arguments, the example system is simulated.  Simulation runtime is not
+///    specified when sc_start() is called, the example traffic generator
+///    will run to completion, ending the simulation.  With arguments, the
+///    burst benchmark is run instead (see run_burst).
 //
 //==============================================================================
 //
@@ -42,10 +97,13 @@
 //==============================================================================
 int                                     // return status
 sc_main                                 // SystemC entry point
-  (int   /*argc*/                       // argument count
-  ,char* /*argv*/[]                     // argument vector
+  (int   argc                           // argument count
+  ,char* argv[]                         // argument vector
 )
 {
+  if (argc > 1)
+    return run_burst(argc, argv);
+
   REPORT_ENABLE_ALL_REPORTING ();
   lt_top top("top");                    // instantiate a exmaple top module
 
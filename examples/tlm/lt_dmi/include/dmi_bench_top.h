@@ -0,0 +1,139 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+//==============================================================================
+/// @file dmi_bench_top.h
+//
+/// @brief Memory traffic of an LT initiator with and without DMI
+//
+/// @details
+///    An initiator makes word accesses to two memories behind a
+///    SimpleBusLT, either with b_transport only or through a
+///    tlm_utils::dmi_cache. The memories invalidate their DMI regions from
+///    time to time. The checksum and the simulated time do not depend on
+///    the mode.
+//
+//==============================================================================
+
+#ifndef __DMI_BENCH_TOP_H__
+#define __DMI_BENCH_TOP_H__
+
+#include "tlm.h"                                      // TLM headers
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "tlm_utils/dmi_cache.h"
+#include "tlm_utils/tlm_quantumkeeper.h"
+#include "models/SimpleBusLT.h"                       // Bus/Router Implementation
+#include <vector>
+
+//==============================================================================
+///  @brief Memory, which grants DMI and revokes it periodically
+//==============================================================================
+class bench_memory
+  : public sc_core::sc_module
+{
+public:
+  bench_memory
+  ( sc_core::sc_module_name name                    ///< module name
+  , unsigned int            size                    ///< memory size (bytes)
+  );
+
+  tlm_utils::simple_target_socket<bench_memory> target_socket;
+
+private:
+  void
+  custom_b_transport
+  ( tlm::tlm_generic_payload  &payload              ///< transaction
+  , sc_core::sc_time          &delay                ///< annotated delay
+  );
+
+  bool
+  get_direct_mem_ptr
+  ( tlm::tlm_generic_payload  &payload              ///< transaction
+  , tlm::tlm_dmi              &dmi_data             ///< DMI region
+  );
+
+  void invalidate_thread();                         ///< SC_THREAD
+
+  std::vector<unsigned char>  m_memory;             ///< memory contents
+  const sc_core::sc_time      m_access_delay;       ///< delay per access
+  const sc_core::sc_time      m_invalidate_period;  ///< DMI revocation period
+};
+
+//==============================================================================
+///  @brief Initiator with an instruction set simulator like access stream
+//==============================================================================
+class bench_initiator
+  : public sc_core::sc_module
+{
+public:
+  bench_initiator
+  ( sc_core::sc_module_name name                    ///< module name
+  , bool                    dmi                     ///< use the DMI cache
+  , unsigned long           accesses                ///< accesses to make
+  , unsigned int            size                    ///< memory size (bytes)
+  );
+
+  unsigned int checksum() const { return m_checksum; }
+
+  tlm_utils::simple_initiator_socket<bench_initiator> initiator_socket;
+
+private:
+  void initiator_thread();                          ///< SC_THREAD
+  unsigned int read(sc_dt::uint64 address);
+  void write(sc_dt::uint64 address, unsigned int data);
+
+  void
+  invalidate_direct_mem_ptr
+  ( sc_dt::uint64             start_range           ///< first address
+  , sc_dt::uint64             end_range             ///< last address
+  );
+
+  const bool                  m_dmi;                ///< use the DMI cache
+  const unsigned long         m_accesses;           ///< accesses to make
+  const unsigned int          m_size;               ///< memory size (bytes)
+  unsigned int                m_checksum;           ///< of the data read
+  tlm::tlm_generic_payload    m_payload;            ///< reused transaction
+  tlm_utils::tlm_quantumkeeper m_quantum_keeper;
+  tlm_utils::dmi_cache<>      m_dmi_cache;          ///< DMI regions
+};
+
+//==============================================================================
+///  @brief Top level of the DMI benchmark
+//==============================================================================
+class dmi_bench_top
+  : public sc_core::sc_module
+{
+public:
+  dmi_bench_top
+  ( sc_core::sc_module_name name                    ///< module name
+  , bool                    dmi                     ///< use the DMI cache
+  , unsigned long           accesses                ///< accesses to make
+  );
+
+  void report(std::ostream& os) const;              ///< print the checksum
+
+private:
+  SimpleBusLT<1, 2>           m_bus;                ///< simple bus
+  bench_memory                m_memory_1;           ///< first memory
+  bench_memory                m_memory_2;           ///< second memory
+  bench_initiator             m_initiator;          ///< accessing initiator
+};
+
+#endif /* __DMI_BENCH_TOP_H__ */
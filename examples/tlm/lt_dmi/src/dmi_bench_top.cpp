@@ -0,0 +1,253 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+//==============================================================================
+/// @file dmi_bench_top.cpp
+//
+/// @brief Memory traffic of an LT initiator with and without DMI
+//
+/// @details
+///    The DMI latency of the memories equals the delay they annotate in
+///    b_transport, so the initiator ends at the same simulated time in both
+///    modes. It stops the simulation, as the memories keep revoking DMI.
+//
+//==============================================================================
+
+#include "dmi_bench_top.h"                           // header for this module
+#include <cstring>
+#include <iomanip>
+
+using namespace sc_core;
+
+//==============================================================================
+//  bench_memory
+//==============================================================================
+
+bench_memory::bench_memory
+( sc_module_name  name
+, unsigned int    size
+)
+  : sc_module           (name)
+  , target_socket       ("target_socket")
+  , m_memory            (size)
+  , m_access_delay      (10, SC_NS)
+  , m_invalidate_period (100, SC_US)
+{
+  for (unsigned int i = 0; i < size; ++i)
+    m_memory[i] = static_cast<unsigned char>((i * 2654435761u) >> 24);
+
+  target_socket.register_b_transport(this, &bench_memory::custom_b_transport);
+  target_socket.register_get_direct_mem_ptr
+    (this, &bench_memory::get_direct_mem_ptr);
+
+  SC_THREAD(invalidate_thread);
+}
+
+void
+bench_memory::custom_b_transport
+( tlm::tlm_generic_payload  &payload
+, sc_time                   &delay
+)
+{
+  sc_dt::uint64 address = payload.get_address();
+  unsigned int  length  = payload.get_data_length();
+
+  if (  address >= m_memory.size()
+     || length > m_memory.size() - address
+     || payload.get_byte_enable_ptr() )
+  {
+    payload.set_response_status(tlm::TLM_ADDRESS_ERROR_RESPONSE);
+    return;
+  }
+
+  if (payload.is_read())
+    std::memcpy(payload.get_data_ptr(), &m_memory[address], length);
+  else
+    std::memcpy(&m_memory[address], payload.get_data_ptr(), length);
+
+  delay += m_access_delay;
+  payload.set_dmi_allowed(true);
+  payload.set_response_status(tlm::TLM_OK_RESPONSE);
+}
+
+bool
+bench_memory::get_direct_mem_ptr
+( tlm::tlm_generic_payload  &/*payload*/
+, tlm::tlm_dmi              &dmi_data
+)
+{
+  dmi_data.set_dmi_ptr(&m_memory[0]);
+  dmi_data.set_start_address(0);
+  dmi_data.set_end_address(m_memory.size() - 1);
+  dmi_data.set_read_latency(m_access_delay);
+  dmi_data.set_write_latency(m_access_delay);
+  dmi_data.allow_read_write();
+  return true;
+}
+
+/// Revokes the DMI region, as if the memory was remapped
+void
+bench_memory::invalidate_thread()
+{
+  for (;;)
+  {
+    wait(m_invalidate_period);
+    target_socket->invalidate_direct_mem_ptr(0, m_memory.size() - 1);
+  }
+}
+
+//==============================================================================
+//  bench_initiator
+//==============================================================================
+
+bench_initiator::bench_initiator
+( sc_module_name  name
+, bool            dmi
+, unsigned long   accesses
+, unsigned int    size
+)
+  : sc_module         (name)
+  , initiator_socket  ("initiator_socket")
+  , m_dmi             (dmi)
+  , m_accesses        (accesses)
+  , m_size            (size)
+  , m_checksum        (0)
+  , m_dmi_cache       (initiator_socket, m_quantum_keeper)
+{
+  initiator_socket.register_invalidate_direct_mem_ptr
+    (this, &bench_initiator::invalidate_direct_mem_ptr);
+
+  SC_THREAD(initiator_thread);
+}
+
+void
+bench_initiator::initiator_thread()
+{
+  m_quantum_keeper.reset();
+
+  unsigned int r = 0x12345678u;
+  for (unsigned long i = 0; i < m_accesses; ++i)
+  {
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+
+    // a word in one of the memories, every fourth access is a write
+    sc_dt::uint64 address = (r >> 2) % (m_size / 4) * 4;
+    if (address >= m_size / 2)
+      address += 0x10000000 - m_size / 2;
+
+    if ((i & 3) == 3)
+      write(address, r);
+    else
+      m_checksum = m_checksum * 31 + read(address);
+  }
+
+  m_quantum_keeper.sync();                    // consume the local time
+  sc_stop();
+}
+
+unsigned int
+bench_initiator::read
+( sc_dt::uint64 address
+)
+{
+  if (m_dmi)
+    return m_dmi_cache.read<unsigned int>(address);
+
+  unsigned int data;
+  m_payload.set_read();
+  m_payload.set_address(address);
+  m_payload.set_data_ptr(reinterpret_cast<unsigned char*>(&data));
+  m_payload.set_data_length(4);
+  m_payload.set_streaming_width(4);
+  m_payload.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+
+  sc_time delay = m_quantum_keeper.get_local_time();
+  initiator_socket->b_transport(m_payload, delay);
+  m_quantum_keeper.set(delay);
+  if (m_quantum_keeper.need_sync())
+    m_quantum_keeper.sync();
+
+  return m_payload.is_response_ok() ? data : 0;
+}
+
+void
+bench_initiator::write
+( sc_dt::uint64 address
+, unsigned int  data
+)
+{
+  if (m_dmi)
+  {
+    m_dmi_cache.write(address, data);
+    return;
+  }
+
+  m_payload.set_write();
+  m_payload.set_address(address);
+  m_payload.set_data_ptr(reinterpret_cast<unsigned char*>(&data));
+  m_payload.set_data_length(4);
+  m_payload.set_streaming_width(4);
+  m_payload.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+
+  sc_time delay = m_quantum_keeper.get_local_time();
+  initiator_socket->b_transport(m_payload, delay);
+  m_quantum_keeper.set(delay);
+  if (m_quantum_keeper.need_sync())
+    m_quantum_keeper.sync();
+}
+
+void
+bench_initiator::invalidate_direct_mem_ptr
+( sc_dt::uint64 start_range
+, sc_dt::uint64 end_range
+)
+{
+  m_dmi_cache.invalidate(start_range, end_range);
+}
+
+//==============================================================================
+//  dmi_bench_top
+//==============================================================================
+
+static const unsigned int memory_size = 1 << 20;    ///< bytes per memory
+
+dmi_bench_top::dmi_bench_top
+( sc_module_name  name
+, bool            dmi
+, unsigned long   accesses
+)
+  : sc_module    (name)
+  , m_bus        ("m_bus")
+  , m_memory_1   ("m_memory_1", memory_size)
+  , m_memory_2   ("m_memory_2", memory_size)
+  , m_initiator  ("m_initiator", dmi, accesses, 2 * memory_size)
+{
+  m_initiator.initiator_socket(m_bus.target_socket[0]);
+  m_bus.initiator_socket[0](m_memory_1.target_socket);
+  m_bus.initiator_socket[1](m_memory_2.target_socket);
+}
+
+void
+dmi_bench_top::report(std::ostream& os) const
+{
+  os << "checksum: 0x" << std::hex << std::setw(8) << std::setfill('0')
+     << m_initiator.checksum() << std::dec << std::setfill(' ') << std::endl;
+}
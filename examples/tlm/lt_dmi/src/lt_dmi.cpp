@@ -18,9 +18,60 @@
  *****************************************************************************/
 
 #include "lt_dmi_top.h"                 // top module
+#include "dmi_bench_top.h"              // DMI benchmark
 #include "tlm.h"                        // TLM header
 #define REPORT_DEFINE_GLOBALS           // reporting overhead
 #include "reporting.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+//==============================================================================
+///  @fn run_dmi_bench
+//
+///  @brief Runs the DMI benchmark and reports the wall clock time
+//
+///  @details
+///    Usage: lt_dmi transport|dmi [accesses]
+///
+///    The initiator accesses the memories with b_transport only, or through
+///    a tlm_utils::dmi_cache. The checksum and the simulated time are the
+///    same in both modes.
+//
+//==============================================================================
+static int
+run_dmi_bench
+  (int   argc
+  ,char* argv[]
+)
+{
+  bool dmi;
+  if      (std::strcmp(argv[1], "transport") == 0) dmi = false;
+  else if (std::strcmp(argv[1], "dmi")       == 0) dmi = true;
+  else {
+    std::cerr << "Usage: " << argv[0]
+              << " [transport|dmi [accesses]]" << std::endl;
+    return 1;
+  }
+  unsigned long accesses = (argc > 2) ? std::atol(argv[2]) : 20000000;
+
+  tlm_utils::tlm_quantumkeeper::set_global_quantum
+    (sc_core::sc_time(1, sc_core::SC_US));
+  dmi_bench_top top("top", dmi, accesses);
+
+  std::chrono::steady_clock::time_point start =
+    std::chrono::steady_clock::now();
+  sc_core::sc_start();
+  std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - start;
+
+  top.report(std::cout);
+  std::cout << accesses << " accesses, " << argv[1] << ": simulated "
+            << sc_core::sc_time_stamp() << " in " << elapsed.count()
+            << " s" << std::endl;
+  return 0;
+}
+
 
 //==============================================================================
 ///  @fn sc_main
@@ -28,10 +79,11 @@
 ///  @brief sc_main for lt example
 //  
 ///  @details
-///    This is the SystemC entry point for an example system.  The argc and argv 
-///    parameters are not used.  Simulation runtime is not specified when 
-///    sc_start() is called, the example traffic generator will run to 
-///    completion, ending the simulation. 
+///    This is the SystemC entry point for an example system.  Without
+///    arguments, the example system is simulated.  Simulation runtime is not
+///    specified when sc_start() is called, the example traffic generator
+///    will run to completion, ending the simulation.  With arguments, the
+///    DMI benchmark is run instead (see run_dmi_bench).
 //
 //==============================================================================
 //
@@ -43,10 +95,13 @@
 //==============================================================================
 int                                     // return status
 sc_main                                 // SystemC entry point
-  (int   /*argc*/                       // argument count
-  ,char* /*argv*/[]                     // argument vector
+  (int   argc                           // argument count
+  ,char* argv[]                         // argument vector
 )
 {
+  if (argc > 1)
+    return run_dmi_bench(argc, argv);
+
   REPORT_ENABLE_ALL_REPORTING ();
   
   lt_dmi_top top("top");                // instantiate a exmaple top module
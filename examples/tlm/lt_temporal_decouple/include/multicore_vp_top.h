@@ -0,0 +1,135 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+//==============================================================================
+/// @file multicore_vp_top.h
+//
+/// @brief Multi-core platform with temporally decoupled CPUs
+//
+/// @details
+///    A number of CPU models, which execute a synthetic instruction stream,
+///    share a memory. Each CPU is temporally decoupled with a
+///    tlm_parallel_quantumkeeper, depending on the mode it executes its
+///    quanta on the SystemC thread (sequential) or on a host thread of its
+///    own (parallel, locked). The per-CPU checksums do not depend on the mode.
+//
+//==============================================================================
+
+#ifndef __MULTICORE_VP_TOP_H__
+#define __MULTICORE_VP_TOP_H__
+
+#include "tlm.h"                                      // TLM headers
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/multi_passthrough_target_socket.h"
+#include "tlm_utils/tlm_parallel_quantumkeeper.h"
+#include <vector>
+
+/// How the CPUs execute their quanta
+enum vp_mode
+{ VP_SEQUENTIAL          ///< on the SystemC thread of the CPU
+, VP_PARALLEL            ///< on a host thread, b_transport by the SC_THREAD
+, VP_LOCKED              ///< on a host thread, b_transport under a lock
+};
+
+//==============================================================================
+///  @brief Memory shared by all CPUs
+//==============================================================================
+class vp_memory
+  : public sc_core::sc_module
+{
+public:
+  vp_memory
+  ( sc_core::sc_module_name name                    ///< module name
+  , unsigned int            size                    ///< memory size (words)
+  );
+
+  tlm_utils::multi_passthrough_target_socket<vp_memory> target_socket;
+
+private:
+  void
+  custom_b_transport
+  ( int                       id                    ///< socket index
+  , tlm::tlm_generic_payload  &payload              ///< transaction
+  , sc_core::sc_time          &delay                ///< annotated delay
+  );
+
+  std::vector<unsigned int>   m_memory;             ///< memory contents
+  const sc_core::sc_time      m_access_delay;       ///< delay per access
+};
+
+//==============================================================================
+///  @brief CPU model with an instruction set simulator like main loop
+//==============================================================================
+class vp_cpu
+  : public sc_core::sc_module
+{
+public:
+  vp_cpu
+  ( sc_core::sc_module_name name                    ///< module name
+  , unsigned int            ID                      ///< CPU ID
+  , vp_mode                 mode                    ///< execution mode
+  , unsigned long           instructions            ///< instructions to run
+  , sc_dt::uint64           base_address            ///< private memory region
+  , unsigned int            region_size             ///< region size (words)
+  );
+
+  unsigned int checksum() const { return m_checksum; }
+  unsigned int errors() const { return m_errors; }
+
+  tlm_utils::simple_initiator_socket<vp_cpu> initiator_socket;
+
+private:
+  void cpu_thread();                                ///< SC_THREAD
+  void execute_instructions();                      ///< ISS main loop
+  unsigned int access(bool write, unsigned int address, unsigned int data);
+
+  const unsigned int          m_ID;                 ///< CPU ID
+  const vp_mode               m_mode;               ///< execution mode
+  const unsigned long         m_instructions;       ///< instructions to run
+  const sc_dt::uint64         m_base_address;       ///< private memory region
+  const unsigned int          m_region_size;        ///< region size (words)
+  const sc_core::sc_time      m_cycle_time;         ///< time per instruction
+  unsigned int                m_checksum;           ///< of the registers
+  unsigned int                m_errors;             ///< failed accesses
+  tlm::tlm_generic_payload    m_payload;            ///< reused transaction
+  tlm_utils::tlm_parallel_quantumkeeper m_quantum_keeper;
+};
+
+//==============================================================================
+///  @brief Top level of the multi-core platform
+//==============================================================================
+class multicore_vp_top
+  : public sc_core::sc_module
+{
+public:
+  multicore_vp_top
+  ( sc_core::sc_module_name name                    ///< module name
+  , vp_mode                 mode                    ///< execution mode
+  , unsigned int            cpus                    ///< number of CPUs
+  , unsigned long           instructions            ///< instructions per CPU
+  );
+
+  void report(std::ostream& os) const;              ///< print the checksums
+
+private:
+  vp_memory                   m_memory;             ///< shared memory
+  sc_core::sc_vector<vp_cpu>  m_cpus;               ///< CPUs
+};
+
+#endif /* __MULTICORE_VP_TOP_H__ */
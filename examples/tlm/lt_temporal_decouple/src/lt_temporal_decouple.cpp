@@ -20,19 +20,73 @@
 
 
 #include "lt_temporal_decouple_top.h"    // top module
+#include "multicore_vp_top.h"            // multi-core platform
 #include "tlm.h"                         // TLM header
 #define REPORT_DEFINE_GLOBALS
 #include "reporting.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+//==============================================================================
+///  @fn run_multicore_vp
+//
+///  @brief Runs the multi-core platform and reports the wall clock time
+//
+///  @details
+///    Usage: lt_temporal_decouple sequential|parallel|locked [cpus] [instr]
+///
+///    The CPUs execute their quanta on the SystemC thread (sequential) or on
+///    host threads, in parallel. The checksums and the simulated time are
+///    the same in all modes.
+//
+//==============================================================================
+static int
+run_multicore_vp
+  (int   argc
+  ,char* argv[]
+)
+{
+  vp_mode mode;
+  if      (std::strcmp(argv[1], "sequential") == 0) mode = VP_SEQUENTIAL;
+  else if (std::strcmp(argv[1], "parallel")   == 0) mode = VP_PARALLEL;
+  else if (std::strcmp(argv[1], "locked")     == 0) mode = VP_LOCKED;
+  else {
+    std::cerr << "Usage: " << argv[0]
+              << " [sequential|parallel|locked [cpus] [instructions]]"
+              << std::endl;
+    return 1;
+  }
+  unsigned int  cpus         = (argc > 2) ? std::atoi(argv[2]) : 4;
+  unsigned long instructions = (argc > 3) ? std::atol(argv[3]) : 2000000;
+
+  tlm_utils::tlm_quantumkeeper::set_global_quantum
+    (sc_core::sc_time(10, sc_core::SC_US));
+  multicore_vp_top top("top", mode, cpus, instructions);
+
+  std::chrono::steady_clock::time_point start =
+    std::chrono::steady_clock::now();
+  sc_core::sc_start();
+  std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - start;
+
+  top.report(std::cout);
+  std::cout << cpus << " CPUs, " << instructions << " instructions, "
+            << argv[1] << ": simulated " << sc_core::sc_time_stamp()
+            << " in " << elapsed.count() << " s" << std::endl;
+  return 0;
+}
 //==============================================================================
 ///  @fn sc_main
 //  
 ///  @brief sc_main for lt example with temporal decoupling
 //  
 ///  @details
-///    This is the SystemC entry point for an example system.  The argc and argv 
-///    parameters are not used.  Simulation runtime is not specified when 
-///    sc_start() is called, the example traffic generator will run to 
-///    completion, ending the simulation. 
+///    This is the SystemC entry point for an example system.  Without
+///    arguments, the example system is simulated.  Simulation runtime is not
+///    specified when sc_start() is called, the example traffic generator
+///    will run to completion, ending the simulation.  With arguments, the
+///    multi-core platform is simulated instead (see run_multicore_vp).
 //
 //==============================================================================
 //
@@ -44,10 +98,13 @@
 //==============================================================================
 int                                     // return status
 sc_main                                 // SystemC entry point
-  (int   /*argc*/                       // argument count
-  ,char* /*argv*/[]                     // argument vector
+  (int   argc                           // argument count
+  ,char* argv[]                         // argument vector
 )
 {
+  if (argc > 1)
+    return run_multicore_vp(argc, argv);
+
   REPORT_ENABLE_ALL_REPORTING ();
   lt_temporal_decouple_top top("top");  // instantiate a exmaple top module
 
@@ -0,0 +1,232 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+//==============================================================================
+/// @file multicore_vp_top.cpp
+//
+/// @brief Multi-core platform with temporally decoupled CPUs
+//
+/// @details
+///    The CPUs run in lock-step at the quantum boundaries. In the parallel
+///    and locked modes, the quanta of all CPUs are executed concurrently
+///    on host threads. Each CPU only accesses its own region of the shared
+///    memory, so the results do not depend on the order of the accesses of
+///    different CPUs within a quantum.
+//
+//==============================================================================
+
+#include "multicore_vp_top.h"                        // header for this module
+#include <cstring>
+#include <iomanip>
+
+using namespace sc_core;
+
+//==============================================================================
+//  vp_memory
+//==============================================================================
+
+vp_memory::vp_memory
+( sc_module_name  name
+, unsigned int    size
+)
+  : sc_module       (name)
+  , target_socket   ("target_socket")
+  , m_memory        (size, 0)
+  , m_access_delay  (20, SC_NS)
+{
+  target_socket.register_b_transport(this, &vp_memory::custom_b_transport);
+}
+
+/// Executed on a host thread in the locked mode, so it must not use the kernel
+void
+vp_memory::custom_b_transport
+( int                       /*id*/
+, tlm::tlm_generic_payload  &payload
+, sc_time                   &delay
+)
+{
+  sc_dt::uint64 index = payload.get_address() / 4;
+
+  if (  index >= m_memory.size()
+     || payload.get_address() % 4 != 0
+     || payload.get_data_length() != 4
+     || payload.get_byte_enable_ptr() )
+  {
+    payload.set_response_status(tlm::TLM_ADDRESS_ERROR_RESPONSE);
+    return;
+  }
+
+  if (payload.is_read())
+    std::memcpy(payload.get_data_ptr(), &m_memory[index], 4);
+  else
+    std::memcpy(&m_memory[index], payload.get_data_ptr(), 4);
+
+  delay += m_access_delay;
+  payload.set_response_status(tlm::TLM_OK_RESPONSE);
+}
+
+//==============================================================================
+//  vp_cpu
+//==============================================================================
+
+vp_cpu::vp_cpu
+( sc_module_name  name
+, unsigned int    ID
+, vp_mode         mode
+, unsigned long   instructions
+, sc_dt::uint64   base_address
+, unsigned int    region_size
+)
+  : sc_module         (name)
+  , initiator_socket  ("initiator_socket")
+  , m_ID              (ID)
+  , m_mode            (mode)
+  , m_instructions    (instructions)
+  , m_base_address    (base_address)
+  , m_region_size     (region_size)
+  , m_cycle_time      (10, SC_NS)
+  , m_checksum        (0)
+  , m_errors          (0)
+  , m_quantum_keeper  ("quantum_keeper")
+{
+  SC_THREAD(cpu_thread);
+}
+
+void
+vp_cpu::cpu_thread()
+{
+  m_quantum_keeper.reset();
+
+  if (m_mode == VP_SEQUENTIAL)
+    execute_instructions();
+  else
+    m_quantum_keeper.run([this] { execute_instructions(); });
+
+  m_quantum_keeper.sync();                    // consume the local time
+}
+
+/// Executed on a host thread in the parallel and locked modes
+void
+vp_cpu::execute_instructions()
+{
+  unsigned int r[4] = { 0x9e3779b9u * (m_ID + 1), 0x12345678u, 0, 0 };
+
+  for (unsigned long pc = 0; pc < m_instructions; ++pc)
+  {
+    // "decode and execute"
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+      r[0] ^= r[0] << 13;
+      r[0] ^= r[0] >> 17;
+      r[0] ^= r[0] << 5;
+      r[1]  = r[1] * 1664525u + 1013904223u + r[0];
+      r[2] += (r[1] >> 7) ^ r[3];
+      r[3]  = ((r[3] << 1) | (r[3] >> 31)) + r[2];
+    }
+
+    // every 64th instruction is a load or store
+    if ((pc & 63) == 63)
+    {
+      unsigned int address = r[0] % m_region_size;
+      if (pc & 64)
+        access(true, address, r[3]);
+      else
+        r[3] ^= access(false, address, 0);
+    }
+
+    m_quantum_keeper.inc(m_cycle_time);
+    if (m_quantum_keeper.need_sync())
+      m_quantum_keeper.sync();
+  }
+
+  m_checksum = r[0] ^ r[1] ^ r[2] ^ r[3];
+}
+
+unsigned int
+vp_cpu::access
+( bool          write
+, unsigned int  address
+, unsigned int  data
+)
+{
+  m_payload.set_command(write ? tlm::TLM_WRITE_COMMAND : tlm::TLM_READ_COMMAND);
+  m_payload.set_address(m_base_address + 4 * address);
+  m_payload.set_data_ptr(reinterpret_cast<unsigned char*>(&data));
+  m_payload.set_data_length(4);
+  m_payload.set_streaming_width(4);
+  m_payload.set_byte_enable_ptr(0);
+  m_payload.set_dmi_allowed(false);
+  m_payload.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+
+  std::function<void()> transport = [this]
+  {
+    sc_time delay = m_quantum_keeper.get_local_time();
+    initiator_socket->b_transport(m_payload, delay);
+    m_quantum_keeper.set(delay);
+  };
+
+  if (m_mode == VP_LOCKED)
+    m_quantum_keeper.execute_locked(transport);
+  else
+    m_quantum_keeper.execute(transport);
+
+  if (m_payload.is_response_error())
+    ++m_errors;                               // no reports on host threads
+  return data;
+}
+
+//==============================================================================
+//  multicore_vp_top
+//==============================================================================
+
+static const unsigned int region_size = 1024;   ///< words per CPU
+
+multicore_vp_top::multicore_vp_top
+( sc_module_name  name
+, vp_mode         mode
+, unsigned int    cpus
+, unsigned long   instructions
+)
+  : sc_module  (name)
+  , m_memory   ("m_memory", cpus * region_size)
+  , m_cpus     ("m_cpu")
+{
+  m_cpus.init(cpus, [=](const char* nm, size_t i)
+  {
+    return new vp_cpu(nm, static_cast<unsigned int>(i), mode, instructions,
+                      4 * region_size * i, region_size);
+  });
+
+  for (size_t i = 0; i < m_cpus.size(); ++i)
+    m_cpus[i].initiator_socket(m_memory.target_socket);
+}
+
+void
+multicore_vp_top::report(std::ostream& os) const
+{
+  for (size_t i = 0; i < m_cpus.size(); ++i)
+  {
+    os << "CPU " << i << " checksum: 0x" << std::hex << std::setw(8)
+       << std::setfill('0') << m_cpus[i].checksum() << std::dec
+       << std::setfill(' ');
+    if (m_cpus[i].errors())
+      os << " (" << m_cpus[i].errors() << " failed accesses)";
+    os << std::endl;
+  }
+}
@@ -0,0 +1,88 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_async_event.cpp -- An event, which can be notified from other threads.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/communication/sc_async_event.h"
+
+namespace sc_core {
+
+static const sc_dt::uint64 no_delay = ~sc_dt::UINT64_ZERO;
+
+sc_async_event::sc_async_event( bool attach_suspending_ )
+  : sc_prim_channel( sc_gen_unique_name( "async_event" ) ),
+    m_event( sc_event::kernel_event, "event" ),
+    m_delay( no_delay )
+{
+    init( attach_suspending_ );
+}
+
+sc_async_event::sc_async_event( const char* name_, bool attach_suspending_ )
+  : sc_prim_channel( name_ ),
+    m_event( sc_event::kernel_event, "event" ),
+    m_delay( no_delay )
+{
+    init( attach_suspending_ );
+}
+
+void
+sc_async_event::init( bool attach_suspending_ )
+{
+    if( attach_suspending_ )
+        async_attach_suspending();
+}
+
+void
+sc_async_event::notify( const sc_time& delay_ )
+{
+    // keep the earliest pending delay
+    sc_dt::uint64 delay = delay_.value();
+    sc_dt::uint64 pending = m_delay.load( std::memory_order_relaxed );
+    while( delay < pending &&
+           !m_delay.compare_exchange_weak( pending, delay,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed ) ) {}
+    async_request_update();
+}
+
+void
+sc_async_event::update()
+{
+    sc_dt::uint64 delay = m_delay.exchange( no_delay, std::memory_order_acquire );
+    if( delay != no_delay )
+        m_event.notify( sc_time::from_value( delay ) );
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
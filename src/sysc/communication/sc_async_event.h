@@ -0,0 +1,117 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_async_event.h -- An event, which can be notified from other threads.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_ASYNC_EVENT_H_INCLUDED_
+#define SC_ASYNC_EVENT_H_INCLUDED_
+
+#include "sysc/communication/sc_prim_channel.h"
+#include "sysc/kernel/sc_event.h"
+
+#include <atomic>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::atomic
+#endif
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_async_event
+//
+//  An event, which can be notified from any host thread. The notification
+//  is passed to the kernel with async_request_update(), the event is
+//  notified with the given delay in the following update phase. Like for
+//  sc_event, the earliest of several pending notifications wins.
+//
+//  The event is attached as suspending by default, so the simulation does
+//  not end while the kernel waits for external notifications.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_async_event
+  : public sc_prim_channel
+{
+public:
+
+    explicit sc_async_event( bool attach_suspending_ = true );
+    explicit sc_async_event( const char* name_, bool attach_suspending_ = true );
+
+    virtual const char* kind() const
+        { return "sc_async_event"; }
+
+    // notify the event (thread-safe)
+    void notify( const sc_time& delay_ = SC_ZERO_TIME );
+
+    // keep the simulation from ending, while external notifications may come
+    void attach_suspending()
+        { async_attach_suspending(); }
+    void detach_suspending()
+        { async_detach_suspending(); }
+
+    const sc_event& default_event() const
+        { return m_event; }
+
+    operator const sc_event& () const
+        { return m_event; }
+
+protected:
+
+    virtual void update();
+
+private:
+
+    void init( bool attach_suspending_ );
+
+private:
+
+    sc_event                   m_event;
+    std::atomic<sc_dt::uint64> m_delay;   // earliest pending delay
+
+private:
+
+    // disabled
+    sc_async_event( const sc_async_event& );
+    sc_async_event& operator = ( const sc_async_event& );
+};
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_ASYNC_EVENT_H_INCLUDED_
+// Taf!
@@ -0,0 +1,355 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_async_fifo.h -- A fifo, which can be written from other threads.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_ASYNC_FIFO_H_INCLUDED_
+#define SC_ASYNC_FIFO_H_INCLUDED_
+
+#include "sysc/communication/sc_communication_ids.h"
+#include "sysc/communication/sc_prim_channel.h"
+#include "sysc/communication/sc_fifo_ifs.h"
+#include "sysc/kernel/sc_event.h"
+
+#include <atomic>
+#include <new>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_async_fifo<T>
+//
+//  An unbounded fifo, which is written by any number of host threads and
+//  read by the simulation, e.g. through an sc_fifo_in<T> port. The writers
+//  never block: they claim a slot in the current chunk of the fifo with an
+//  atomic increment, or install a new chunk, if it is full. The kernel
+//  takes all written chunks at once in the update phase, from then on the
+//  values are available to the reader, and the data written event is
+//  notified. The values of each writer are read in the order they were
+//  written.
+//
+//  The kernel reuses the chunks, so the writers only allocate memory while
+//  more values are pending than ever before.
+//
+//  The fifo is attached as suspending by default, so the simulation does
+//  not end while the kernel waits for external values.
+// ----------------------------------------------------------------------------
+
+template <class T>
+class sc_async_fifo
+: public sc_fifo_in_if<T>,
+  public sc_prim_channel
+{
+public:
+
+    // constructors
+
+    explicit sc_async_fifo( bool attach_suspending_ = true )
+      : sc_prim_channel( sc_gen_unique_name( "async_fifo" ) ),
+        m_current( new chunk() ),
+        m_update_requested( false ),
+        m_free(),
+        m_taken(),
+        m_buf(),
+        m_read_pos( 0 ),
+        m_reader( 0 ),
+        m_data_written_event( sc_event::kernel_event, "write_event" )
+      { init( attach_suspending_ ); }
+
+    explicit sc_async_fifo( const char* name_, bool attach_suspending_ = true )
+      : sc_prim_channel( name_ ),
+        m_current( new chunk() ),
+        m_update_requested( false ),
+        m_free(),
+        m_taken(),
+        m_buf(),
+        m_read_pos( 0 ),
+        m_reader( 0 ),
+        m_data_written_event( sc_event::kernel_event, "write_event" )
+      { init( attach_suspending_ ); }
+
+
+    // destructor
+
+    virtual ~sc_async_fifo();
+
+
+    // write a value (thread-safe, never blocks)
+    void write( const T& );
+
+
+    // interface methods
+
+    virtual void register_port( sc_port_base&, const char* );
+
+    // blocking read
+    virtual void read( T& );
+    virtual T read();
+
+    // non-blocking read
+    virtual bool nb_read( T& );
+
+    // get the number of available samples
+    virtual int num_available() const
+        { return static_cast<int>( m_buf.size() - m_read_pos ); }
+
+    // get the data written event
+    virtual const sc_event& data_written_event() const
+        { return m_data_written_event; }
+
+
+    // keep the simulation from ending, while external values may come
+    void attach_suspending()
+        { async_attach_suspending(); }
+    void detach_suspending()
+        { async_detach_suspending(); }
+
+    virtual const char* kind() const
+        { return "sc_async_fifo"; }
+
+protected:
+
+    virtual void update();
+
+    void init( bool attach_suspending_ )
+    {
+        if( attach_suspending_ )
+            async_attach_suspending();
+    }
+
+private:
+
+    enum { chunk_size = 256 };
+
+    // The values in the slots below m_claimed are complete, when
+    // m_committed has caught up. The kernel closes a chunk by adding
+    // chunk_size to m_claimed, so late writers move on to the next chunk.
+    struct chunk
+    {
+        chunk() : m_claimed( 0 ), m_committed( 0 ), m_prev( 0 ) {}
+
+        T* slot( unsigned i )
+            { return reinterpret_cast<T*>( m_slots[i] ); }
+
+        std::atomic<unsigned>    m_claimed;
+        std::atomic<unsigned>    m_committed;
+        chunk*                   m_prev;       // older chunk, not yet taken
+        alignas(T) unsigned char m_slots[chunk_size][sizeof(T)];
+    };
+
+    void take( chunk* );
+
+    std::atomic<chunk*> m_current;           // chunk written to
+    std::atomic<bool>   m_update_requested;  // update not yet started
+    std::vector<chunk*> m_free;              // closed chunks for reuse
+    std::vector<chunk*> m_taken;             // chunks taken by update
+    std::vector<T>      m_buf;               // values available to the reader
+    std::size_t         m_read_pos;          // next value to read from m_buf
+    sc_port_base*       m_reader;            // for static design rule checking
+    sc_event            m_data_written_event;
+
+private:
+
+    // disabled
+    sc_async_fifo( const sc_async_fifo<T>& );
+    sc_async_fifo& operator = ( const sc_async_fifo<T>& );
+};
+
+
+// IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
+
+template <class T>
+inline
+sc_async_fifo<T>::~sc_async_fifo()
+{
+    for( chunk* c = m_current.load(); c; ) {
+        chunk* prev = c->m_prev;
+        take( c );
+        delete c;
+        c = prev;
+    }
+    for( std::size_t i = 0; i < m_free.size(); ++i )
+        delete m_free[i];
+}
+
+template <class T>
+inline
+void
+sc_async_fifo<T>::write( const T& val_ )
+{
+    chunk* c = m_current.load( std::memory_order_acquire );
+    for( ;; ) {
+        unsigned i = c->m_claimed.fetch_add( 1 );
+        if( i < chunk_size ) {
+            ::new( c->slot( i ) ) T( val_ );
+            c->m_committed.fetch_add( 1, std::memory_order_release );
+            break;
+        }
+
+        // full or closed, install a new chunk unless another writer did
+        chunk* current = m_current.load( std::memory_order_acquire );
+        if( current == c ) {
+            chunk* n = new chunk();
+            n->m_prev = c;
+            if( m_current.compare_exchange_strong( current, n ) )
+                current = n;
+            else
+                delete n;
+        }
+        c = current;
+    }
+
+    // an update, which has not started yet, takes the value
+    if( !m_update_requested.load() && !m_update_requested.exchange( true ) )
+        async_request_update();
+}
+
+template <class T>
+inline
+void
+sc_async_fifo<T>::register_port( sc_port_base& port_,
+                                 const char* if_typename_ )
+{
+    std::string nm( if_typename_ );
+    if( nm == typeid( sc_fifo_in_if<T> ).name() ||
+        nm == typeid( sc_fifo_blocking_in_if<T> ).name()
+    ) {
+        // only one reader can be connected
+        if( m_reader != 0 ) {
+            SC_REPORT_ERROR( SC_ID_MORE_THAN_ONE_FIFO_READER_, 0 );
+            // may continue, if suppressed
+        }
+        m_reader = &port_;
+    }
+}
+
+template <class T>
+inline
+void
+sc_async_fifo<T>::read( T& val_ )
+{
+    while( num_available() == 0 ) {
+        sc_core::wait( m_data_written_event );
+    }
+    nb_read( val_ );
+}
+
+template <class T>
+inline
+T
+sc_async_fifo<T>::read()
+{
+    T tmp;
+    read( tmp );
+    return tmp;
+}
+
+template <class T>
+inline
+bool
+sc_async_fifo<T>::nb_read( T& val_ )
+{
+    if( m_read_pos == m_buf.size() ) {
+        return false;
+    }
+    val_ = m_buf[m_read_pos++];
+    return true;
+}
+
+// close a chunk and move its values to the read buffer
+
+template <class T>
+inline
+void
+sc_async_fifo<T>::take( chunk* c )
+{
+    unsigned n = c->m_claimed.fetch_add( chunk_size );
+    if( n > chunk_size )
+        n = chunk_size;
+
+    // wait for writers, which have claimed a slot, but not yet written it
+    while( c->m_committed.load( std::memory_order_acquire ) != n )
+        std::this_thread::yield();
+
+    for( unsigned i = 0; i < n; ++i ) {
+        m_buf.push_back( *c->slot( i ) );
+        c->slot( i )->~T();
+    }
+}
+
+template <class T>
+inline
+void
+sc_async_fifo<T>::update()
+{
+    m_update_requested.store( false );
+
+    // late writers may claim the slots of a reused chunk from here on
+    chunk* fresh;
+    if( m_free.empty() ) {
+        fresh = new chunk();
+    } else {
+        fresh = m_free.back();
+        m_free.pop_back();
+        fresh->m_prev = 0;
+        fresh->m_committed.store( 0, std::memory_order_relaxed );
+        fresh->m_claimed.store( 0 );
+    }
+    chunk* c = m_current.exchange( fresh );
+
+    // drop the values read so far
+    m_buf.erase( m_buf.begin(), m_buf.begin() + m_read_pos );
+    m_read_pos = 0;
+
+    // take the chunks, the oldest first
+    for( ; c; c = c->m_prev )
+        m_taken.push_back( c );
+    std::size_t available = m_buf.size();
+    while( !m_taken.empty() ) {
+        take( m_taken.back() );
+        m_free.push_back( m_taken.back() );
+        m_taken.pop_back();
+    }
+
+    if( m_buf.size() != available )
+        m_data_written_event.notify( SC_ZERO_TIME );
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_ASYNC_FIFO_H_INCLUDED_
+// Taf!
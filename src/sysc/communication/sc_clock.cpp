@@ -50,6 +50,7 @@
 #include "sysc/kernel/sc_spawn.h"
 #include "sysc/utils/sc_utils_ids.h"
 
+#include <algorithm>
 #include <sstream>
 
 namespace sc_core {
@@ -67,7 +68,8 @@ sc_clock::sc_clock() :
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_origin(), m_lazy(), m_sleeping()
 {
     init( sc_time::from_value(simcontext()->m_time_params->default_time_unit),
 	  0.5,
@@ -82,7 +84,8 @@ sc_clock::sc_clock( const char* name_ ) :
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_origin(), m_lazy(), m_sleeping()
 {
     init( sc_time::from_value(simcontext()->m_time_params->default_time_unit),
 	  0.5,
@@ -101,7 +104,8 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_origin(), m_lazy(), m_sleeping()
 {
     init( period_,
 	  duty_cycle_,
@@ -125,7 +129,8 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_origin(), m_lazy(), m_sleeping()
 {
     init( sc_time( period_v_, period_tu_, simcontext() ),
 	  duty_cycle_,
@@ -147,7 +152,8 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_origin(), m_lazy(), m_sleeping()
 {
     init( sc_time( period_v_, period_tu_, simcontext() ),
 	  duty_cycle_,
@@ -173,7 +179,8 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_origin(), m_lazy(), m_sleeping()
 {
     static bool warn_sc_clock=true;
     if ( warn_sc_clock )
@@ -202,10 +209,16 @@ sc_clock::sc_clock( const char* name_,
     }
 }
 
-// destructor (does nothing)
+// destructor
 
 sc_clock::~sc_clock()
-{}
+{
+    std::vector<sc_clock*>& sleeping = simcontext()->m_sleeping_clocks;
+    std::vector<sc_clock*>::iterator it =
+      std::find( sleeping.begin(), sleeping.end(), this );
+    if( it != sleeping.end() )
+        sleeping.erase( it );
+}
 
 void sc_clock::register_port( sc_port_base& /*port*/, const char* if_typename_ )
 {
@@ -223,6 +236,30 @@ sc_clock::write( const bool& /* value */ )
     // may continue, if suppressed
 }
 
+void
+sc_clock::print( ::std::ostream& os ) const
+{
+    if( m_sleeping )
+        catch_up();
+    base_type::print( os );
+}
+
+void
+sc_clock::dump( ::std::ostream& os ) const
+{
+    if( m_sleeping )
+        catch_up();
+    base_type::dump( os );
+}
+
+void
+sc_clock::set_lazy( bool lazy )
+{
+    m_lazy = lazy;
+    if( !lazy && m_sleeping )
+        wake();
+}
+
 // interface methods
 
 // get the current time
@@ -307,11 +344,123 @@ sc_clock::init( const sc_time& period_,
     }
 
     m_start_time = start_time_;
+    m_origin = simcontext()->time_stamp() + start_time_;
+    m_lazy = simcontext()->m_lazy_clocks;
+    m_sleeping = false;
 
     spawn_edge_method(true);
     spawn_edge_method(false);
 }
 
+// lazy clocks
+
+bool
+sc_clock::drives( const sc_event* event_p ) const
+{
+    return event_p == m_change_event_p || event_p == m_posedge_event_p ||
+           event_p == m_negedge_event_p;
+}
+
+bool
+sc_clock::sleep_at_edge()
+{
+    // The value of a sleeping clock assumes that the edges take effect at
+    // the end of the first delta cycle of their time step, like the edges
+    // that are notified through the timed events.
+    if( simcontext()->delta_count_at_current_time() != 0 ||
+        m_trace_notifier_p != 0 || m_reset_p != 0 ||
+        ( m_change_event_p != 0 && m_change_event_p->awaited() ) ||
+        ( m_posedge_event_p != 0 && m_posedge_event_p->awaited() ) ||
+        ( m_negedge_event_p != 0 && m_negedge_event_p->awaited() ) ) {
+        return false;
+    }
+    m_sleeping = true;
+    simcontext()->m_sleeping_clocks.push_back( this );
+    return true;
+}
+
+void
+sc_clock::wake()
+{
+    std::vector<sc_clock*>& sleeping = simcontext()->m_sleeping_clocks;
+    std::vector<sc_clock*>::iterator it =
+      std::find( sleeping.begin(), sleeping.end(), this );
+    *it = sleeping.back();
+    sleeping.pop_back();
+    m_sleeping = false;
+
+    sc_dt::uint64 now = simcontext()->time_stamp().value();
+    bool          value;
+    bool          at_edge;
+    sc_dt::uint64 next;
+    phase_at( now, value, at_edge, next );
+
+    if( at_edge && simcontext()->delta_count_at_current_time() == 0 ) {
+        // the edge of the current time step is still due
+        m_cur_val = m_new_val = !value;
+        if( value )
+            raise();
+        else
+            lower();
+        return;
+    }
+
+    catch_up();
+    if( value )
+        m_next_negedge_event.notify_internal( sc_time::from_value( next - now ) );
+    else
+        m_next_posedge_event.notify_internal( sc_time::from_value( next - now ) );
+}
+
+void
+sc_clock::phase_at( sc_dt::uint64 t, bool& value, bool& at_edge,
+                    sc_dt::uint64& next ) const
+{
+    sc_dt::uint64 origin = m_origin.value();
+    if( t < origin ) {
+        value = !m_posedge_first;
+        at_edge = false;
+        next = origin;
+        return;
+    }
+
+    // the first phase of each period ends with the opposite edge
+    sc_dt::uint64 period = m_period.value();
+    sc_dt::uint64 first = m_posedge_first ? m_negedge_time.value()
+                                          : m_posedge_time.value();
+    sc_dt::uint64 offset = ( t - origin ) % period;
+    if( offset < first ) {
+        value = m_posedge_first;
+        at_edge = ( offset == 0 );
+        next = t - offset + first;
+    } else {
+        value = !m_posedge_first;
+        at_edge = ( offset == first );
+        next = t - offset + period;
+    }
+}
+
+void
+sc_clock::catch_up() const
+{
+    sc_simcontext* simc = simcontext();
+    bool           value;
+    bool           at_edge;
+    sc_dt::uint64  next;
+    phase_at( simc->time_stamp().value(), value, at_edge, next );
+
+    // an edge is seen from the second delta cycle of its time step on
+    sc_clock* self = const_cast<sc_clock*>( this );
+    if( at_edge ) {
+        sc_dt::uint64 deltas = simc->delta_count_at_current_time();
+        if( deltas == 0 )
+            value = !value;
+        else if( deltas == 1 )
+            self->m_change_stamp = simc->change_stamp();
+    }
+    self->m_cur_val = self->m_new_val = value;
+}
+
 } // namespace sc_core
 
 /*****************************************************************************
@@ -40,6 +40,17 @@ namespace sc_core {
 //  CLASS : sc_clock
 //
 //  The clock channel.
+//
+//  A lazy clock (see set_lazy) stops scheduling its edges while no process
+//  is sensitive to or waiting for its events, and it is neither traced nor
+//  used as a reset. Its value is then computed from the simulation time
+//  when it is read. The edges resume when a process waits for one of its
+//  events again, or when a process that is statically sensitive to it
+//  runs. Unlike a regular clock, a sleeping lazy clock does not keep the
+//  simulation from running out of events, it does not add to the delta
+//  count, and the order of the processes within a delta cycle may differ.
+//  The value of a sleeping clock should not be read by methods that are
+//  evaluated in parallel.
 // ----------------------------------------------------------------------------
 
 class SC_API sc_clock
@@ -86,6 +97,27 @@ public:
     virtual void register_port( sc_port_base&, const char* if_type );
     virtual void write( const bool& );
 
+    // read the current value, which is computed if the clock is sleeping
+    virtual const bool& read() const
+        { if( SC_UNLIKELY_( m_sleeping ) ) catch_up(); return m_cur_val; }
+
+    virtual const bool& get_data_ref() const
+        { return read(); }
+
+    // was there a value change event?
+    virtual bool event() const
+        { if( SC_UNLIKELY_( m_sleeping ) ) catch_up(); return base_type::event(); }
+
+    virtual void print( ::std::ostream& = ::std::cout ) const;
+    virtual void dump( ::std::ostream& = ::std::cout ) const;
+
+    // skip the edges while nothing is sensitive to the clock, the default
+    // is given by the environment variable SC_LAZY_CLOCKS
+    void set_lazy( bool lazy = true );
+
+    bool is_lazy() const
+        { return m_lazy; }
+
     // get the period
     const sc_time& period() const
 	{ return m_period; }
@@ -137,6 +169,10 @@ protected:
     void posedge_action();
     void negedge_action();
 
+    // perform the positive and the negative edge
+    void raise();
+    void lower();
+
 
     // error reporting
     void report_error( const char* id, const char* add_msg = 0 ) const;
@@ -159,6 +195,31 @@ protected:
     sc_event m_next_posedge_event;
     sc_event m_next_negedge_event;
 
+    sc_time  m_origin;          // the time of the first edge
+    bool     m_lazy;            // skip the edges if nothing is sensitive
+    bool     m_sleeping;        // the edges are skipped
+
+private:
+
+    friend class sc_simcontext;
+
+    // does the clock notify this event?
+    bool drives( const sc_event* ) const;
+
+    // go to sleep, if nothing is sensitive to the clock
+    bool sleep_at_edge();
+
+    // resume the edges
+    void wake();
+
+    // the value after the last edge at or before the time t, whether
+    // there is an edge at t, and the time of the next edge after t
+    void phase_at( sc_dt::uint64 t, bool& value, bool& at_edge,
+                   sc_dt::uint64& next ) const;
+
+    // set the value of a sleeping clock for the current time
+    void catch_up() const;
+
 private:
 
     // disabled
@@ -174,6 +235,24 @@ private:
 inline
 void
 sc_clock::posedge_action()
+{
+    if( SC_UNLIKELY_( m_lazy ) && sleep_at_edge() )
+        return;
+    raise();
+}
+
+inline
+void
+sc_clock::negedge_action()
+{
+    if( SC_UNLIKELY_( m_lazy ) && sleep_at_edge() )
+        return;
+    lower();
+}
+
+inline
+void
+sc_clock::raise()
 {
     m_next_negedge_event.notify_internal( m_negedge_time );
 	m_new_val = true;
@@ -182,7 +261,7 @@ sc_clock::posedge_action()
 
 inline
 void
-sc_clock::negedge_action()
+sc_clock::lower()
 {
     m_next_posedge_event.notify_internal( m_posedge_time );
 	m_new_val = false;
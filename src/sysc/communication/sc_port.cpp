@@ -37,7 +37,9 @@
 #include "sysc/communication/sc_port.h"
 #include "sysc/communication/sc_signal_ifs.h"
 
+#include <algorithm>
 #include <sstream>
+#include <utility>
 
 namespace sc_core {
 
@@ -133,11 +135,12 @@ struct sc_bind_info
 
     int                        m_max_size;
     sc_port_policy             m_policy;
-    std::vector<sc_bind_elem*> vec;
+    std::vector<sc_bind_elem>  vec;
     bool                       has_parent;
     int                        last_add;
     bool                       is_leaf;
     bool                       complete;
+    bool                       resolving;  // parents are being completed
 
     ef_vector                  thread_vec;
     ef_vector                  method_vec;
@@ -156,6 +159,7 @@ sc_bind_info::sc_bind_info( int max_size_, sc_port_policy policy_ )
   last_add( -1 ),
   is_leaf( true ),
   complete( false ),
+  resolving( false ),
   thread_vec(),
   method_vec()
 {}
@@ -164,11 +168,7 @@ sc_bind_info::sc_bind_info( int max_size_, sc_port_policy policy_ )
 // destructor
 
 sc_bind_info::~sc_bind_info()
-{
-    for( int i = size() - 1; i >= 0; -- i ) {
-	delete vec[i];
-    }
-}
+{}
 
 
 int
@@ -280,7 +280,7 @@ sc_port_base::bind( sc_interface& interface_ )
         return;
     }
 
-    m_bind_info->vec.push_back( new sc_bind_elem( &interface_ ) );
+    m_bind_info->vec.push_back( sc_bind_elem( &interface_ ) );
     
     if( ! m_bind_info->has_parent ) {
 	// add (cache) the interface
@@ -309,14 +309,14 @@ sc_port_base::bind( this_type& parent_ )
     // check if parent port is already bound to this port
 #if 0
     for( int i = m_bind_info->size() - 1; i >= 0; -- i ) {
-        if( &parent_ == m_bind_info->vec[i]->parent ) {
+        if( &parent_ == m_bind_info->vec[i].parent ) {
             report_error( SC_ID_BIND_PORT_TO_PORT_, "already bound" );
             return;
         }
     }
 #endif // 
 
-    m_bind_info->vec.push_back( new sc_bind_elem( &parent_ ) );
+    m_bind_info->vec.push_back( sc_bind_elem( &parent_ ) );
     m_bind_info->has_parent = true;
     parent_.m_bind_info->is_leaf = false;
 }
@@ -403,51 +403,36 @@ sc_port_base::make_sensitive( sc_method_handle handle_,
 
 // support methods
 
-int
-sc_port_base::first_parent()
-{
-    for( int i = 0; i < m_bind_info->size(); ++ i ) {
-	if( m_bind_info->vec[i]->parent != 0 ) {
-	    return i;
-	}
-    }
-    return -1;
-}
+// replace the parent ports in the bind vector by their interfaces, in one
+// pass over the bind vector
 
 void
-sc_port_base::insert_parent( int i )
+sc_port_base::resolve_parents()
 {
-    std::vector<sc_bind_elem*>& vec = m_bind_info->vec;
+    std::vector<sc_bind_elem>& vec = m_bind_info->vec;
+    std::vector<sc_bind_elem> resolved;
+    resolved.reserve( vec.size() );
 
-    this_type* parent = vec[i]->parent;
+    for( std::size_t i = 0; i < vec.size(); ++ i ) {
+	this_type* parent = vec[i].parent;
+	if( parent == 0 ) {
+	    resolved.push_back( vec[i] );
+	    continue;
+	}
 
+	// COMPLETE BINDING OF OUR PARENT PORT SO THAT WE CAN USE THAT
+	// INFORMATION (a parent without binding leaves an unbound entry):
 
-    // IF OUR PARENT HAS NO BINDING THEN IGNORE IT:
-    //
-    // Note that the zeroing of the parent pointer must occur before this
-    // test
-
-    vec[i]->parent = 0;
-    if ( parent->m_bind_info->vec.size() == 0 ) return;
-
-    vec[i]->iface = parent->m_bind_info->vec[0]->iface;
-    int n = parent->m_bind_info->size() - 1;
-    if( n > 0 ) {
-	// resize the bind vector (by adding new elements)
-	for( int k = 0; k < n; ++ k ) {
-	    vec.push_back( new sc_bind_elem() );
-	}
-	// move elements in the bind vector
-	for( int k = m_bind_info->size() - n - 1; k > i; -- k ) {
-	    vec[k + n]->iface = vec[k]->iface;
-	    vec[k + n]->parent = vec[k]->parent;
-	}
-	// insert parent interfaces into the bind vector
-	for( int k = i + 1; k <= i + n; ++ k ) {
-	    vec[k]->iface = parent->m_bind_info->vec[k - i]->iface;
-	    vec[k]->parent = 0;
+	parent->complete_binding();
+	const std::vector<sc_bind_elem>& parent_vec = parent->m_bind_info->vec;
+	if( parent_vec.empty() ) {
+	    resolved.push_back( sc_bind_elem() );
+	} else {
+	    resolved.insert( resolved.end(), parent_vec.begin(),
+	                     parent_vec.end() );
 	}
     }
+    vec.swap( resolved );
 }
 
 
@@ -463,20 +448,37 @@ sc_port_base::complete_binding()
         return;
     }
 
-    // COMPLETE BINDING OF OUR PARENT PORTS SO THAT WE CAN USE THAT INFORMATION:
+    // REPLACE OUR PARENT PORTS BY THEIR INTERFACES:
 
-    int i = first_parent();
-    while( i >= 0 ) {
-        m_bind_info->vec[i]->parent->complete_binding();
-        insert_parent( i );
-        i = first_parent();
+    if( m_bind_info->has_parent ) {
+        resolve_parents();
+    }
+
+    // MAKE SURE THAT NO INTERFACE IS BOUND TWICE:
+
+    if( m_bind_info->size() > 1 ) {
+        std::vector<sc_interface*> ifaces;
+        ifaces.reserve( m_bind_info->size() );
+        for( int j = 0; j < m_bind_info->size(); ++ j ) {
+            if( m_bind_info->vec[j].iface != 0 ) {
+                ifaces.push_back( m_bind_info->vec[j].iface );
+            }
+        }
+        std::sort( ifaces.begin(), ifaces.end() );
+        for( std::size_t j = 1; j < ifaces.size(); ++ j ) {
+            if( ifaces[j] == ifaces[j - 1] ) {
+                report_error( SC_ID_BIND_IF_TO_PORT_,
+                              "interface already bound to port" );
+                // may continue, if suppressed
+            }
+        }
     }
 
     // LOOP OVER BINDING INFORMATION TO COMPLETE THE BINDING PROCESS:
 
     int size;
     for( int j = 0; j < m_bind_info->size(); ++ j ) {
-        sc_interface* iface = m_bind_info->vec[j]->iface;
+        sc_interface* iface = m_bind_info->vec[j].iface;
 
 	// if the interface is zero this was for an unbound port.
 	if ( iface == 0 ) continue;
@@ -710,8 +712,48 @@ sc_port_registry::construction_done()
 void
 sc_port_registry::complete_binding()
 {
+    // Complete the parents of each port before the port itself, in the
+    // order in which sc_port_base::complete_binding would recurse into
+    // them. Every port is completed once, and the recursion stays flat
+    // for long chains of port-to-port bindings.
+
+    typedef std::pair<sc_port_base*, std::size_t> frame;
+    std::vector<frame> stack;
+
     for( int i = size() - 1; i >= 0; -- i ) {
-        m_port_vec[i]->complete_binding();
+        if( m_port_vec[i]->m_bind_info->complete ) {
+            continue;
+        }
+        stack.push_back( frame( m_port_vec[i], 0 ) );
+        m_port_vec[i]->m_bind_info->resolving = true;
+
+        while( !stack.empty() ) {
+            sc_port_base* port = stack.back().first;
+            std::vector<sc_bind_elem>& vec = port->m_bind_info->vec;
+            std::size_t& k = stack.back().second;
+
+            while( k < vec.size() && ( vec[k].parent == 0 ||
+                   vec[k].parent->m_bind_info->complete ) ) {
+                ++ k;
+            }
+            if( k == vec.size() ) {
+                port->complete_binding();
+                port->m_bind_info->resolving = false;
+                stack.pop_back();
+                continue;
+            }
+
+            sc_port_base* parent = vec[k].parent;
+            if( parent->m_bind_info->resolving ) {
+                // the parent is bound to this port through its parents
+                port->report_error( SC_ID_BIND_PORT_TO_PORT_,
+                                    "cyclic binding" );
+                vec[k].parent = 0;
+                continue;
+            }
+            parent->m_bind_info->resolving = true;
+            stack.push_back( frame( parent, 0 ) );
+        }
     }
 }
 
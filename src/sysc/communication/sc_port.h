@@ -165,8 +165,7 @@ private:
 
 
     // support methods
-    int first_parent();
-    void insert_parent( int );
+    void resolve_parents();
 
     // called when construction is done
     void construction_done();
@@ -552,18 +551,7 @@ sc_port_b<IF>::add_interface( sc_interface* interface_ )
     IF* iface = dynamic_cast<IF*>( interface_ );
     sc_assert( iface != 0 );
 
-    // make sure that the interface is not already bound:
-
-    int if_n = size();
-    for ( int i = 0; i < if_n; i++ )
-    {
-        if ( iface == m_interface_vec[i] )
-        {
-            report_error( SC_ID_BIND_IF_TO_PORT_,
-                          "interface already bound to port" );
-            // may continue, if suppressed
-        }
-    }
+    // interfaces bound twice are reported by complete_binding
 
     // "bind" the interface and make sure our short cut for 0 is set up.
 
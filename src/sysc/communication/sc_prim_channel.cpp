@@ -33,9 +33,10 @@
 #include "sysc/kernel/sc_module.h"
 #include "sysc/kernel/sc_object_int.h"
 #include "sysc/communication/sc_host_mutex.h"
-#include "sysc/communication/sc_host_semaphore.h"
 
 #include <algorithm> // std::find
+#include <condition_variable>
+#include <mutex>
 
 namespace sc_core {
 
@@ -50,7 +51,9 @@ namespace sc_core {
 sc_prim_channel::sc_prim_channel()
 : sc_object( 0 ),
   m_registry( simcontext()->get_prim_channel_registry() ),
-  m_update_next_p( 0 ) 
+  m_update_next_p( 0 ),
+  m_async_next_p( 0 ),
+  m_async_queued( false )
 {
     m_registry->insert( *this );
 }
@@ -58,7 +61,9 @@ sc_prim_channel::sc_prim_channel()
 sc_prim_channel::sc_prim_channel( const char* name_ )
 : sc_object( name_ ),
   m_registry( simcontext()->get_prim_channel_registry() ),
-  m_update_next_p( 0 )
+  m_update_next_p( 0 ),
+  m_async_next_p( 0 ),
+  m_async_queued( false )
 {
     m_registry->insert( *this );
 }
@@ -144,6 +149,13 @@ sc_prim_channel::simulation_done()
 //
 //  Thread-safe list of pending external updates
 //  FOR INTERNAL USE ONLY!
+//
+//  The list is a lock-free stack of the requesting channels, linked through
+//  sc_prim_channel::m_async_next_p. A channel is pushed at most once until
+//  the kernel has accepted its update, further requests in between are
+//  covered by the same update. The kernel takes all pending requests at
+//  once, so the producers never wait for the kernel or for each other.
+//  The mutex is only taken to wake up the kernel, if it is suspended.
 // ----------------------------------------------------------------------------
 
 class sc_prim_channel_registry::async_update_list
@@ -152,45 +164,62 @@ public:
 
     bool pending() const
     {
-	return m_push_queue.size() != 0;
+        return m_push_head.load( std::memory_order_acquire ) != 0;
     }
 
     void suspend()
     {
         if( m_has_suspending_channels ) {
-            m_suspend_semaphore.wait();
-            m_suspend_semaphore.post(); // replace token
+            std::unique_lock<std::mutex> lock( m_wake_mutex );
+            m_waiting.store( true );
+            while( m_push_head.load() == 0 ) {
+                m_wake.wait( lock );
+            }
+            m_waiting.store( false, std::memory_order_relaxed );
         }
     }
 
     void append( sc_prim_channel& prim_channel_ )
     {
-        sc_scoped_lock lock( m_mutex );
-        m_push_queue.push_back( &prim_channel_ );
-        m_suspend_semaphore.post();
-        // return releases the mutex
+        // already queued, the pending update covers this request
+        if( prim_channel_.m_async_queued.exchange
+              ( true, std::memory_order_acq_rel ) )
+            return;
+
+        sc_prim_channel* head = m_push_head.load( std::memory_order_relaxed );
+        do {
+            prim_channel_.m_async_next_p = head;
+        } while( !m_push_head.compare_exchange_weak( head, &prim_channel_ ) );
+
+        if( m_waiting.load() ) {
+            std::lock_guard<std::mutex> lock( m_wake_mutex );
+            m_wake.notify_one();
+        }
     }
 
     void accept_updates()
     {
-	sc_assert( ! m_pop_queue.size() );
-	{
-	    sc_scoped_lock lock( m_mutex );
-	    m_push_queue.swap( m_pop_queue );
-	    // leaving the block releases the mutex
-	}
+        sc_prim_channel* list = m_push_head.exchange( 0 );
+
+        // restore the order of the requests
+        sc_prim_channel* prev = 0;
+        while( list ) {
+            sc_prim_channel* next = list->m_async_next_p;
+            list->m_async_next_p = prev;
+            prev = list;
+            list = next;
+        }
 
-	std::vector< sc_prim_channel* >::const_iterator
-	    it = m_pop_queue.begin(), end = m_pop_queue.end();
-	while( it!= end )
-	{
-	    // we use request_update instead of perform_update
-	    // to skip duplicates
-	    (*it++)->request_update();
-	    int sem_trywait = m_suspend_semaphore.trywait(); // this must never block !
-	    sc_assert( sem_trywait == 0 );
-	}
-	m_pop_queue.clear();
+        while( prev ) {
+            sc_prim_channel* next = prev->m_async_next_p;
+            prev->m_async_next_p = 0;
+            // new requests of this channel are queued again from here on
+            prev->m_async_queued.exchange( false, std::memory_order_acq_rel );
+            // we use request_update instead of perform_update
+            // to skip duplicates
+            prev->request_update();
+            prev = next;
+        }
     }
 
     void attach_suspending( sc_prim_channel& p )
@@ -218,13 +247,15 @@ public:
         // return releases the mutex
     }
 
-    async_update_list() : m_has_suspending_channels() {}
+    async_update_list()
+      : m_push_head( 0 ), m_waiting( false ), m_has_suspending_channels() {}
 
 private:
-    sc_host_mutex                   m_mutex;
-    sc_host_semaphore               m_suspend_semaphore;
-    std::vector< sc_prim_channel* > m_push_queue;
-    std::vector< sc_prim_channel* > m_pop_queue;
+    std::atomic<sc_prim_channel*>   m_push_head;   // pending requests
+    std::atomic<bool>               m_waiting;     // kernel is suspended
+    std::mutex                      m_wake_mutex;
+    std::condition_variable         m_wake;
+    sc_host_mutex                   m_mutex;       // guards the fields below
     std::vector< sc_prim_channel* > m_suspending_channels;
     bool                            m_has_suspending_channels;
 
@@ -305,6 +336,24 @@ sc_prim_channel_registry::async_request_update( sc_prim_channel& prim_channel_ )
     m_async_update_list_p->append( prim_channel_ );
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_prim_channel_registry::concurrent_request_update"
+// |
+// | This method queues an update request while method processes are being
+// | evaluated on several host threads (see sc_parallel_evaluator). The
+// | update list is shared between the workers, so it is protected by a mutex.
+// | Note that concurrent requests for the same channel are not supported,
+// | since this would mean multiple writers within the same delta cycle.
+// +----------------------------------------------------------------------------
+void
+sc_prim_channel_registry::concurrent_request_update(
+    sc_prim_channel& prim_channel_ )
+{
+    sc_scoped_lock lock( m_update_mutex );
+    prim_channel_.m_update_next_p = m_update_list_p;
+    m_update_list_p = &prim_channel_;
+}
+
 void
 sc_prim_channel_registry::async_attach_suspending(sc_prim_channel& p)
 {
@@ -370,6 +419,8 @@ sc_prim_channel_registry::sc_prim_channel_registry( sc_simcontext& simc_ )
   ,  m_simc( &simc_ )
   ,  m_update_list_end((sc_prim_channel*)(void*)this)
   ,  m_update_list_p((sc_prim_channel*)this)
+  ,  m_concurrent_updates(false)
+  ,  m_update_mutex()
 {
     m_async_update_list_p = new async_update_list();
 }
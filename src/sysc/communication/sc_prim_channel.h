@@ -32,6 +32,14 @@
 #include "sysc/kernel/sc_object.h"
 #include "sysc/kernel/sc_wait.h"
 #include "sysc/kernel/sc_wait_cthread.h"
+#include "sysc/communication/sc_host_mutex.h"
+
+#include <atomic>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::atomic
+#endif
 
 namespace sc_core {
 
@@ -216,6 +224,8 @@ private:
 
     sc_prim_channel_registry* m_registry;          // Update list manager.
     sc_prim_channel*          m_update_next_p;     // Next entry in update list.
+    sc_prim_channel*          m_async_next_p;      // Next entry in async list.
+    std::atomic<bool>         m_async_queued;      // In async list.
 };
 
 
@@ -229,6 +239,7 @@ private:
 class sc_prim_channel_registry
 {
     friend class sc_simcontext;
+    friend class sc_parallel_evaluator;
 
 public:
 
@@ -241,6 +252,7 @@ public:
 
     inline void request_update( sc_prim_channel& );
     void async_request_update( sc_prim_channel& );
+    SC_API void concurrent_request_update( sc_prim_channel& );
 
     bool pending_updates() const
     { 
@@ -300,6 +312,8 @@ private:
     sc_simcontext*                m_simc;                // simulator context.
     sc_prim_channel*              m_update_list_end;     // update list terminator.
     sc_prim_channel*              m_update_list_p;       // internal updates.
+    bool                          m_concurrent_updates;  // parallel evaluation.
+    sc_host_mutex                 m_update_mutex;        // guards parallel updates.
 };
 
 
@@ -316,6 +330,10 @@ inline
 void
 sc_prim_channel_registry::request_update( sc_prim_channel& prim_channel_ )
 {
+    if( SC_UNLIKELY_( m_concurrent_updates ) ) {
+        concurrent_request_update( prim_channel_ );
+        return;
+    }
     prim_channel_.m_update_next_p = m_update_list_p;
     m_update_list_p = &prim_channel_;
 }
@@ -375,6 +393,10 @@ sc_prim_channel::perform_update()
 
 } // namespace sc_core
 
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
 
 /*****************************************************************************
 
@@ -32,6 +32,7 @@
 #include "sysc/communication/sc_signal.h"
 #include "sysc/kernel/sc_reset.h"
 #include "sysc/kernel/sc_simcontext_int.h"
+#include "sysc/tracing/sc_trace_file_base.h"
 
 #include <sstream>
 
@@ -96,6 +97,21 @@ sc_writer_policy_check_port::
 sc_signal_channel::~sc_signal_channel()
 {
     delete m_change_event_p;
+    delete m_trace_notifier_p;
+}
+
+// Trace files of other implementations keep polling the value.
+
+void
+sc_signal_channel::add_trace_notifier( sc_trace_file* tf,
+                                       std::size_t first ) const
+{
+    sc_trace_file_base* file = dynamic_cast<sc_trace_file_base*>( tf );
+    if( !file )
+        return;
+    if( !m_trace_notifier_p )
+        m_trace_notifier_p = new sc_trace_notifier();
+    file->add_trace_notifier( *m_trace_notifier_p, first );
 }
 
 void
@@ -161,6 +177,8 @@ sc_signal_channel::do_update()
 {
     notify_next_delta( m_change_event_p );
     m_change_stamp = simcontext()->change_stamp();
+    if( SC_UNLIKELY_( m_trace_notifier_p ) )
+        m_trace_notifier_p->notify();
 }
 
 // IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
@@ -42,6 +42,8 @@
 
 namespace sc_core {
 
+class sc_trace_notifier;
+
 inline
 bool
 sc_writer_policy_check_write::check_write( sc_object* target, bool /*value_changed*/ )
@@ -89,6 +91,7 @@ protected:
       : sc_prim_channel( name_ )
       , m_change_event_p( 0 )
       , m_change_stamp( ~sc_dt::UINT64_ONE )
+      , m_trace_notifier_p( 0 )
     {}
 
 public:
@@ -111,6 +114,10 @@ public:
     bool event() const
         { return simcontext()->event_occurred(m_change_stamp); }
 
+    // report the updates to the traces of the trace file from index `first'
+    // on (implementation-defined, see sc_trace_channel_updates)
+    void add_trace_notifier( sc_trace_file* tf, std::size_t first ) const;
+
 protected:
     void do_update();
 
@@ -128,6 +135,8 @@ protected:
     mutable sc_event* m_change_event_p;  // value change event if present.
     sc_dt::uint64     m_change_stamp;    // delta of last event
 
+    mutable sc_trace_notifier* m_trace_notifier_p; // if traced.
+
 private:
     // disabled
     sc_signal_channel( const sc_signal_channel& ) /* = delete */;
@@ -2582,9 +2582,7 @@ sc_subref_r<X>::get_word( int i ) const
     } else {
 	n1 = m_lo + i * SC_DIGIT_SIZE;
 	n2 = sc_min( n1 + SC_DIGIT_SIZE, m_hi + 1 );
-	for( int n = n1; n < n2; n ++ ) {
-	    result |= (m_obj[n].value() & SC_DIGIT_ONE) << k ++;
-	}
+	result = get_word_bits_( m_obj, n1, n2 - n1, false );
     }
     return result;
 }
@@ -2608,11 +2606,7 @@ sc_subref_r<X>::set_word( int i, sc_digit w )
     } else {
 	n1 = m_lo + i * SC_DIGIT_SIZE;
 	n2 = sc_min( n1 + SC_DIGIT_SIZE, m_hi + 1 );
-	for( int n = n1; n < n2; n ++ ) {
-	    m_obj.set_bit( n, value_type(
-	                                ( (w >> k ++) & SC_DIGIT_ONE ) |
-					( m_obj[n].value() & SC_DIGIT_TWO ) ) );
-	}
+	set_word_bits_( m_obj, n1, n2 - n1, w, false );
     }
 }
 
@@ -2635,9 +2629,7 @@ sc_subref_r<X>::get_cword( int i ) const
     } else {
 	n1 = m_lo + i * SC_DIGIT_SIZE;
 	n2 = sc_min( n1 + SC_DIGIT_SIZE, m_hi + 1 );
-	for( int n = n1; n < n2; n ++ ) {
-	    result |= ((m_obj[n].value() & SC_DIGIT_TWO) >> 1) << k ++;
-	}
+	result = get_word_bits_( m_obj, n1, n2 - n1, true );
     }
     return result;
 }
@@ -2661,10 +2653,12 @@ sc_subref_r<X>::set_cword( int i, sc_digit w )
     } else {
 	n1 = m_lo + i * SC_DIGIT_SIZE;
 	n2 = sc_min( n1 + SC_DIGIT_SIZE, m_hi + 1 );
-	for( int n = n1; n < n2; n ++ ) {
-	    m_obj.set_bit( n, value_type(
-	                                ( ((w >> k ++) & SC_DIGIT_ONE) << 1 ) |
-					( m_obj[n].value() & SC_DIGIT_ONE ) ) );
+	if( std::is_same<value_type, bool>::value ) {
+	    // bit vectors have no control bits, their 'Z' and 'X' bits are 1
+	    w |= get_word_bits_( m_obj, n1, n2 - n1, false );
+	    set_word_bits_( m_obj, n1, n2 - n1, w, false );
+	} else {
+	    set_word_bits_( m_obj, n1, n2 - n1, w, true );
 	}
     }
 }
@@ -105,23 +105,31 @@ sc_bv_base::assign_from_string( const std::string& s )
     int len = m_len;
     int s_len = s.length() - 1;
     int min_len = sc_min( len, s_len );
-    int i = 0;
-    for( ; i < min_len; ++ i ) {
-        char c = s[s_len - i - 1];
-        if( c != '0' && c != '1' ) {
-            SC_REPORT_ERROR( sc_core::SC_ID_CANNOT_CONVERT_,
-                "string can contain only '0' and '1' characters" );
-            // may continue, if suppressed
-            c = '0';
-        }
-        set_bit( i, sc_logic_value_t( c - '0' ) );
-    }
     // if formatted, fill the rest with sign(s), otherwise fill with zeros
-    sc_logic_value_t fill = (s[s_len] == 'F' ? sc_logic_value_t( s[0] - '0' )
-                                             : sc_logic_value_t( 0 ));
-    for( ; i < len; ++ i ) {
-        set_bit( i, fill );
+    sc_digit fill = (s[s_len] == 'F' && s[0] == '1') ? ~SC_DIGIT_ZERO
+                                                     : SC_DIGIT_ZERO;
+    const char* c_p = s.c_str() + s_len - 1; // least significant character
+    int sz = m_size;
+    for( int wi = 0; wi < sz; ++ wi ) {
+        int bn = sc_max( 0, sc_min( SC_DIGIT_SIZE, min_len - wi * SC_DIGIT_SIZE ) );
+        sc_digit dw = SC_DIGIT_ZERO;
+        for( int bi = 0; bi < bn; ++ bi, -- c_p ) {
+            char c = *c_p;
+            if( c != '0' && c != '1' ) {
+                SC_REPORT_ERROR( sc_core::SC_ID_CANNOT_CONVERT_,
+                    "string can contain only '0' and '1' characters" );
+                // may continue, if suppressed
+                c = '0';
+            }
+            dw |= (sc_digit)( c - '0' ) << bi;
+        }
+        if( bn < SC_DIGIT_SIZE ) {
+            dw |= fill & ~( bn ? ~SC_DIGIT_ZERO >> (SC_DIGIT_SIZE - bn)
+                               : SC_DIGIT_ZERO );
+        }
+        m_data[wi] = dw;
     }
+    clean_tail();
 }
 
 
@@ -116,20 +116,7 @@ void
 sc_lv_base::assign_from_string( const std::string& s )
 {
     // s must have been converted to bin
-    int len = m_len;
-    int s_len = s.length() - 1;
-    int min_len = sc_min( len, s_len );
-    int i = 0;
-    for( ; i < min_len; ++ i ) {
-	char c = s[s_len - i - 1];
-	set_bit( i, sc_logic::char_to_logic[(int)c] );
-    }
-    // if formatted, fill the rest with sign(s), otherwise fill with zeros
-    sc_logic_value_t fill = (s[s_len] == 'F' ? sc_logic_value_t( s[0] - '0' )
-		                             : sc_logic_value_t( 0 ));
-    for( ; i < len; ++ i ) {
-	set_bit( i, fill );
-    }
+    assign_bin_string_( *this, s );
 }
 
 
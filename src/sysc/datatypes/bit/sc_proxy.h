@@ -62,6 +62,8 @@
 #define SC_PROXY_H
 
 
+#include <type_traits>
+
 #include "sysc/kernel/sc_cmnhdr.h"
 #include "sysc/utils/sc_iostream.h"
 #include "sysc/datatypes/int/sc_signed.h"
@@ -737,6 +739,134 @@ extend_sign_w_( X& x, int wi, bool sign )
     }
 }
 
+// mask of the bits of word wi of x that lie within its length
+
+template <class X>
+inline
+sc_digit
+word_mask_( const X& x, int wi )
+{
+    int bn = x.length() - wi * SC_DIGIT_SIZE;
+    return bn < SC_DIGIT_SIZE ? ~SC_DIGIT_ZERO >> (SC_DIGIT_SIZE - bn)
+                              : ~SC_DIGIT_ZERO;
+}
+
+// the n bits, 0 < n <= SC_DIGIT_SIZE, of the data or control words of x
+// starting at bit lo
+
+template <class X>
+inline
+sc_digit
+get_word_bits_( const X& x, int lo, int n, bool control )
+{
+    int wi = lo / SC_DIGIT_SIZE;
+    int bi = lo % SC_DIGIT_SIZE;
+    sc_digit w = (control ? x.get_cword( wi ) : x.get_word( wi )) >> bi;
+    if( bi + n > SC_DIGIT_SIZE ) {
+	w |= (control ? x.get_cword( wi + 1 ) : x.get_word( wi + 1 ))
+	     << (SC_DIGIT_SIZE - bi);
+    }
+    return n < SC_DIGIT_SIZE ? w & (~SC_DIGIT_ZERO >> (SC_DIGIT_SIZE - n)) : w;
+}
+
+// replaces the n bits, 0 < n <= SC_DIGIT_SIZE, of the data or control words
+// of x starting at bit lo with the low order bits of w
+
+template <class X>
+inline
+void
+set_word_bits_( X& x, int lo, int n, sc_digit w, bool control )
+{
+    int wi = lo / SC_DIGIT_SIZE;
+    int bi = lo % SC_DIGIT_SIZE;
+    sc_digit mask = n < SC_DIGIT_SIZE ? ~SC_DIGIT_ZERO >> (SC_DIGIT_SIZE - n)
+                                      : ~SC_DIGIT_ZERO;
+    w &= mask;
+    sc_digit old_w = control ? x.get_cword( wi ) : x.get_word( wi );
+    sc_digit new_w = (old_w & ~(mask << bi)) | (w << bi);
+    if( control ) {
+	x.set_cword( wi, new_w );
+    } else {
+	x.set_word( wi, new_w );
+    }
+    if( bi + n > SC_DIGIT_SIZE ) {
+	int nbi = SC_DIGIT_SIZE - bi;
+	old_w = control ? x.get_cword( wi + 1 ) : x.get_word( wi + 1 );
+	new_w = (old_w & ~(mask >> nbi)) | (w >> nbi);
+	if( control ) {
+	    x.set_cword( wi + 1, new_w );
+	} else {
+	    x.set_word( wi + 1, new_w );
+	}
+    }
+}
+
+// assigns the len_a low order bits of the digits at digits_p, extended with
+// sign
+
+template <class X>
+inline
+void
+assign_digits_( X& x, const sc_digit* digits_p, int len_a, bool sign )
+{
+    int len_x = x.length();
+    if ( len_a > len_x ) len_a = len_x;
+    int wn = len_a / SC_DIGIT_SIZE;
+    int bn = len_a % SC_DIGIT_SIZE;
+    int i = 0;
+    for( ; i < wn; ++ i ) {
+	set_words_( x, i, digits_p[i], SC_DIGIT_ZERO );
+    }
+    if( bn != 0 ) {
+	sc_digit mask = ~SC_DIGIT_ZERO >> (SC_DIGIT_SIZE - bn);
+	set_words_( x, i, (digits_p[i] & mask) | (sign ? ~mask : SC_DIGIT_ZERO),
+		    SC_DIGIT_ZERO );
+	++ i;
+    }
+    extend_sign_w_( x, i, sign );
+    x.clean_tail();
+}
+
+// assigns a string converted by convert_to_bin(), the words are built from
+// the characters before they are stored
+
+template <class X>
+inline
+void
+assign_bin_string_( X& x, const std::string& s )
+{
+    // bit vectors store 'Z' and 'X' as 1, like their set_bit() does
+    const bool logic =
+        !std::is_same<typename sc_proxy_traits<X>::value_type, bool>::value;
+    int len = x.length();
+    int s_len = s.length() - 1;
+    int min_len = sc_min( len, s_len );
+    // if formatted, fill the rest with sign(s), otherwise fill with zeros
+    int fill = (s[s_len] == 'F' ? sc_logic::char_to_logic[(int)s[0]] : 0);
+    sc_digit fill_dw = (fill & 1) ? ~SC_DIGIT_ZERO : SC_DIGIT_ZERO;
+    sc_digit fill_cw = (logic && (fill & 2)) ? ~SC_DIGIT_ZERO : SC_DIGIT_ZERO;
+    const char* c_p = s.c_str() + s_len - 1; // least significant character
+    int sz = x.size();
+    for( int wi = 0; wi < sz; ++ wi ) {
+	int bn = sc_max( 0, sc_min( SC_DIGIT_SIZE, min_len - wi * SC_DIGIT_SIZE ) );
+	sc_digit dw = SC_DIGIT_ZERO;
+	sc_digit cw = SC_DIGIT_ZERO;
+	for( int bi = 0; bi < bn; ++ bi, -- c_p ) {
+	    sc_digit v = sc_logic::char_to_logic[(int)*c_p];
+	    dw |= (logic ? v & SC_DIGIT_ONE : v != 0) << bi;
+	    cw |= (v >> 1) << bi;
+	}
+	if( bn < SC_DIGIT_SIZE ) {
+	    sc_digit mask = bn ? ~SC_DIGIT_ZERO >> (SC_DIGIT_SIZE - bn)
+	                       : SC_DIGIT_ZERO;
+	    dw |= fill_dw & ~mask;
+	    cw |= fill_cw & ~mask;
+	}
+	set_words_( x, wi, dw, logic ? cw : SC_DIGIT_ZERO );
+    }
+    x.clean_tail();
+}
+
 
 // assignment functions
 
@@ -789,18 +919,9 @@ inline
 void
 assign_v_( sc_proxy<X>& px, const sc_int_base& a )
 {
-    X& x = px.back_cast();
-	int i;
-    bool sign = a < 0;
-    int len_x = x.length();
-    int len_a = a.length();
-    if ( len_a > len_x ) len_a = len_x;
-    for( i = 0 ; i < len_a; ++ i ) {
-        x.set_bit( i, sc_logic_value_t( (bool) a[i] ) );
-    }
-    for( ; i < len_x; ++ i ) {
-        x.set_bit( i, sc_logic_value_t( sign ) );
-    }
+    uint64 v = (uint64) a.value();
+    sc_digit digits[2] = { (sc_digit) v, (sc_digit) (v >> SC_DIGIT_SIZE) };
+    assign_digits_( px.back_cast(), digits, a.length(), a < 0 );
 }
 
 template <class X>
@@ -808,18 +929,7 @@ inline
 void
 assign_v_( sc_proxy<X>& px, const sc_signed& a )
 {
-    X& x = px.back_cast();
-	int i;
-    bool sign = a.is_negative();
-    int len_x = x.length();
-    int len_a = a.length();
-    if ( len_a > len_x ) len_a = len_x;
-    for( i = 0 ; i < len_a; ++ i ) {
-        x.set_bit( i, sc_logic_value_t( (bool) a[i] ) );
-    }
-    for( ; i < len_x; ++ i ) {
-        x.set_bit( i, sc_logic_value_t( sign ) );
-    }
+    assign_digits_( px.back_cast(), a.get_raw(), a.length(), a.is_negative() );
 }
 
 template <class X>
@@ -827,17 +937,9 @@ inline
 void
 assign_v_( sc_proxy<X>& px, const sc_uint_base& a )
 {
-    X& x = px.back_cast();
-	int i;
-    int len_x = x.length();
-    int len_a = a.length();
-    if ( len_a > len_x ) len_a = len_x;
-    for( i = 0 ; i < len_a; ++ i ) {
-        x.set_bit( i, sc_logic_value_t( (bool) a[i] ) );
-    }
-    for( ; i < len_x; ++ i ) {
-        x.set_bit( i, sc_logic_value_t( false ) );
-    }
+    uint64 v = (uint64) a.value();
+    sc_digit digits[2] = { (sc_digit) v, (sc_digit) (v >> SC_DIGIT_SIZE) };
+    assign_digits_( px.back_cast(), digits, a.length(), false );
 }
 
 template <class X>
@@ -845,17 +947,7 @@ inline
 void
 assign_v_( sc_proxy<X>& px, const sc_unsigned& a )
 {
-    X& x = px.back_cast();
-	int i;
-    int len_x = x.length();
-    int len_a = a.length();
-    if ( len_a > len_x ) len_a = len_x;
-    for( i = 0 ; i < len_a; ++ i ) {
-        x.set_bit( i, sc_logic_value_t( (bool) a[i] ) );
-    }
-    for( ; i < len_x; ++ i ) {
-        x.set_bit( i, sc_logic_value_t( false ) );
-    }
+    assign_digits_( px.back_cast(), a.get_raw(), a.length(), false );
 }
 
 
@@ -867,21 +959,7 @@ X&
 sc_proxy<X>::assign_( const char* a )
 {
     X& x = back_cast();
-    std::string s = convert_to_bin( a );
-    int len = x.length();
-    int s_len = s.length() - 1;
-    int min_len = sc_min( len, s_len );
-    int i = 0;
-    for( ; i < min_len; ++ i ) {
-	char c = s[s_len - i - 1];
-	x.set_bit( i, sc_logic::char_to_logic[(int)c] );
-    }
-    // if formatted, fill the rest with sign(s), otherwise fill with zeros
-    sc_logic_value_t fill = (s[s_len] == 'F' ? sc_logic_value_t( s[0] - '0' )
-		                             : sc_logic_value_t( 0 ));
-    for( ; i < len; ++ i ) {
-	x.set_bit( i, fill );
-    }
+    assign_bin_string_( x, convert_to_bin( a ) );
     return x;
 }
 
@@ -893,8 +971,15 @@ sc_proxy<X>::assign_( const bool* a )
     // the length of 'a' must be larger than or equal to the length of 'this'
     X& x = back_cast();
     int len = x.length();
-    for( int i = 0; i < len; ++ i ) {
-	x.set_bit( i, sc_logic_value_t( a[i] ) );
+    int sz = x.size();
+    for( int wi = 0; wi < sz; ++ wi ) {
+	int bn = sc_min( SC_DIGIT_SIZE, len - wi * SC_DIGIT_SIZE );
+	const bool* a_p = a + wi * SC_DIGIT_SIZE;
+	sc_digit dw = SC_DIGIT_ZERO;
+	for( int bi = 0; bi < bn; ++ bi ) {
+	    dw |= (sc_digit) a_p[bi] << bi;
+	}
+	set_words_( x, wi, dw, SC_DIGIT_ZERO );
     }
     return x;
 }
@@ -906,9 +991,21 @@ sc_proxy<X>::assign_( const sc_logic* a )
 {
     // the length of 'a' must be larger than or equal to the length of 'this'
     X& x = back_cast();
+    const bool logic =
+        !std::is_same<typename sc_proxy_traits<X>::value_type, bool>::value;
     int len = x.length();
-    for( int i = 0; i < len; ++ i ) {
-	x.set_bit( i, a[i].value() );
+    int sz = x.size();
+    for( int wi = 0; wi < sz; ++ wi ) {
+	int bn = sc_min( SC_DIGIT_SIZE, len - wi * SC_DIGIT_SIZE );
+	const sc_logic* a_p = a + wi * SC_DIGIT_SIZE;
+	sc_digit dw = SC_DIGIT_ZERO;
+	sc_digit cw = SC_DIGIT_ZERO;
+	for( int bi = 0; bi < bn; ++ bi ) {
+	    sc_digit v = a_p[bi].value();
+	    dw |= (logic ? v & SC_DIGIT_ONE : v != 0) << bi;
+	    cw |= (v >> 1) << bi;
+	}
+	set_words_( x, wi, dw, logic ? cw : SC_DIGIT_ZERO );
     }
     return x;
 }
@@ -1287,13 +1384,20 @@ inline
 typename sc_proxy<X>::value_type
 sc_proxy<X>::and_reduce() const
 {
+    // 0 if any bit is 0, otherwise X if any bit is Z or X
     const X& x = back_cast();
-    value_type result = value_type( 1 );
-    int len = x.length();
-    for( int i = 0; i < len; ++ i ) {
-	result = sc_logic::and_table[result][x.get_bit( i )];
+    sc_digit unknown = SC_DIGIT_ZERO;
+    int sz = x.size();
+    for( int i = 0; i < sz; ++ i ) {
+	sc_digit x_dw, x_cw;
+	get_words_( x, i, x_dw, x_cw );
+	sc_digit mask = word_mask_( x, i );
+	if( ~x_dw & ~x_cw & mask ) {
+	    return value_type( Log_0 );
+	}
+	unknown |= x_cw & mask;
     }
-    return result;
+    return unknown ? value_type( Log_X ) : value_type( Log_1 );
 }
 
 template <class X>
@@ -1301,13 +1405,20 @@ inline
 typename sc_proxy<X>::value_type
 sc_proxy<X>::or_reduce() const
 {
+    // 1 if any bit is 1, otherwise X if any bit is Z or X
     const X& x = back_cast();
-    value_type result = value_type( 0 );
-    int len = x.length();
-    for( int i = 0; i < len; ++ i ) {
-	result = sc_logic::or_table[result][x.get_bit( i )];
+    sc_digit unknown = SC_DIGIT_ZERO;
+    int sz = x.size();
+    for( int i = 0; i < sz; ++ i ) {
+	sc_digit x_dw, x_cw;
+	get_words_( x, i, x_dw, x_cw );
+	sc_digit mask = word_mask_( x, i );
+	if( x_dw & ~x_cw & mask ) {
+	    return value_type( Log_1 );
+	}
+	unknown |= x_cw & mask;
     }
-    return result;
+    return unknown ? value_type( Log_X ) : value_type( Log_0 );
 }
 
 template <class X>
@@ -1315,13 +1426,23 @@ inline
 typename sc_proxy<X>::value_type
 sc_proxy<X>::xor_reduce() const
 {
+    // X if any bit is Z or X, otherwise the parity of the bits
     const X& x = back_cast();
-    value_type result = value_type( 0 );
-    int len = x.length();
-    for( int i = 0; i < len; ++ i ) {
-	result = sc_logic::xor_table[result][x.get_bit( i )];
+    sc_digit parity = SC_DIGIT_ZERO;
+    int sz = x.size();
+    for( int i = 0; i < sz; ++ i ) {
+	sc_digit x_dw, x_cw;
+	get_words_( x, i, x_dw, x_cw );
+	sc_digit mask = word_mask_( x, i );
+	if( x_cw & mask ) {
+	    return value_type( Log_X );
+	}
+	parity ^= x_dw & mask;
+    }
+    for( int shift = SC_DIGIT_SIZE / 2; shift > 0; shift /= 2 ) {
+	parity ^= parity >> shift;
     }
-    return result;
+    return value_type( sc_logic_value_t( parity & SC_DIGIT_ONE ) );
 }
 
 
@@ -1387,9 +1508,23 @@ sc_proxy<X>::to_string() const
 {
     const X& x = back_cast();
     int len = x.length();
-    std::string s; // ( len + 1 );
-    for( int i = 0; i < len; ++ i ) {
-	s += sc_logic::logic_to_char[x.get_bit( len - i - 1 )];
+    std::string s( len, '0' );
+    int sz = x.size();
+    for( int wi = 0; wi < sz; ++ wi ) {
+	sc_digit x_dw, x_cw;
+	get_words_( x, wi, x_dw, x_cw );
+	int bn = sc_min( SC_DIGIT_SIZE, len - wi * SC_DIGIT_SIZE );
+	char* c_p = &s[len - wi * SC_DIGIT_SIZE - 1];
+	if( x_cw == SC_DIGIT_ZERO ) {
+	    for( int bi = 0; bi < bn; ++ bi, -- c_p ) {
+		*c_p = (char)( '0' + ((x_dw >> bi) & SC_DIGIT_ONE) );
+	    }
+	} else {
+	    for( int bi = 0; bi < bn; ++ bi, -- c_p ) {
+		*c_p = sc_logic::logic_to_char[((x_dw >> bi) & SC_DIGIT_ONE) |
+		                               (((x_cw >> bi) & SC_DIGIT_ONE) << 1)];
+	    }
+	}
     }
     return s;
 }
@@ -70,6 +70,8 @@
 namespace sc_core {
 	class vcd_sc_fxnum_trace;
 	class vcd_sc_fxnum_fast_trace;
+	class fst_sc_fxnum_trace;
+	class fst_sc_fxnum_fast_trace;
 	class wif_sc_fxnum_trace;
 	class wif_sc_fxnum_fast_trace;
 }
@@ -625,6 +627,7 @@ class SC_API sc_fxnum
     friend class sc_fxnum_fast_subref;
 
     friend class sc_core::vcd_sc_fxnum_trace;
+    friend class sc_core::fst_sc_fxnum_trace;
     friend class sc_core::wif_sc_fxnum_trace;
 
 protected:
@@ -1054,6 +1057,7 @@ class SC_API sc_fxnum_fast
     friend class sc_fxnum_fast_subref_r;
 
     friend class sc_core::vcd_sc_fxnum_fast_trace;
+    friend class sc_core::fst_sc_fxnum_fast_trace;
     friend class sc_core::wif_sc_fxnum_fast_trace;
 
 protected:
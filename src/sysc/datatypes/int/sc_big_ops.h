@@ -107,6 +107,13 @@ sc_big_add( RESULT& result, const LEFT&  left, const RIGHT& right )
 	*result_p = (sc_digit)result_value;
 	result_p[1] = (result_value >> BITS_PER_DIGIT);
     }
+#if defined(SC_BIGINT_CONFIG_NATIVE_INT128)
+    else if ( 4 > RESULT::HOD ) {
+	vector_store_128<RESULT::HOD>( vector_load_128<LEFT::HOD>( left.get_digits() ) +
+	                               vector_load_128<RIGHT::HOD>( right.get_digits() ),
+	                               result.get_digits() );
+    }
+#endif // SC_BIGINT_CONFIG_NATIVE_INT128
     else if ( (int)LEFT::HOD >= (int)RIGHT::HOD ) {
 	vector_add( LEFT::HOD,   left.get_digits(), 
 		    RIGHT::HOD,  right.get_digits(), 
@@ -501,7 +508,7 @@ sc_big_divide( RESULT& result, const LEFT&  left, const RIGHT& right )
 {
     bool ok;
 
-    if ( 0 == RESULT::HOD ) {
+    if ( 0 == RESULT::HOD && 0 == RIGHT::HOD ) {
         typename LEFT::HOD_TYPE  left_value = *left.get_digits();
         typename RIGHT::HOD_TYPE right_value = *right.get_digits();
 	if ( 0 != right_value ) {
@@ -541,6 +548,27 @@ sc_big_divide( RESULT& result, const LEFT&  left, const RIGHT& right )
 	    ok = false;
 	}
     }
+#if defined(SC_BIGINT_CONFIG_NATIVE_INT128)
+    else if ( 4 > RESULT::HOD && 4 > LEFT::HOD && 4 > RIGHT::HOD ) {
+	uint128 left_value = vector_load_128<LEFT::HOD>( left.get_digits() );
+	uint128 right_value = vector_load_128<RIGHT::HOD>( right.get_digits() );
+	if ( 0 != right_value ) {
+
+	    // Operate on the magnitudes, the quotient is negative if just one operand is:
+
+	    const bool left_minus = 0 > (int128)left_value;
+	    const bool right_minus = 0 > (int128)right_value;
+	    uint128    result_value = ( left_minus ? -left_value : left_value ) /
+	                              ( right_minus ? -right_value : right_value );
+	    vector_store_128<RESULT::HOD>( left_minus != right_minus ? -result_value : result_value,
+	                                   result.get_digits() );
+	    ok = true;
+	}
+	else {
+	    ok = false;
+	}
+    }
+#endif // SC_BIGINT_CONFIG_NATIVE_INT128
     else {
 	ok = vector_divide<LEFT::SIGNED,RIGHT::SIGNED>( LEFT::DIGITS_N,
 			                                left.get_digits(), 
@@ -617,7 +645,7 @@ sc_big_modulo( RESULT& result, const LEFT& left, const RIGHT& right )
 {
     bool ok; // true if operation was okay, false if divide by zero.
 
-    if ( 0 == RESULT::HOD ) {
+    if ( 0 == RESULT::HOD && 0 == LEFT::HOD && 0 == RIGHT::HOD ) {
         typename LEFT::HOD_TYPE  left_value = *left.get_digits();
         typename RIGHT::HOD_TYPE right_value = *right.get_digits();
 	if ( right_value != 0 ) {
@@ -657,6 +685,27 @@ sc_big_modulo( RESULT& result, const LEFT& left, const RIGHT& right )
 	    ok = false;
 	}
     }
+#if defined(SC_BIGINT_CONFIG_NATIVE_INT128)
+    else if ( 4 > RESULT::HOD && 4 > LEFT::HOD && 4 > RIGHT::HOD ) {
+	uint128 left_value = vector_load_128<LEFT::HOD>( left.get_digits() );
+	uint128 right_value = vector_load_128<RIGHT::HOD>( right.get_digits() );
+	if ( 0 != right_value ) {
+
+	    // Operate on the magnitudes, the remainder takes the sign of the numerator:
+
+	    const bool left_minus = 0 > (int128)left_value;
+	    const bool right_minus = 0 > (int128)right_value;
+	    uint128    result_value = ( left_minus ? -left_value : left_value ) %
+	                              ( right_minus ? -right_value : right_value );
+	    vector_store_128<RESULT::HOD>( left_minus ? -result_value : result_value,
+	                                   result.get_digits() );
+	    ok = true;
+	}
+	else {
+	    ok = false;
+	}
+    }
+#endif // SC_BIGINT_CONFIG_NATIVE_INT128
     else {
 
         ok = vector_divide<LEFT::SIGNED,RIGHT::SIGNED>( LEFT::DIGITS_N,
@@ -706,7 +755,7 @@ operator % ( const sc_bigint<WL>& numer, const sc_biguint<WR>& denom )
 
 template<int WL, int WR>
 inline
-const typename sc_big_op_info<WL,false,WR,true>::mod_result
+const typename sc_big_op_info<WL,false,WR,false>::mod_result
 operator % ( const sc_biguint<WL>& numer, const sc_biguint<WR>& denom )
 {
     typename sc_big_op_info<WL,false,WR,false>::mod_result result(0, 0);
@@ -765,9 +814,18 @@ sc_big_multiply( RESULT& result, const LEFT& left, const RIGHT& right )
 	*result_p = (sc_digit)result_value;
 	result_p[1] = (result_value >> BITS_PER_DIGIT);
     }
-    vector_multiply( LEFT::HOD,   left.get_digits(), 
-		     RIGHT::HOD,  right.get_digits(), 
-		     RESULT::HOD, result.get_digits() );
+#if defined(SC_BIGINT_CONFIG_NATIVE_INT128)
+    else if ( 4 > RESULT::HOD ) {
+	vector_store_128<RESULT::HOD>( vector_load_128<LEFT::HOD>( left.get_digits() ) *
+	                               vector_load_128<RIGHT::HOD>( right.get_digits() ),
+	                               result.get_digits() );
+    }
+#endif // SC_BIGINT_CONFIG_NATIVE_INT128
+    else {
+	vector_multiply( LEFT::HOD,   left.get_digits(), 
+			 RIGHT::HOD,  right.get_digits(), 
+			 RESULT::HOD, result.get_digits() );
+    }
 }
 
 template<int WL, int WR>
@@ -860,6 +918,13 @@ sc_big_subtract( RESULT& result, const LEFT&  left, const RIGHT& right )
 	*result_p = (sc_digit)result_value;
 	result_p[1] = (result_value >> BITS_PER_DIGIT);
     }
+#if defined(SC_BIGINT_CONFIG_NATIVE_INT128)
+    else if ( 4 > RESULT::HOD ) {
+	vector_store_128<RESULT::HOD>( vector_load_128<LEFT::HOD>( left.get_digits() ) -
+	                               vector_load_128<RIGHT::HOD>( right.get_digits() ),
+	                               result.get_digits() );
+    }
+#endif // SC_BIGINT_CONFIG_NATIVE_INT128
     else if ( (const int)LEFT::HOD > (const int)RIGHT::HOD ) {
 	vector_subtract_shorter( LEFT::HOD,
 		                 left.get_digits(), 
@@ -918,6 +983,70 @@ operator - ( const sc_biguint<WL>& left, const sc_biguint<WR>& right )
     return result;
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_big*int Comparisons"
+// | 
+// | These inline operators implement comparisons of sc_bigint and sc_biguint
+// | data types. Since the widths of the operands are known at compile time 
+// | values that fit in 128 bits are compared as native integers when 
+// | SC_BIGINT_CONFIG_NATIVE_INT128 is defined.
+// |
+// | Arguments:
+// |     left  = first operand of the comparison.
+// |     right = second operand of the comparison.
+// | Result:
+// |     -1 if left < right.
+// |      0 if left == right.
+// |     +1 if left > right.
+// +----------------------------------------------------------------------------
+template<typename LEFT, typename RIGHT>
+inline 
+int 
+sc_big_compare( const LEFT& left, const RIGHT& right )
+{
+#if defined(SC_BIGINT_CONFIG_NATIVE_INT128)
+    if ( 4 > LEFT::HOD && 4 > RIGHT::HOD ) {
+	const int128 left_value = (int128)vector_load_128<LEFT::HOD>( left.get_digits() );
+	const int128 right_value = (int128)vector_load_128<RIGHT::HOD>( right.get_digits() );
+	return left_value < right_value ? -1 : ( left_value == right_value ? 0 : 1 );
+    }
+#endif // SC_BIGINT_CONFIG_NATIVE_INT128
+    return vector_compare<LEFT::SIGNED,RIGHT::SIGNED>( LEFT::HOD,
+                                                       left.get_digits(),
+                                                       RIGHT::HOD,
+                                                       right.get_digits() );
+}
+
+#define SC_BIG_COMPARE_OPS(OP) \
+    template<int WL, int WR> \
+    inline \
+    bool operator OP ( const sc_bigint<WL>& left, const sc_bigint<WR>& right ) \
+	{ return sc_big_compare( left, right ) OP 0; } \
+     \
+    template<int WL, int WR> \
+    inline \
+    bool operator OP ( const sc_biguint<WL>& left, const sc_bigint<WR>& right ) \
+	{ return sc_big_compare( left, right ) OP 0; } \
+     \
+    template<int WL, int WR> \
+    inline \
+    bool operator OP ( const sc_bigint<WL>& left, const sc_biguint<WR>& right ) \
+	{ return sc_big_compare( left, right ) OP 0; } \
+     \
+    template<int WL, int WR> \
+    inline \
+    bool operator OP ( const sc_biguint<WL>& left, const sc_biguint<WR>& right ) \
+	{ return sc_big_compare( left, right ) OP 0; }
+
+SC_BIG_COMPARE_OPS(==)
+SC_BIG_COMPARE_OPS(!=)
+SC_BIG_COMPARE_OPS(<)
+SC_BIG_COMPARE_OPS(<=)
+SC_BIG_COMPARE_OPS(>)
+SC_BIG_COMPARE_OPS(>=)
+
+#undef SC_BIG_COMPARE_OPS
+
 } // namespace sc_dt
 
 #undef SC_BIG_MAX
@@ -453,6 +453,18 @@ sc_bigint<W>::operator<<=(int v)
   if (v <= 0)
     return *this;
 
+#if defined(SC_BIGINT_CONFIG_NATIVE_INT128)
+  if ( 4 > HOD ) {
+      // Sign extend the shifted value from bit W-1 before storing it, the
+      // mask keeps the shift counts in range for the widths of other types:
+
+      const int     unused = ( 128 - W ) & 127;
+      const uint128 value = v < 128 ? vector_load_128<HOD>(digit) << v : 0;
+      vector_store_128<HOD>( (int128)( value << unused ) >> unused, digit );
+      return *this;
+  }
+#endif // SC_BIGINT_CONFIG_NATIVE_INT128
+
   vector_shift_left( DIV_CEIL(W+1), digit, v );
   adjust_hod();
 
@@ -468,6 +480,14 @@ sc_bigint<W>::operator>>=(int v)
     if (v <= 0)
         return *this;
 
+#if defined(SC_BIGINT_CONFIG_NATIVE_INT128)
+    if ( 4 > HOD ) {
+        vector_store_128<HOD>( (int128)vector_load_128<HOD>(digit) >> (v < 128 ? v : 127),
+	                       digit );
+	return *this;
+    }
+#endif // SC_BIGINT_CONFIG_NATIVE_INT128
+
     int nd = DIV_CEIL(W);
 
     vector_shift_right(nd, digit, v, (int)digit[nd-1]<0 ? DIGIT_MASK:0);
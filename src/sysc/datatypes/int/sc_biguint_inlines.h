@@ -439,6 +439,17 @@ sc_biguint<W>::operator<<=(int v)
   if (v <= 0)
     return *this;
 
+#if defined(SC_BIGINT_CONFIG_NATIVE_INT128)
+  if ( 4 > HOD ) {
+      // Clear the bits above bit W-1 of the shifted value before storing it,
+      // the mask keeps the shift count in range for the widths of other types:
+
+      const uint128 value = v < 128 ? vector_load_128<HOD>(digit) << v : 0;
+      vector_store_128<HOD>( value & ~( ~(uint128)0 << (W & 127) ), digit );
+      return *this;
+  }
+#endif // SC_BIGINT_CONFIG_NATIVE_INT128
+
   vector_shift_left( DIV_CEIL(W+1), digit, v );
   adjust_hod();
 
@@ -498,6 +509,13 @@ sc_biguint<W>::operator>>=(int v)
     if (v <= 0)
         return *this;
 
+#if defined(SC_BIGINT_CONFIG_NATIVE_INT128)
+    if ( 4 > HOD ) {
+        vector_store_128<HOD>( v < 128 ? vector_load_128<HOD>(digit) >> v : 0, digit );
+	return *this;
+    }
+#endif // SC_BIGINT_CONFIG_NATIVE_INT128
+
     int nd = DIV_CEIL(W+1);
     vector_shift_right(nd, digit, v, 0);
 
@@ -130,6 +130,40 @@ namespace sc_dt
 #error no SC_BASE_VEC_DIGITS specified!
 #endif
 
+// SC_DIGIT_POOL_DIGITS - sc_signed and sc_unsigned values needing more than SC_BASE_VEC_DIGITS
+// digits of storage, up to this many, take it from the free lists of sc_digit_pool rather than
+// from new and delete. The storage of a value is returned to its free list when the value is
+// destroyed, so the temporaries of an expression are allocation free once the lists are
+// populated. Wider values use new and delete. The default covers values up to 2048 bits, the
+// width at which multiplication switches to the Karatsuba algorithm; 0 disables the pool. It
+// takes effect when the SystemC library is built.
+//
+// The free lists belong to the host thread that destroys a value, each keeps at most
+// SC_DIGIT_POOL_BLOCKS blocks. When the values are made on one thread and destroyed on another,
+// as with the host threads of temporally decoupled initiators, the making thread still allocates
+// with new, and the destroying thread keeps up to that many blocks per size. The blocks still on
+// the lists of a thread are not freed when the thread exits. Where that matters, build with
+// SC_DIGIT_POOL_DIGITS=0.
+
+#if !defined(SC_DIGIT_POOL_DIGITS)
+#   define SC_DIGIT_POOL_DIGITS 64
+#endif
+
+#if !defined(SC_DIGIT_POOL_BLOCKS)
+#   define SC_DIGIT_POOL_BLOCKS 64
+#endif
+
+// SC_BIGINT_CONFIG_NATIVE_INT128 - when this macro is defined the arithmetic, comparison and shift
+// operators of sc_bigint and sc_biguint whose operands and result fit in 128 bits are performed
+// using the compiler's 128-bit integer type rather than the sc_digit vector routines. The values
+// themselves remain in sc_digit vectors, so they are interchangeable with sc_signed and sc_unsigned
+// values. The macro is defined when the compiler provides a 128-bit integer type, unless
+// SC_BIGINT_CONFIG_NO_NATIVE_INT128 is defined.
+
+#if defined(__SIZEOF_INT128__) && !defined(SC_BIGINT_CONFIG_NO_NATIVE_INT128)
+#   define SC_BIGINT_CONFIG_NATIVE_INT128
+#endif
+
 typedef unsigned char uchar;
 
 // A small_type number is at least a char. Defining an int is probably
@@ -215,6 +249,11 @@ typedef unsigned int sc_digit;        // type holding "digits" in big values.
 using int64  = long long;
 using uint64 = unsigned long long;
 
+#if defined(SC_BIGINT_CONFIG_NATIVE_INT128)
+    __extension__ typedef __int128          int128;
+    __extension__ typedef unsigned __int128 uint128;
+#endif
+
 constexpr uint64 UINT64_ZERO   = 0ULL;
 constexpr uint64 UINT64_ONE    = 1ULL;
 constexpr uint64 UINT64_32ONES = 0x00000000ffffffffULL;
@@ -75,6 +75,48 @@ namespace sc_dt
 
 sc_digit_heap sc_temporary_digits(0x100000);
 
+// Free blocks of each size up to SC_DIGIT_POOL_DIGITS, linked through their
+// first bytes. The lists have no destructor so that values destroyed at exit,
+// after the lists of the main thread, may still release their blocks. A list
+// keeps at most SC_DIGIT_POOL_BLOCKS blocks, further ones are deleted, so a
+// thread destroying the values made by another one does not collect them
+// without bound:
+
+static thread_local void*    sc_digit_pool_free[SC_DIGIT_POOL_DIGITS+1];
+static thread_local unsigned sc_digit_pool_free_n[SC_DIGIT_POOL_DIGITS+1];
+
+sc_digit*
+sc_digit_pool::allocate( size_t digits_n )
+{
+    if ( digits_n > SC_DIGIT_POOL_DIGITS ) {
+        return new sc_digit[digits_n];
+    }
+    void* block_p = sc_digit_pool_free[digits_n];
+    if ( block_p ) {
+        sc_digit_pool_free[digits_n] = *static_cast<void**>( block_p );
+        --sc_digit_pool_free_n[digits_n];
+        return static_cast<sc_digit*>( block_p );
+    }
+
+    // A free block must be able to hold the link to the next one:
+
+    const size_t link_n = ( sizeof(void*) - 1 ) / sizeof(sc_digit) + 1;
+    return new sc_digit[digits_n < link_n ? link_n : digits_n];
+}
+
+void
+sc_digit_pool::release( sc_digit* digits_p, size_t digits_n )
+{
+    if ( digits_n > SC_DIGIT_POOL_DIGITS ||
+         sc_digit_pool_free_n[digits_n] >= SC_DIGIT_POOL_BLOCKS ) {
+        delete [] digits_p;
+        return;
+    }
+    *reinterpret_cast<void**>( digits_p ) = sc_digit_pool_free[digits_n];
+    sc_digit_pool_free[digits_n] = digits_p;
+    ++sc_digit_pool_free_n[digits_n];
+}
+
 
 // ----------------------------------------------------------------------------
 //  SECTION: General utility functions.
@@ -331,6 +331,31 @@ class SC_API sc_digit_heap {
 
 extern sc_digit_heap SC_API sc_temporary_digits;
 
+//--------------------------------------------------------------------------------------------------
+// sc_digit_pool - CLASS MANAGING THE STORAGE OF WIDE sc_signed AND sc_unsigned VALUES
+//
+// This facility keeps a free list of sc_digit blocks for each block size up to
+// SC_DIGIT_POOL_DIGITS. A released block is placed on the free list for its size and is handed
+// out again by the next allocation of that size, so once the lists are populated values are
+// created and destroyed without calls to new and delete. Blocks larger than SC_DIGIT_POOL_DIGITS
+// are allocated and freed with new and delete. The free lists are kept per thread and the
+// blocks on them are never returned to the system.
+//
+// sc_digit* allocate( size_t digits_n )
+//   This method returns a pointer to a block of digits_n sc_digits.
+//       digits_n = number of sc_digits to be allocated.
+//
+// void release( sc_digit* digits_p, size_t digits_n )
+//   This method returns a block obtained from allocate() to the pool.
+//       digits_p = block to be released.
+//       digits_n = number of sc_digits the block was allocated with.
+//--------------------------------------------------------------------------------------------------
+class SC_API sc_digit_pool {
+  public:
+    static sc_digit* allocate( size_t digits_n );
+    static void release( sc_digit* digits_p, size_t digits_n );
+};
+
 } // namespace sc_dt
 
 #endif
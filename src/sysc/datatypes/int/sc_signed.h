@@ -629,7 +629,7 @@ public:
 
     virtual ~sc_signed()
 	{
-	    if ( digit_is_allocated() ) { delete [] digit; }
+	    if ( digit_is_allocated() ) { sc_digit_pool::release( digit, ndigits ); }
 	}
 
     // Concatenation support:
@@ -1373,7 +1373,7 @@ sc_signed::sc_signed( const sc_generic_base<T>& v )
     }
     ndigits = DIV_CEIL(nbits);
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-	digit = new sc_digit[ndigits];
+	digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     }
     else  {
@@ -1605,7 +1605,7 @@ sc_signed::sc_signed( int nb, bool zero ) :
         SC_FREE_DIGIT(false)
     }
     else {
-        digit = new sc_digit[ndigits];
+        digit = sc_digit_pool::allocate( ndigits );
         SC_FREE_DIGIT(true)
     }
     if ( zero ) {
@@ -1635,7 +1635,7 @@ sc_signed::sc_signed( int nb ) :
     }
     ndigits = DIV_CEIL(nbits);
     if ( ndigits > ( (int)(sizeof(base_vec)/sizeof(sc_digit)) ) ) {
-        digit = new sc_digit[ndigits];
+        digit = sc_digit_pool::allocate( ndigits );
         SC_FREE_DIGIT(true)
     }
     else {
@@ -99,7 +99,7 @@ sc_signed::sc_signed(const sc_signed& v) :
     sc_value_base(v), nbits(v.nbits), ndigits(v.ndigits), digit()
 {
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-	digit = new sc_digit[ndigits];
+	digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     }
     else  {
@@ -117,7 +117,7 @@ sc_signed::sc_signed(const sc_unsigned& v) :
     ndigits(((nbits+BITS_PER_DIGIT-1)/BITS_PER_DIGIT)), digit()
 {
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-	digit = new sc_digit[ndigits];
+	digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     } else {
 	digit = base_vec;
@@ -157,7 +157,7 @@ sc_signed::sc_signed(const sc_signed_subref_r& v) :
     nbits = v.length();
     ndigits = SC_DIGIT_COUNT(nbits);
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-        digit = new sc_digit[ndigits];
+        digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     } else {
         digit = base_vec;
@@ -190,7 +190,7 @@ sc_signed::sc_signed(const sc_unsigned_subref_r& v) :
     nbits = v.length();
     ndigits = SC_DIGIT_COUNT(nbits);
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-        digit = new sc_digit[ndigits];
+        digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     } else {
         digit = base_vec;
@@ -232,7 +232,7 @@ sc_signed::sc_signed(const sc_bv_base& v) :
     }
     ndigits = DIV_CEIL(nbits);
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-	digit = new sc_digit[ndigits];
+	digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     } else {
 	digit = base_vec;
@@ -256,7 +256,7 @@ sc_signed::sc_signed(const sc_lv_base& v) :
     }
     ndigits = DIV_CEIL(nbits);
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-	digit = new sc_digit[ndigits];
+	digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     } else {
 	digit = base_vec;
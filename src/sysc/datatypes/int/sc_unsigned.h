@@ -626,7 +626,7 @@ public:
 
     ~sc_unsigned()
         {
-            if ( digit_is_allocated() ) { delete [] digit; }
+            if ( digit_is_allocated() ) { sc_digit_pool::release( digit, ndigits ); }
         }
 
     // Concatenation support:
@@ -1387,7 +1387,7 @@ sc_unsigned::sc_unsigned( const sc_generic_base<T>& v )
     }
     ndigits = DIV_CEIL(nbits);
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-	digit = new sc_digit[ndigits];
+	digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     }
     else {
@@ -1618,7 +1618,7 @@ sc_unsigned::sc_unsigned( int nb, bool zero ) :
 	SC_FREE_DIGIT(false)
     }
     else {
-        digit = new sc_digit[ndigits];
+        digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     }
     if ( zero ) {
@@ -1680,7 +1680,7 @@ sc_unsigned::sc_unsigned( int nb ) :
     }
     ndigits = DIV_CEIL(nbits);
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-        digit = new sc_digit[ndigits];
+        digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     }
     else {
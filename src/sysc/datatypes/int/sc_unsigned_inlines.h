@@ -99,7 +99,7 @@ sc_unsigned::sc_unsigned(const sc_unsigned& v) :
     sc_value_base(v), nbits(v.nbits), ndigits(v.ndigits), digit()
 {
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-	digit = new sc_digit[ndigits];
+	digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     }
     else  {
@@ -117,7 +117,7 @@ sc_unsigned::sc_unsigned(const sc_signed& v) :
     ndigits( SC_DIGIT_COUNT(nbits) ), digit()
 {
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-	digit = new sc_digit[ndigits];
+	digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     } else {
 	digit = base_vec;
@@ -162,7 +162,7 @@ sc_unsigned::sc_unsigned(const sc_signed_subref_r& v) :
     nbits = v.length() + 1;
     ndigits = SC_DIGIT_COUNT(nbits);
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-	digit = new sc_digit[ndigits];
+	digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     } else {
 	digit = base_vec;
@@ -192,7 +192,7 @@ sc_unsigned::sc_unsigned(const sc_unsigned_subref_r& v) :
     nbits = v.length() + 1;
     ndigits = SC_DIGIT_COUNT(nbits);
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-	digit = new sc_digit[ndigits];
+	digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     } else {
 	digit = base_vec;
@@ -233,7 +233,7 @@ sc_unsigned::sc_unsigned(const sc_bv_base& v) :
     }
     ndigits = DIV_CEIL(nbits);
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-	digit = new sc_digit[ndigits];
+	digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     } else {
 	digit = base_vec;
@@ -257,7 +257,7 @@ sc_unsigned::sc_unsigned(const sc_lv_base& v) :
     }
     ndigits = DIV_CEIL(nbits);
     if ( ndigits > SC_BASE_VEC_DIGITS ) {
-	digit = new sc_digit[ndigits];
+	digit = sc_digit_pool::allocate( ndigits );
 	SC_FREE_DIGIT(true)
     } else {
 	digit = base_vec;
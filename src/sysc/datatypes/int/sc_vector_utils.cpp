@@ -0,0 +1,945 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_vector_utils.cpp -- Multiplication and division of wide limb vectors.
+
+                         Karatsuba and Toom-3 multiplication, long
+                         division of limbs and Barrett division with a
+                         Newton reciprocal, which are used by
+                         vector_multiply and vector_divide above their
+                         thresholds.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include "sysc/datatypes/int/sc_nbutils.h"
+#include "sysc/datatypes/int/sc_vector_utils.h"
+
+#include <vector>
+
+namespace sc_dt
+{
+
+// ----------------------------------------------------------------------------
+//  SECTION: Thresholds of the sub-quadratic algorithms.
+// ----------------------------------------------------------------------------
+
+int vector_karatsuba_bits = 2048;
+int vector_toom3_bits = 12288;
+int vector_barrett_bits = 32768;
+
+namespace {
+
+typedef vector_limb         limb;
+typedef vector_limb_product limb_product;
+
+const int limb_bits = (int)( 8 * sizeof(limb) );
+const int limb_digits = (int)( sizeof(limb) / sizeof(sc_digit) );
+
+// smallest operands split by karatsuba, which guarantees that the halves
+// are smaller than the operands.
+const int karatsuba_min_n = 4;
+
+// smallest operands split by toom-3, which guarantees that each of the three
+// pieces has at least one limb.
+const int toom3_min_n = 9;
+
+// limbs of the work area of a division that are kept on the stack.
+const int stack_limbs_n = 256;
+
+// ----------------------------------------------------------------------------
+//  SECTION: Limb vector primitives.
+// ----------------------------------------------------------------------------
+
+// result = left + right over limbs_n limbs, returns the carry.
+
+limb
+add_n( limb* result_p, const limb* left_p, const limb* right_p, int limbs_n )
+{
+    limb carry = 0;
+    for ( int limb_i = 0; limb_i < limbs_n; ++limb_i ) {
+        limb sum = left_p[limb_i] + carry;
+        carry = sum < carry;
+        sum += right_p[limb_i];
+        carry += sum < right_p[limb_i];
+        result_p[limb_i] = sum;
+    }
+    return carry;
+}
+
+// result = left - right over limbs_n limbs, returns the borrow.
+
+limb
+sub_n( limb* result_p, const limb* left_p, const limb* right_p, int limbs_n )
+{
+    limb borrow = 0;
+    for ( int limb_i = 0; limb_i < limbs_n; ++limb_i ) {
+        const limb left = left_p[limb_i];
+        const limb right = right_p[limb_i];
+        result_p[limb_i] = left - right - borrow;
+        borrow = ( left < right ) | ( ( left == right ) & borrow );
+    }
+    return borrow;
+}
+
+// target += carry over limbs_n limbs, returns the carry out.
+
+limb
+add_1( limb* target_p, int limbs_n, limb carry )
+{
+    for ( int limb_i = 0; carry && limb_i < limbs_n; ++limb_i ) {
+        target_p[limb_i] += carry;
+        carry = target_p[limb_i] < carry;
+    }
+    return carry;
+}
+
+// target -= borrow over limbs_n limbs, returns the borrow out.
+
+limb
+sub_1( limb* target_p, int limbs_n, limb borrow )
+{
+    for ( int limb_i = 0; borrow && limb_i < limbs_n; ++limb_i ) {
+        const limb target = target_p[limb_i];
+        target_p[limb_i] = target - borrow;
+        borrow = target < borrow;
+    }
+    return borrow;
+}
+
+// compares two vectors of limbs_n limbs.
+
+int
+compare_n( const limb* left_p, const limb* right_p, int limbs_n )
+{
+    for ( int limb_i = limbs_n-1; limb_i >= 0; --limb_i ) {
+        if ( left_p[limb_i] != right_p[limb_i] ) {
+            return left_p[limb_i] < right_p[limb_i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+// number of significant limbs, at least one.
+
+int
+significant_n( const limb* limbs_p, int limbs_n )
+{
+    while ( limbs_n > 1 && !limbs_p[limbs_n-1] ) {
+        --limbs_n;
+    }
+    return limbs_n;
+}
+
+// number of leading zero bits of a non-zero limb.
+
+int
+leading_zeros( limb value )
+{
+    int zeros_n = 0;
+    for ( int shift_n = limb_bits / 2; shift_n; shift_n /= 2 ) {
+        if ( !( value >> ( limb_bits - shift_n ) ) ) {
+            value <<= shift_n;
+            zeros_n += shift_n;
+        }
+    }
+    return zeros_n;
+}
+
+// result = source << shift_n over limbs_n limbs, 0 <= shift_n < limb_bits,
+// returns the bits shifted out.
+
+limb
+shift_left( limb* result_p, const limb* source_p, int limbs_n, int shift_n )
+{
+    if ( !shift_n ) {
+        for ( int limb_i = limbs_n-1; limb_i >= 0; --limb_i ) {
+            result_p[limb_i] = source_p[limb_i];
+        }
+        return 0;
+    }
+    const limb out = source_p[limbs_n-1] >> ( limb_bits - shift_n );
+    for ( int limb_i = limbs_n-1; limb_i > 0; --limb_i ) {
+        result_p[limb_i] = ( source_p[limb_i] << shift_n ) |
+                           ( source_p[limb_i-1] >> ( limb_bits - shift_n ) );
+    }
+    result_p[0] = source_p[0] << shift_n;
+    return out;
+}
+
+// result = source >> shift_n over limbs_n limbs, 0 <= shift_n < limb_bits.
+
+void
+shift_right( limb* result_p, const limb* source_p, int limbs_n, int shift_n )
+{
+    if ( !shift_n ) {
+        for ( int limb_i = 0; limb_i < limbs_n; ++limb_i ) {
+            result_p[limb_i] = source_p[limb_i];
+        }
+        return;
+    }
+    for ( int limb_i = 0; limb_i < limbs_n-1; ++limb_i ) {
+        result_p[limb_i] = ( source_p[limb_i] >> shift_n ) |
+                           ( source_p[limb_i+1] << ( limb_bits - shift_n ) );
+    }
+    result_p[limbs_n-1] = source_p[limbs_n-1] >> shift_n;
+}
+
+// loads non-negative digits 0..hod into limbs, zero filling the last limb.
+
+void
+load_digits( int hod, const sc_digit* digits_p, limb* limbs_p )
+{
+    for ( int limb_i = 0; limb_i <= hod / limb_digits; ++limb_i ) {
+        limb value = 0;
+        for ( int part_i = 0; part_i < limb_digits; ++part_i ) {
+            const int digit_i = limb_i * limb_digits + part_i;
+            if ( digit_i <= hod ) {
+                value |= (limb)digits_p[digit_i] << ( part_i * BITS_PER_DIGIT );
+            }
+        }
+        limbs_p[limb_i] = value;
+    }
+}
+
+// stores limbs_n limbs into digits_n digits, zero filling above the limbs.
+
+void
+store_digits( int limbs_n, const limb* limbs_p, int digits_n,
+              sc_digit* digits_p )
+{
+    for ( int digit_i = 0; digit_i < digits_n; ++digit_i ) {
+        const int limb_i = digit_i / limb_digits;
+        digits_p[digit_i] = limb_i < limbs_n ? (sc_digit)
+            ( limbs_p[limb_i] >>
+              ( ( digit_i % limb_digits ) * BITS_PER_DIGIT ) ) : 0;
+    }
+}
+
+// ----------------------------------------------------------------------------
+//  SECTION: Karatsuba multiplication.
+//
+//  Each operand of n limbs is split into a low half of h = n/2 limbs and a
+//  high half of k = n-h limbs, A = A1*B^h + A0, so that
+//
+//      A*B = A1*B1*B^2h + ( (A0+A1)*(B0+B1) - A0*B0 - A1*B1 )*B^h + A0*B0
+//
+//  takes three products of half the size instead of four. The sums of the
+//  halves take k+1 limbs.
+// ----------------------------------------------------------------------------
+
+// number of scratch limbs taken by karatsuba for operands of limbs_n limbs.
+
+int
+karatsuba_scratch_n( int limbs_n, int threshold_n )
+{
+    int scratch_n = 0;
+    while ( limbs_n >= threshold_n ) {
+        const int high_n = limbs_n - limbs_n / 2;
+        scratch_n += 4 * ( high_n + 1 );
+        limbs_n = high_n + 1;
+    }
+    return scratch_n;
+}
+
+// result = left * right, all operands have limbs_n limbs, the result has
+// 2*limbs_n limbs.
+
+void
+karatsuba( int limbs_n, const limb* left_p, const limb* right_p,
+           limb* result_p, limb* scratch_p, int threshold_n )
+{
+    if ( limbs_n < threshold_n ) {
+        vector_multiply_limbs( limbs_n, left_p, limbs_n, right_p, result_p );
+        return;
+    }
+
+    const int low_n = limbs_n / 2;
+    const int high_n = limbs_n - low_n;
+    limb*     left_sum_p = scratch_p;
+    limb*     right_sum_p = left_sum_p + high_n + 1;
+    limb*     middle_p = right_sum_p + high_n + 1;
+    limb*     next_scratch_p = middle_p + 2 * ( high_n + 1 );
+
+    // The sums of the halves, the low half is the shorter one:
+
+    left_sum_p[high_n] = add_n( left_sum_p, left_p+low_n, left_p, low_n );
+    right_sum_p[high_n] = add_n( right_sum_p, right_p+low_n, right_p, low_n );
+    for ( int limb_i = low_n; limb_i < high_n; ++limb_i ) {
+        left_sum_p[limb_i] = left_p[low_n+limb_i];
+        right_sum_p[limb_i] = right_p[low_n+limb_i];
+    }
+    if ( high_n > low_n ) {
+        left_sum_p[high_n] = add_1( &left_sum_p[low_n], 1,
+                                    left_sum_p[high_n] );
+        right_sum_p[high_n] = add_1( &right_sum_p[low_n], 1,
+                                     right_sum_p[high_n] );
+    }
+
+    // The three products, the low and high ones directly into the result:
+
+    karatsuba( high_n+1, left_sum_p, right_sum_p, middle_p, next_scratch_p,
+               threshold_n );
+    karatsuba( low_n, left_p, right_p, result_p, next_scratch_p,
+               threshold_n );
+    karatsuba( high_n, left_p+low_n, right_p+low_n, result_p+2*low_n,
+               next_scratch_p, threshold_n );
+
+    // The middle term, which takes at most 2*high_n+1 limbs:
+
+    int middle_n = 2 * ( high_n + 1 );
+    sub_1( middle_p+2*low_n, middle_n-2*low_n,
+           sub_n( middle_p, middle_p, result_p, 2*low_n ) );
+    sub_1( middle_p+2*high_n, middle_n-2*high_n,
+           sub_n( middle_p, middle_p, result_p+2*low_n, 2*high_n ) );
+    middle_n = significant_n( middle_p, middle_n );
+
+    add_1( result_p+low_n+middle_n, 2*limbs_n-low_n-middle_n,
+           add_n( result_p+low_n, result_p+low_n, middle_p, middle_n ) );
+}
+
+// ----------------------------------------------------------------------------
+//  SECTION: Toom-Cook 3-way multiplication.
+//
+//  Each operand of n limbs is split into three pieces of k = ceil(n/3) limbs,
+//  the high order one possibly shorter, A(x) = a2*x^2 + a1*x + a0 with
+//  x = B^k. The product of the polynomials is evaluated at 0, 1, -1, -2 and
+//  infinity, which takes five products of a third of the size instead of
+//  nine, and its coefficients are interpolated from those values using the
+//  sequence of Bodrato:
+//
+//      r3 = ( P(-2) - P(1) ) / 3      r1 = ( P(1) - P(-1) ) / 2
+//      r2 = P(-1) - P(0)              r3 = ( r2 - r3 ) / 2 + 2*P(inf)
+//      r2 = r2 + r1 - P(inf)          r1 = r1 - r3
+//
+//  The interpolation works on two's complement values of a fixed number of
+//  limbs, since the intermediate values may be negative, while the final
+//  coefficients are not.
+// ----------------------------------------------------------------------------
+
+struct multiply_thresholds
+{
+    int karatsuba_n; // operands of at least this many limbs use karatsuba.
+    int toom3_n;     // operands of at least this many limbs use toom-3.
+};
+
+void multiply_balanced( int limbs_n, const limb* left_p, const limb* right_p,
+                        limb* result_p, const multiply_thresholds& limits );
+
+// result = source evaluated at -1 or -2 as magnitude, returns true if it is
+// negative. The pieces of source have piece_n limbs, the high order one
+// top_n limbs, the result piece_n+1 limbs.
+
+bool
+evaluate_negative( int piece_n, int top_n, const limb* source_p, bool at_two,
+                   limb* result_p, limb* temp_p )
+{
+    const limb* low_p = source_p;
+    const limb* middle_p = source_p + piece_n;
+    const limb* high_p = source_p + 2*piece_n;
+
+    // even = a0 + a2 or a0 + 4*a2, odd = a1 or 2*a1:
+
+    limb* even_p = temp_p;
+    limb* odd_p = temp_p + piece_n + 1;
+    for ( int limb_i = 0; limb_i < top_n; ++limb_i ) {
+        even_p[limb_i] = high_p[limb_i];
+    }
+    for ( int limb_i = top_n; limb_i <= piece_n; ++limb_i ) {
+        even_p[limb_i] = 0;
+    }
+    if ( at_two ) {
+        shift_left( even_p, even_p, piece_n+1, 2 );
+    }
+    add_1( even_p+piece_n, 1, add_n( even_p, even_p, low_p, piece_n ) );
+    odd_p[piece_n] = shift_left( odd_p, middle_p, piece_n, at_two ? 1 : 0 );
+
+    if ( compare_n( even_p, odd_p, piece_n+1 ) >= 0 ) {
+        sub_n( result_p, even_p, odd_p, piece_n+1 );
+        return false;
+    }
+    sub_n( result_p, odd_p, even_p, piece_n+1 );
+    return true;
+}
+
+// value = -value over limbs_n limbs.
+
+void
+negate( limb* value_p, int limbs_n )
+{
+    for ( int limb_i = 0; limb_i < limbs_n; ++limb_i ) {
+        value_p[limb_i] = ~value_p[limb_i];
+    }
+    add_1( value_p, limbs_n, 1 );
+}
+
+// value = value / 2 over limbs_n limbs, for an even two's complement value.
+
+void
+halve( limb* value_p, int limbs_n )
+{
+    const limb sign = value_p[limbs_n-1] >> ( limb_bits - 1 );
+    shift_right( value_p, value_p, limbs_n, 1 );
+    value_p[limbs_n-1] |= sign << ( limb_bits - 1 );
+}
+
+// value = value / 3 over limbs_n limbs, for a two's complement value that is
+// a multiple of three. This multiplies by the inverse of three modulo B,
+// carrying the high order part of three times each quotient limb upwards.
+
+void
+divide_by_three( limb* value_p, int limbs_n )
+{
+    const limb third = ~(limb)0 / 3;
+    const limb inverse = 2 * third + 1;
+    limb       borrow = 0;
+    for ( int limb_i = 0; limb_i < limbs_n; ++limb_i ) {
+        const limb value = value_p[limb_i];
+        const limb difference = value - borrow;
+        const limb quotient = difference * inverse;
+        value_p[limb_i] = quotient;
+        borrow = ( difference > value ) + ( quotient > third ) +
+                 ( quotient >= inverse );
+    }
+}
+
+// result = left * right, all operands have limbs_n limbs, the result has
+// 2*limbs_n limbs.
+
+void
+toom3( int limbs_n, const limb* left_p, const limb* right_p, limb* result_p,
+       const multiply_thresholds& limits )
+{
+    const int piece_n = ( limbs_n + 2 ) / 3;
+    const int top_n = limbs_n - 2*piece_n;
+    const int point_n = piece_n + 1;     // limbs in an evaluated operand.
+    const int value_n = 2*piece_n + 4;   // limbs in a two's complement value.
+
+    std::vector<limb> work( 4*point_n + 4*value_n + 2*point_n, 0 );
+    limb* left_point_p = &work[0];
+    limb* right_point_p = left_point_p + point_n;
+    limb* temp_p = right_point_p + point_n;
+    limb* at_one_p = temp_p + 2*point_n;
+    limb* at_minus_one_p = at_one_p + value_n;
+    limb* at_minus_two_p = at_minus_one_p + value_n;
+    limb* middle_p = at_minus_two_p + value_n;
+
+    // P(1) = A(1) * B(1):
+
+    for ( int side_i = 0; side_i < 2; ++side_i ) {
+        const limb* source_p = side_i ? right_p : left_p;
+        limb*       point_p = side_i ? right_point_p : left_point_p;
+        for ( int limb_i = 0; limb_i < top_n; ++limb_i ) {
+            point_p[limb_i] = source_p[2*piece_n+limb_i];
+        }
+        for ( int limb_i = top_n; limb_i < point_n; ++limb_i ) {
+            point_p[limb_i] = 0;
+        }
+        add_1( point_p+piece_n, 1,
+               add_n( point_p, point_p, source_p, piece_n ) );
+        add_1( point_p+piece_n, 1,
+               add_n( point_p, point_p, source_p+piece_n, piece_n ) );
+    }
+    multiply_balanced( point_n, left_point_p, right_point_p, at_one_p,
+                       limits );
+
+    // P(-1) and P(-2), whose signs are those of the products:
+
+    for ( int point_i = 0; point_i < 2; ++point_i ) {
+        const bool at_two = point_i == 1;
+        limb*      value_p = at_two ? at_minus_two_p : at_minus_one_p;
+        bool negative = evaluate_negative( piece_n, top_n, left_p, at_two,
+                                           left_point_p, temp_p );
+        negative ^= evaluate_negative( piece_n, top_n, right_p, at_two,
+                                       right_point_p, temp_p );
+        multiply_balanced( point_n, left_point_p, right_point_p, value_p,
+                           limits );
+        if ( negative ) {
+            negate( value_p, value_n );
+        }
+    }
+
+    // P(0) and P(inf) go directly into the result, where they do not
+    // overlap:
+
+    multiply_balanced( piece_n, left_p, right_p, result_p, limits );
+    for ( int limb_i = 2*piece_n; limb_i < 4*piece_n; ++limb_i ) {
+        result_p[limb_i] = 0;
+    }
+    multiply_balanced( top_n, left_p+2*piece_n, right_p+2*piece_n,
+                       result_p+4*piece_n, limits );
+
+    // Interpolate r1, r2 and r3, see above. The middle value holds P(0)
+    // and then P(inf) as two's complement values:
+
+    limb* r1_p = at_one_p;        // P(1) - P(-1)
+    limb* r2_p = at_minus_one_p;  // P(-1) - P(0)
+    limb* r3_p = at_minus_two_p;  // P(-2) - P(1)
+
+    sub_n( r3_p, r3_p, r1_p, value_n );
+    divide_by_three( r3_p, value_n );
+    sub_n( r1_p, r1_p, r2_p, value_n );
+    halve( r1_p, value_n );
+
+    for ( int limb_i = 0; limb_i < value_n; ++limb_i ) {
+        middle_p[limb_i] = limb_i < 2*piece_n ? result_p[limb_i] : 0;
+    }
+    sub_n( r2_p, r2_p, middle_p, value_n );
+
+    sub_n( r3_p, r2_p, r3_p, value_n );
+    halve( r3_p, value_n );
+    for ( int limb_i = 0; limb_i < value_n; ++limb_i ) {
+        middle_p[limb_i] = limb_i < 2*top_n ? result_p[4*piece_n+limb_i] : 0;
+    }
+    add_n( r3_p, r3_p, middle_p, value_n );
+    add_n( r3_p, r3_p, middle_p, value_n );
+
+    add_n( r2_p, r2_p, r1_p, value_n );
+    sub_n( r2_p, r2_p, middle_p, value_n );
+    sub_n( r1_p, r1_p, r3_p, value_n );
+
+    // Add the coefficients into the result at their powers of x:
+
+    limb* coefficients_p[3] = { r1_p, r2_p, r3_p };
+    for ( int power_i = 1; power_i <= 3; ++power_i ) {
+        const int offset_n = power_i * piece_n;
+        const int coefficient_n =
+            significant_n( coefficients_p[power_i-1], value_n );
+        add_1( result_p+offset_n+coefficient_n,
+               2*limbs_n-offset_n-coefficient_n,
+               add_n( result_p+offset_n, result_p+offset_n,
+                      coefficients_p[power_i-1], coefficient_n ) );
+    }
+}
+
+// result = left * right, all operands have limbs_n limbs, the result has
+// 2*limbs_n limbs, using the algorithm that fits the size of the operands.
+
+void
+multiply_balanced( int limbs_n, const limb* left_p, const limb* right_p,
+                   limb* result_p, const multiply_thresholds& limits )
+{
+    if ( limbs_n >= limits.toom3_n ) {
+        toom3( limbs_n, left_p, right_p, result_p, limits );
+    }
+    else if ( limbs_n >= limits.karatsuba_n ) {
+        std::vector<limb> scratch( karatsuba_scratch_n( limbs_n,
+                                                        limits.karatsuba_n ) );
+        karatsuba( limbs_n, left_p, right_p, result_p, &scratch[0],
+                   limits.karatsuba_n );
+    }
+    else {
+        vector_multiply_limbs( limbs_n, left_p, limbs_n, right_p, result_p );
+    }
+}
+
+// ----------------------------------------------------------------------------
+//  SECTION: Division.
+// ----------------------------------------------------------------------------
+
+// Long division of normalized limbs, Knuth's algorithm D. The numerator has
+// numer_n+1 limbs, the denominator denom_n >= 2 limbs with its high order bit
+// set. The quotient receives numer_n-denom_n+1 limbs, the remainder is left
+// in the low order denom_n limbs of the numerator.
+
+void
+divide_long( int numer_n, limb* numer_p, int denom_n, const limb* denom_p,
+             limb* quot_p )
+{
+    const limb high = denom_p[denom_n-1];
+    const limb next = denom_p[denom_n-2];
+
+    for ( int quot_i = numer_n - denom_n; quot_i >= 0; --quot_i ) {
+        limb* remain_p = numer_p + quot_i;
+
+        // Estimate the quotient limb from the top two limbs of the
+        // remainder and correct it with the next limb, after which it is
+        // at most one too large:
+
+        const limb_product top =
+            ( (limb_product)remain_p[denom_n] << limb_bits ) |
+            remain_p[denom_n-1];
+        limb_product quot_guess = top / high;
+        limb_product remain_guess = top - quot_guess * high;
+        while ( ( quot_guess >> limb_bits ) ||
+                quot_guess * next >
+                ( ( remain_guess << limb_bits ) | remain_p[denom_n-2] ) ) {
+            --quot_guess;
+            remain_guess += high;
+            if ( remain_guess >> limb_bits ) {
+                break;
+            }
+        }
+
+        // Subtract the product of the guess and the denominator:
+
+        limb borrow = 0;
+        limb carry = 0;
+        for ( int denom_i = 0; denom_i < denom_n; ++denom_i ) {
+            const limb_product product =
+                (limb_product)(limb)quot_guess * denom_p[denom_i] + carry;
+            carry = (limb)( product >> limb_bits );
+            const limb remain = remain_p[denom_i];
+            const limb difference = remain - (limb)product;
+            const limb borrow_out = remain < (limb)product;
+            remain_p[denom_i] = difference - borrow;
+            borrow = borrow_out | ( difference < borrow );
+        }
+        const limb remain = remain_p[denom_n];
+        remain_p[denom_n] = remain - carry - borrow;
+
+        // If that went negative the guess was one too large, add back:
+
+        if ( (limb_product)remain < (limb_product)carry + borrow ) {
+            --quot_guess;
+            remain_p[denom_n] += add_n( remain_p, remain_p, denom_p, denom_n );
+        }
+        quot_p[quot_i] = (limb)quot_guess;
+    }
+}
+
+// Division by a single limb, returns the remainder.
+
+limb
+divide_short( int numer_n, const limb* numer_p, limb denom, limb* quot_p )
+{
+    limb_product remain = 0;
+    for ( int numer_i = numer_n-1; numer_i >= 0; --numer_i ) {
+        const limb_product value = ( remain << limb_bits ) | numer_p[numer_i];
+        quot_p[numer_i] = (limb)( value / denom );
+        remain = value % denom;
+    }
+    return (limb)remain;
+}
+
+// result = left * right for any lengths.
+
+void
+multiply( int left_n, const limb* left_p, int right_n, const limb* right_p,
+          limb* result_p )
+{
+    if ( left_n >= right_n ) {
+        vector_multiply_wide( left_n, left_p, right_n, right_p, result_p );
+    }
+    else {
+        vector_multiply_wide( right_n, right_p, left_n, left_p, result_p );
+    }
+}
+
+// The reciprocal of a normalized denominator of limbs_n limbs,
+//
+//     X = floor( ( B^2n - 1 ) / D ),
+//
+// which takes limbs_n+1 limbs, its high order limb is one. It is computed
+// from the reciprocal of the high order half of the denominator with one
+// Newton step, and then corrected to the exact value.
+
+void
+reciprocal( int limbs_n, const limb* denom_p, limb* recip_p )
+{
+    const int n = limbs_n;
+
+    if ( n < 8 ) {
+        std::vector<limb> numer( 2*n+1, ~(limb)0 );
+        numer[2*n] = 0;
+        divide_long( 2*n, &numer[0], n, denom_p, recip_p );
+        return;
+    }
+
+    // The reciprocal of the high order half, Xh ~ B^2h / Dh:
+
+    const int         high_n = ( n + 1 ) / 2;
+    std::vector<limb> high_recip( high_n+1 );
+    reciprocal( high_n, denom_p+n-high_n, &high_recip[0] );
+
+    // With X0 = Xh * B^(n-h) the error of the first approximation is
+    // E = B^2n - D*X0 = ( B^(n+h) - D*Xh ) * B^(n-h), and
+    //
+    //     X1 = X0 + X0*E / B^2n = Xh * B^(n-h) + Xh * e / B^2h
+    //
+    // with e = B^(n+h) - D*Xh, which is less than 2*B^n in magnitude.
+
+    std::vector<limb> product( n + high_n + 1 );
+    multiply( n, denom_p, high_n+1, &high_recip[0], &product[0] );
+
+    std::vector<limb> error( n + high_n + 1, 0 );
+    bool              error_negative = product[n+high_n] != 0;
+    if ( error_negative ) {
+        // e = -( D*Xh - B^(n+h) )
+        error = product;
+        error[n+high_n] -= 1;
+    }
+    else {
+        // e = B^(n+h) - D*Xh
+        sub_n( &error[0], &error[0], &product[0], n+high_n );
+    }
+    const int error_n = significant_n( &error[0], n+1 );
+
+    std::vector<limb> correction( high_n + 1 + error_n );
+    multiply( high_n+1, &high_recip[0], error_n, &error[0], &correction[0] );
+
+    for ( int limb_i = 0; limb_i <= n; ++limb_i ) {
+        recip_p[limb_i] = 0;
+    }
+    for ( int limb_i = 0; limb_i <= high_n; ++limb_i ) {
+        recip_p[n-high_n+limb_i] = high_recip[limb_i];
+    }
+    const int correction_n = high_n + 1 + error_n - 2*high_n;
+    if ( correction_n > 0 ) {
+        if ( error_negative ) {
+            sub_1( recip_p+correction_n, n+1-correction_n,
+                   sub_n( recip_p, recip_p, &correction[2*high_n],
+                          correction_n ) );
+        }
+        else {
+            add_1( recip_p+correction_n, n+1-correction_n,
+                   add_n( recip_p, recip_p, &correction[2*high_n],
+                          correction_n ) );
+        }
+    }
+
+    // Correct the approximation, R = B^2n - 1 - D*X1 with 0 <= R < D:
+
+    std::vector<limb> remain( 2*n+2 );
+    multiply( n+1, recip_p, n, denom_p, &remain[0] );
+    remain[2*n+1] = 0;
+    const limb ones = ~(limb)0;
+    std::vector<limb> all_ones( 2*n+2, ones );
+    all_ones[2*n] = 0;
+    all_ones[2*n+1] = 0;
+    const bool negative = sub_n( &remain[0], &all_ones[0], &remain[0], 2*n+2 );
+    if ( negative ) {
+        do {
+            sub_1( recip_p, n+1, 1 );
+        } while ( !add_1( &remain[n], n+2,
+                          add_n( &remain[0], &remain[0], denom_p, n ) ) );
+    }
+    else {
+        while ( significant_n( &remain[0], 2*n+2 ) > n ||
+                compare_n( &remain[0], denom_p, n ) >= 0 ) {
+            sub_1( &remain[n], n+2, sub_n( &remain[0], &remain[0], denom_p, n ) );
+            add_1( recip_p, n+1, 1 );
+        }
+    }
+}
+
+// Barrett division of normalized limbs. The numerator has numer_n limbs
+// and room for denom_n zero limbs above them, the denominator denom_n limbs
+// with its high order bit set. The numerator is divided in blocks of
+// denom_n limbs from the top down, estimating the quotient of each block
+// from the reciprocal of the denominator, which never overestimates it and
+// is corrected upwards. The quotient receives numer_n limbs, the remainder
+// is left in the low order denom_n limbs of the numerator.
+
+void
+divide_barrett( int numer_n, limb* numer_p, int denom_n, const limb* denom_p,
+                limb* quot_p )
+{
+    const int n = denom_n;
+
+    // The reciprocal of the last denominator is kept, since modular
+    // arithmetic divides by the same value over and over. It is kept per
+    // thread, as values may be divided by several host threads at once:
+
+    static thread_local std::vector<limb> cached_denom;
+    static thread_local std::vector<limb> cached_recip;
+    if ( (int)cached_denom.size() != n ||
+         compare_n( &cached_denom[0], denom_p, n ) ) {
+        cached_denom.assign( denom_p, denom_p + n );
+        cached_recip.resize( n+1 );
+        reciprocal( n, denom_p, &cached_recip[0] );
+    }
+    const limb* recip_p = &cached_recip[0];
+
+    std::vector<limb> product( 2*n+2 );
+    for ( int quot_i = 0; quot_i < numer_n; ++quot_i ) {
+        quot_p[quot_i] = 0;
+    }
+
+    // The top block is shorter than the denominator or less than twice it:
+
+    int block_i = ( numer_n - 1 ) / n * n;
+    if ( numer_n - block_i == n &&
+         compare_n( numer_p+block_i, denom_p, n ) >= 0 ) {
+        sub_n( numer_p+block_i, numer_p+block_i, denom_p, n );
+        quot_p[block_i] = 1;
+    }
+
+    // Each following block extends the remainder R < D by n limbs to
+    // A = R * B^n + block < D * B^n, whose quotient takes n limbs:
+
+    while ( block_i > 0 ) {
+        block_i -= n;
+        limb* window_p = numer_p + block_i;
+        limb* block_quot_p = quot_p + block_i;
+
+        multiply( n+1, window_p+n-1, n+1, recip_p, &product[0] );
+        for ( int limb_i = 0; limb_i < n; ++limb_i ) {
+            block_quot_p[limb_i] = product[n+1+limb_i];
+        }
+        multiply( n, block_quot_p, n, denom_p, &product[0] );
+        sub_n( window_p, window_p, &product[0], 2*n );
+        while ( significant_n( window_p, 2*n ) > n ||
+                compare_n( window_p, denom_p, n ) >= 0 ) {
+            sub_1( window_p+n, n, sub_n( window_p, window_p, denom_p, n ) );
+            add_1( block_quot_p, n, 1 );
+        }
+    }
+}
+
+} // namespace
+
+// ----------------------------------------------------------------------------
+//  SECTION: External functions.
+// ----------------------------------------------------------------------------
+
+// Multiplication of unsigned limb vectors for vector_multiply, see the
+// thresholds above.
+
+void
+vector_multiply_wide( int                longer_n,
+                      const vector_limb* longer_p,
+                      int                shorter_n,
+                      const vector_limb* shorter_p,
+                      vector_limb*       result_p )
+{
+    multiply_thresholds limits;
+    limits.karatsuba_n = ( vector_karatsuba_bits - 1 ) / limb_bits + 1;
+    if ( limits.karatsuba_n < karatsuba_min_n ) {
+        limits.karatsuba_n = karatsuba_min_n;
+    }
+    limits.toom3_n = ( vector_toom3_bits - 1 ) / limb_bits + 1;
+    if ( limits.toom3_n < toom3_min_n ) {
+        limits.toom3_n = toom3_min_n;
+    }
+
+    if ( shorter_n < limits.karatsuba_n && shorter_n < limits.toom3_n ) {
+        vector_multiply_limbs( longer_n, longer_p, shorter_n, shorter_p,
+                               result_p );
+        return;
+    }
+    if ( longer_n == shorter_n ) {
+        multiply_balanced( shorter_n, longer_p, shorter_p, result_p, limits );
+        return;
+    }
+
+    // Multiply the longer operand in pieces of the length of the shorter one
+    // and add the products into the result:
+
+    std::vector<limb> product( 2*shorter_n );
+    for ( int result_i = 0; result_i < longer_n + shorter_n; ++result_i ) {
+        result_p[result_i] = 0;
+    }
+    int longer_i;
+    for ( longer_i = 0; longer_i + shorter_n <= longer_n;
+          longer_i += shorter_n ) {
+        multiply_balanced( shorter_n, longer_p+longer_i, shorter_p,
+                           &product[0], limits );
+        add_1( result_p+longer_i+2*shorter_n,
+               longer_n-longer_i-shorter_n,
+               add_n( result_p+longer_i, result_p+longer_i, &product[0],
+                      2*shorter_n ) );
+    }
+    if ( longer_i < longer_n ) {
+        const int rest_n = longer_n - longer_i;
+        vector_multiply_wide( shorter_n, shorter_p, rest_n, longer_p+longer_i,
+                              &product[0] );
+        add_n( result_p+longer_i, result_p+longer_i, &product[0],
+               shorter_n+rest_n );
+    }
+}
+
+// Division of non-negative digit vectors for vector_divide, on limbs by long
+// division or, from vector_barrett_bits, by Barrett division.
+
+void
+vector_divide_digits( const int       numer_hod,
+                      const sc_digit* numer_p,
+                      const int       denom_hod,
+                      const sc_digit* denom_p,
+                      const int       quot_n,
+                      sc_digit*       quot_p,
+                      sc_digit*       remain_p )
+{
+    const int numer_n = numer_hod / limb_digits + 1;
+    const int denom_n = denom_hod / limb_digits + 1;
+
+    // The work area holds the numerator with an extra high order limb and
+    // room for the blocks of the barrett division above it, the
+    // denominator, and the quotient. It stays on the stack unless the
+    // operands are wide:
+
+    const int         work_n = 2*numer_n + 2*denom_n + 2;
+    limb              stack_limbs[stack_limbs_n];
+    std::vector<limb> heap_limbs;
+    limb*             work_p = stack_limbs;
+    if ( work_n > stack_limbs_n ) {
+        heap_limbs.resize( work_n );
+        work_p = &heap_limbs[0];
+    }
+    else {
+        for ( int limb_i = 0; limb_i < work_n; ++limb_i ) {
+            work_p[limb_i] = 0;
+        }
+    }
+    limb* denom_limbs_p = work_p + numer_n + denom_n + 1;
+    limb* quot_limbs_p = denom_limbs_p + denom_n;
+
+    load_digits( numer_hod, numer_p, work_p );
+    load_digits( denom_hod, denom_p, denom_limbs_p );
+
+    if ( 1 == denom_n ) {
+        work_p[0] = divide_short( numer_n, work_p, denom_limbs_p[0],
+                                  quot_limbs_p );
+    }
+    else {
+        const int shift_n = leading_zeros( denom_limbs_p[denom_n-1] );
+        shift_left( denom_limbs_p, denom_limbs_p, denom_n, shift_n );
+        work_p[numer_n] = shift_left( work_p, work_p, numer_n, shift_n );
+        if ( denom_n * limb_bits >= vector_barrett_bits &&
+             numer_n - denom_n >= denom_n / 2 ) {
+            divide_barrett( numer_n+1, work_p, denom_n, denom_limbs_p,
+                            quot_limbs_p );
+        }
+        else {
+            divide_long( numer_n, work_p, denom_n, denom_limbs_p,
+                         quot_limbs_p );
+        }
+        shift_right( work_p, work_p, denom_n, shift_n );
+    }
+
+    // Store the quotient digits that were asked for and the remainder:
+
+    store_digits( numer_n, quot_limbs_p,
+                  quot_n < numer_hod+1 ? quot_n : numer_hod+1, quot_p );
+    store_digits( denom_n, work_p, numer_hod+1, remain_p );
+}
+
+} // namespace sc_dt
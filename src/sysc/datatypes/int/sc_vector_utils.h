@@ -19,6 +19,8 @@
 #if !defined(SC_VECTOR_UTILS_H)
 #define SC_VECTOR_UTILS_H
 
+#include <cstring>
+
 #include "sc_nbdefs.h"
 #include "sc_nbutils.h"
 
@@ -91,7 +93,7 @@ class sc_big_op_info
       add_bits = VEC_MAX(WL+left_extra,WR+right_extra)+1,
       bit_bits = VEC_MAX(WL+left_extra,WR+right_extra),
       div_bits = WL+SR,
-      mod_bits = VEC_MIN(WL,WR+right_extra),
+      mod_bits = VEC_MIN(WL+left_extra,WR+right_extra),
       mul_bits = WL+WR,
       sub_bits = VEC_MAX(WL+left_extra,WR+right_extra)+1,
 
@@ -321,6 +323,97 @@ class ScNativeDigits<unsigned int>
     sc_digit m_digits[DIGITS_N];
 };
 
+#if defined(SC_BIGINT_CONFIG_NATIVE_INT128)
+// +----------------------------------------------------------------------------
+// |"vector_load_128"
+// |
+// | This inline function returns the value of a vector of no more than four
+// | sc_digits as a 128-bit value, extending the sign of its high order digit.
+// |
+// | Template arguments:
+// |     HOD = index of high order digit in 'source_p'.
+// | Arguments:
+// |     source_p = vector of digits to be loaded.
+// | Result:
+// |     twos complement value of 'source_p' as an unsigned 128-bit value.
+// +----------------------------------------------------------------------------
+template<int HOD>
+inline
+uint128
+vector_load_128( const sc_digit* source_p )
+{
+    // Assemble the value from 64-bit halves, the high order one is sign
+    // extended:
+
+    uint64 low;
+    int64  high;
+
+    switch ( HOD ) {
+      case 0:
+        return (uint128)(int128)(int)source_p[0];
+      case 1:
+        return (uint128)(int128)(int64)
+               ( ( (uint64)source_p[1] << BITS_PER_DIGIT ) | source_p[0] );
+      case 2:
+        low = ( (uint64)source_p[1] << BITS_PER_DIGIT ) | source_p[0];
+        high = (int)source_p[2];
+	break;
+      default:
+        low = ( (uint64)source_p[1] << BITS_PER_DIGIT ) | source_p[0];
+        high = (int64)( ( (uint64)source_p[3] << BITS_PER_DIGIT ) | source_p[2] );
+	break;
+    }
+    return ( (uint128)high << 64 ) | low;
+}
+
+// +----------------------------------------------------------------------------
+// |"vector_store_128"
+// |
+// | This inline function stores the low order digits of a 128-bit value into
+// | a vector of no more than four sc_digits.
+// |
+// | Template arguments:
+// |     HOD = index of high order digit in 'target_p'.
+// | Arguments:
+// |     value    = value to be stored.
+// |     target_p = vector of digits to receive 'value'.
+// +----------------------------------------------------------------------------
+template<int HOD>
+inline
+void
+vector_store_128( uint128 value, sc_digit* target_p )
+{
+    const uint64 low = (uint64)value;
+    const uint64 high = (uint64)( value >> 64 );
+
+    // On little endian machines store whole 64-bit halves, so a following
+    // vector_load_128 of the same digits may be forwarded from the stores:
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if ( HOD > 0 ) {
+        std::memcpy( target_p, &low, sizeof(low) );
+        if ( HOD > 2 ) {
+            std::memcpy( target_p+2, &high, sizeof(high) );
+        }
+        else if ( HOD > 1 ) {
+            target_p[2] = (sc_digit)high;
+        }
+        return;
+    }
+#endif // __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    target_p[0] = (sc_digit)low;
+    if ( HOD > 0 ) {
+        target_p[1] = (sc_digit)( low >> BITS_PER_DIGIT );
+    }
+    if ( HOD > 1 ) {
+        target_p[2] = (sc_digit)high;
+    }
+    if ( HOD > 2 ) {
+        target_p[3] = (sc_digit)( high >> BITS_PER_DIGIT );
+    }
+}
+#endif // SC_BIGINT_CONFIG_NATIVE_INT128
+
 // +----------------------------------------------------------------------------
 // |"vector_skip_leading_ones"
 // |
@@ -397,7 +490,54 @@ inline int vector_find_significant_hod( int hod, const sc_digit* digits )
     }
     return result_hod;
 }
-    
+
+// +----------------------------------------------------------------------------
+// |"vector_add_unsigned"
+// |
+// | This function adds the low order digits of two vectors as unsigned
+// | values, returning the carry out of the highest digit. Pairs of digits are
+// | added as 64-bit words, which halves the length of the carry chain.
+// |
+// | Notes:
+// |   (1) Either left_p or right_p may also be result_p without consequences.
+// | Arguments:
+// |     digits_n = number of digits to add.
+// |     left_p   = digits in the left operand.
+// |     right_p  = digits in the right operand.
+// |     result_p = digits to be filled in in the result.
+// | Result:
+// |     carry out of the addition, 0 or 1.
+// +----------------------------------------------------------------------------
+inline
+int64
+vector_add_unsigned( const int       digits_n,
+		     const sc_digit* left_p,
+		     const sc_digit* right_p,
+		     sc_digit*       result_p )
+{
+    uint64 carry = 0;
+    int    digit_i;
+
+    for ( digit_i = 0; digit_i+1 < digits_n; digit_i += 2 ) {
+	const uint64 left = left_p[digit_i] |
+	                    (uint64)left_p[digit_i+1] << BITS_PER_DIGIT;
+	const uint64 right = right_p[digit_i] |
+	                     (uint64)right_p[digit_i+1] << BITS_PER_DIGIT;
+	uint64 sum = left + carry;
+	carry = sum < carry;
+	sum += right;
+	carry += sum < right;
+	result_p[digit_i] = (sc_digit)sum;
+	result_p[digit_i+1] = (sc_digit)(sum >> BITS_PER_DIGIT);
+    }
+    if ( digit_i < digits_n ) {
+	carry += (uint64)left_p[digit_i] + right_p[digit_i];
+	result_p[digit_i] = (sc_digit)carry;
+	carry >>= BITS_PER_DIGIT;
+    }
+    return (int64)carry;
+}
+
 // +----------------------------------------------------------------------------
 // |"vector_add"
 // |
@@ -453,17 +593,19 @@ vector_add( const int       longer_hod,
 	return;
     }
 
-    int64 carry = 0;
+    int64 carry;
     int   digit_i;
 
-    // Add the low order unsigned parts of the operands:
+    // Add the low order unsigned parts of the operands. The shorter operand
+    // is never longer than the longer one, bounding its length tells the
+    // compiler so for native operands:
 
-    for ( digit_i = 0; digit_i < shorter_hod; ++digit_i ) {
-        carry += *shorter_p++;
-        carry += *longer_p++;
-	*result_p++ = (sc_digit)carry;
-	carry >>= BITS_PER_DIGIT;
-    }
+    carry = vector_add_unsigned( VEC_MIN(shorter_hod, longer_hod), longer_p,
+                                 shorter_p, result_p );
+    digit_i = shorter_hod;
+    longer_p += shorter_hod;
+    shorter_p += shorter_hod;
+    result_p += shorter_hod;
 
     // The operands are the same length: add the high order digits as signed
     // values:
@@ -1324,55 +1466,198 @@ class vector_mac
 };
 
 // +----------------------------------------------------------------------------
-// |"vector_multiply"
+// |"vector_limb"
 // |
-// | This inline function will multiply two vectors of sc_digits representing
-// | signed numbers. Some sign extension is left to the caller.
+// | Long multiplication is performed on limbs of two sc_digits if the
+// | compiler provides a 128-bit integer type for their products, and on
+// | single sc_digits otherwise. Limbs are unsigned, vector_multiply applies
+// | the signs of its operands after the unsigned product is formed.
+// +----------------------------------------------------------------------------
+#if defined(__SIZEOF_INT128__)
+    typedef uint64 vector_limb;
+    __extension__ typedef unsigned __int128 vector_limb_product;
+#else
+    typedef sc_digit vector_limb;
+    typedef uint64 vector_limb_product;
+#endif
+
+#define VEC_LIMB_DIGITS ( (int)( sizeof(vector_limb) / sizeof(sc_digit) ) )
+#define VEC_LIMB_BITS   ( VEC_LIMB_DIGITS * BITS_PER_DIGIT )
+#define VEC_STACK_LIMBS 256 // limbs kept on the stack by vector_multiply.
+
+// +----------------------------------------------------------------------------
+// |"vector_load_limbs"
 // |
-// | Notes:
-// |   (1) We use standard long multiplication to generate the result, using
+// | This function loads a signed vector of sc_digits into a vector of limbs,
+// | extending its sign into the digits above its high order digit.
 // |
-// |       Given two numbers, A and B:
+// | Arguments:
+// |     hod      = index of high order digit in 'digits_p'.
+// |     digits_p = digits to be loaded.
+// |     limbs_n  = number of limbs to be filled in.
+// |     limbs_p  = limbs to be filled in.
+// +----------------------------------------------------------------------------
+inline
+void
+vector_load_limbs( const int       hod,
+                   const sc_digit* digits_p,
+                   const int       limbs_n,
+                   vector_limb*    limbs_p )
+{
+    const sc_digit fill = 0 > (int)digits_p[hod] ? ~0u : 0;
+    const int      whole_n = VEC_MIN( (hod+1) / VEC_LIMB_DIGITS, limbs_n );
+    int            limb_i;
+
+    for ( limb_i = 0; limb_i < whole_n; ++limb_i ) {
+        vector_limb limb = 0;
+        for ( int part_i = 0; part_i < VEC_LIMB_DIGITS; ++part_i ) {
+	    limb |= (vector_limb)digits_p[limb_i * VEC_LIMB_DIGITS + part_i]
+	            << ( part_i * BITS_PER_DIGIT );
+	}
+	limbs_p[limb_i] = limb;
+    }
+
+    // Limbs above the high order digit are filled with its sign:
+
+    for ( ; limb_i < limbs_n; ++limb_i ) {
+        vector_limb limb = 0;
+        for ( int part_i = 0; part_i < VEC_LIMB_DIGITS; ++part_i ) {
+	    const int digit_i = limb_i * VEC_LIMB_DIGITS + part_i;
+	    const sc_digit digit = digit_i <= hod ? digits_p[digit_i] : fill;
+	    limb |= (vector_limb)digit << ( part_i * BITS_PER_DIGIT );
+	}
+	limbs_p[limb_i] = limb;
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"vector_multiply_limbs"
 // |
-// |         A:   aS a5 a4 a3 a2 a1
-// |         B:         bS b3 b2 b1
+// | This function multiplies two unsigned vectors of limbs using standard
+// | long multiplication. Each row adds the product of the longer operand and
+// | one limb of the shorter operand into the result, so the carry chain runs
+// | along the longer operand and rows with a zero limb are skipped.
 // |
-// |       Let BPD represent the number of bits per digit.
+// | Arguments:
+// |     longer_n  = number of limbs in 'longer_p'.
+// |     longer_p  = limbs of the longer operand.
+// |     shorter_n = number of limbs in 'shorter_p'.
+// |     shorter_p = limbs of the shorter operand.
+// |     result_p  = longer_n+shorter_n limbs to be filled in with the product.
+// +----------------------------------------------------------------------------
+inline
+void
+vector_multiply_limbs( const int          longer_n,
+                       const vector_limb* longer_p,
+                       const int          shorter_n,
+                       const vector_limb* shorter_p,
+                       vector_limb*       result_p )
+{
+    for ( int result_i = 0; result_i < longer_n; ++result_i ) {
+        result_p[result_i] = 0;
+    }
+
+    for ( int shorter_i = 0; shorter_i < shorter_n; ++shorter_i ) {
+        const vector_limb multiplier = shorter_p[shorter_i];
+	vector_limb*      row_p = &result_p[shorter_i];
+	vector_limb       carry = 0;
+
+	if ( multiplier ) {
+	    for ( int longer_i = 0; longer_i < longer_n; ++longer_i ) {
+		vector_limb_product raw =
+		    (vector_limb_product)longer_p[longer_i] * multiplier;
+		raw += row_p[longer_i];
+		raw += carry;
+		row_p[longer_i] = (vector_limb)raw;
+		carry = (vector_limb)( raw >> VEC_LIMB_BITS );
+	    }
+	}
+	row_p[longer_n] = carry;
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"vector_subtract_limbs"
 // |
-// |       The high-order digit variables for this example:
-// |           * shorter_hod is 4 
-// |           * longer_hod is 6
+// | This function subtracts an unsigned vector of limbs from another one in
+// | place, discarding the borrow out of the highest limb.
 // |
-// |       Long multiplication consists of calculating R from A and B:
+// | Arguments:
+// |     limbs_n  = number of limbs to subtract.
+// |     target_p = limbs to subtract from.
+// |     value_p  = limbs to be subtracted.
+// +----------------------------------------------------------------------------
+inline
+void
+vector_subtract_limbs( const int          limbs_n,
+                       vector_limb*       target_p,
+                       const vector_limb* value_p )
+{
+    vector_limb borrow = 0;
+
+    for ( int limb_i = 0; limb_i < limbs_n; ++limb_i ) {
+        const vector_limb target = target_p[limb_i];
+        const vector_limb value = value_p[limb_i];
+	target_p[limb_i] = target - value - borrow;
+	borrow = ( target < value ) | ( ( target == value ) & borrow );
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"vector_multiply_wide"
+// |
+// | This function multiplies two unsigned vectors of limbs using Karatsuba's
+// | algorithm, which replaces four products of half the operand size with
+// | three, and above that Toom-Cook 3-way multiplication, which replaces
+// | nine products of a third of the operand size with five. The widths from
+// | which they are used are given by vector_karatsuba_bits and
+// | vector_toom3_bits. It is implemented in sc_vector_utils.cpp.
+// |
+// | Arguments:
+// |     longer_n  = number of limbs in the longer operand.
+// |     longer_p  = limbs of the longer operand.
+// |     shorter_n = number of limbs in the shorter operand.
+// |     shorter_p = limbs of the shorter operand.
+// |     result_p  = longer_n+shorter_n limbs to receive the product.
+// +----------------------------------------------------------------------------
+extern
+SC_API void vector_multiply_wide( int                longer_n,
+                                  const vector_limb* longer_p,
+                                  int                shorter_n,
+                                  const vector_limb* shorter_p,
+                                  vector_limb*       result_p );
+
+// Width in bits of the shorter operand from which vector_multiply uses
+// Karatsuba and Toom-Cook 3-way multiplication, and of the denominator from
+// which vector_divide uses Barrett division. These may be tuned by the
+// application.
+extern SC_API int vector_karatsuba_bits;
+extern SC_API int vector_toom3_bits;
+extern SC_API int vector_barrett_bits;
+
+// +----------------------------------------------------------------------------
+// |"vector_multiply"
+// |
+// | This inline function will multiply two vectors of sc_digits representing
+// | signed numbers. The result is sign extended to its high order digit.
 // |
-// |         R: rS r6 r5 r4 r3 r2 r1
+// | Notes:
+// |   (1) Leading zero and all ones digits are trimmed from the operands, and
+// |       the operands are loaded into vectors of limbs, see vector_limb.
+// |       If the operands are small enough the limbs are kept on the stack.
 // |
-// |       The raw terms are:
+// |   (2) The unsigned product of the operands is formed by long
+// |       multiplication, see vector_multiply_limbs. A negative operand is
+// |       its unsigned value less 2**N, where N is its number of bits, so
+// |       for A with N bits and B with M bits:
 // |
-// |         raw1 =               a1 * b1
-// |         raw2 = (raw1 >> BPD) + a2 * b1 + a1 * b2
-// |         raw3 = (raw2 >> BPD) + a3 * b1 + a2 * b2 + a1 * b3
-// |         raw4 = (raw3 >> BPD) + a4 * b1 + a3 * b2 + a2 * b3 + a1 * bS
-// |         raw5 = (raw4 >> BPD) + a5 * b1 + a4 * b2 + a3 * b3 + a2 * bS
-// |         raw6 = (raw5 >> BPD) + aS * b1 + a5 * b2 + a4 * b3 + a3 * bS
-// |         raw7 = (raw6 >> BPD)           + aS * b2 + a5 * b3 + a4 * bS
-// |         raw8 = (raw7 >> BPD)           + aS * b3 + a5 * bS
-// |         raw9 = (raw8 >> BPD)           + aS * bS
-// |         rawS = (raw9 >> BPD)
+// |         A * B = unsigned(A) * unsigned(B)
+// |                 - ( A < 0 ? unsigned(B) * 2**N : 0 )
+// |                 - ( B < 0 ? unsigned(A) * 2**M : 0 )
 // |
-// |       The resultant digits are:
-// |         r1 = raw1 % BPD
-// |         r2 = raw2 % BPD
-// |         r3 = raw3 % BPD
-// |         r4 = raw4 % BPD
-// |         r5 = raw5 % BPD
-// |         r6 = raw6 % BPD
-// |         r7 = raw7 % BPD
-// |         r8 = raw8 % BPD
-// |         r9 = raw9 % BPD
-// |         rS = rawS % BPD
+// |       modulo 2**(N+M), which holds the signed product.
 // |
-// |   (2) It is assumed that result_hod >= longer_hod+shorter_hod.
+// |   (3) It is assumed that result_hod >= longer_hod+shorter_hod.
 // |
 // | Arguments:
 // |     left_hod   =  number of sc_digits in the left operand.
@@ -1393,18 +1678,14 @@ vector_multiply( int             left_hod,
 {
     int             longer_hod;
     const sc_digit* longer_p;
-    vector_mac      mac;
-    int             result_i;
     int             shorter_hod;
     const sc_digit* shorter_p;
 
     // Trim leading zeros and all ones sc_digits to speed up the operation, and use the 
     // shorter result operand is as the multiplier
 
-    if ( true ) {
-	left_hod = vector_find_significant_hod( left_hod, left_p ); 
-	right_hod = vector_find_significant_hod( right_hod, right_p ); 
-    }
+    left_hod = vector_find_significant_hod( left_hod, left_p ); 
+    right_hod = vector_find_significant_hod( right_hod, right_p ); 
     if ( left_hod >= right_hod ) { 
 	longer_hod = left_hod; 
 	longer_p = left_p; 
@@ -1418,88 +1699,61 @@ vector_multiply( int             left_hod,
 	shorter_p = left_p; 
     } 
 
+    // Load the operands into limbs, the product follows them:
 
-    // Set the low order digits in the result that are the product of unsigned digits from both 
-    // operands. For the example in note (1) this is:
-    //    raw1 = a1 * b1
-    //    r1 = raw1 % BPD
-    //    raw2 = a2 * b1 + a1 * b2 + (raw1 >> BPD)
-    //    r2 = raw2 % BPD
-    //    raw3 = a3 * b1 + a2 * b2 + a1 * b3 + (raw2 >> BPD)
-    //    r3 = raw3 % BPD
+    const int longer_n = longer_hod / VEC_LIMB_DIGITS + 1;
+    const int shorter_n = shorter_hod / VEC_LIMB_DIGITS + 1;
+    const int product_n = longer_n + shorter_n;
 
-    for (result_i=0; result_i < shorter_hod; ++result_i ) {
-	for (int other_i=0; other_i <= result_i; ++other_i ) {
-	    mac.add_product( longer_p[result_i-other_i], shorter_p[other_i]);
-	}
-	result_p[result_i] = mac.shift_down();
-    }
-
-    // Set the next higher order digits that are the result of unsigned
-    // digits in the longer operand times all the digits in the shorter
-    // operand. For example 1 at this point the mac contains raw3 shifted,
-    // and the digits set will be:
-    //    raw4 = (raw3 >> BPD) + a4 * b1 + a3 * b2 + a2 * b3 + a1 * bS
-    //    r4 = raw4 % BPD
-    //    raw5 = (raw4 >> BPD) + a5 * b1 + a4 * b2 + a3 * b3 + a2 * bS
-    //    r5 = raw5 % BPD
-    //    raw6 = (raw5 >> BPD) + aS * b1 + a5 * b2 + a4 * b3 + a3 * bS
-    //    r6 = raw6 % BPD
-    //    raw7 = (raw6 >> BPD)           + aS * b2 + a5 * b3 + a4 * bS
-    //    r7 = raw7 % BPD
-    //    raw8 = (raw7 >> BPD)           + aS * b3 + a5 * bS
-    //    r8 = raw8 % BPD
-
-    for ( result_i = shorter_hod; result_i < longer_hod; ++result_i ) {
-	mac.add_product( longer_p[result_i-shorter_hod],
-	                 (int)shorter_p[shorter_hod] );
-	for(int other_i=0; other_i < shorter_hod; ++other_i ) {
-            mac.add_product( longer_p[result_i-other_i], shorter_p[other_i] );
-	}
-	result_p[result_i] = mac.shift_down();
-    }
-
-    // Set the digits in the result that are the product of all the
-    // longer operand digits times all the digits in the shorter operand.
-    // In example 1 at this point the mac contains raw8 shifted and the
-    // digit to be set will be r9:
-    //     raw9 = (raw8 >> BPD)           + aS * bS
-    //     r9 = raw9 % BPD
-
-    for ( result_i=longer_hod; result_i < longer_hod+shorter_hod;
-          ++result_i ) {
-	mac.add_product( longer_p[result_i-shorter_hod],
-			 (int)shorter_p[shorter_hod] );
-	for ( int other_i=result_i-(longer_hod-1); other_i < shorter_hod;
-	      other_i++ ) {
-            mac.add_product( longer_p[result_i-other_i],
-	                  shorter_p[other_i] );
-	}
-        mac.add_product( (int)longer_p[longer_hod],
-	                 shorter_p[result_i-longer_hod] );
-	result_p[result_i] = mac.shift_down();
+    vector_limb  stack_limbs[VEC_STACK_LIMBS];
+    vector_limb* limbs_p = 2*product_n <= VEC_STACK_LIMBS ?
+                           stack_limbs : new vector_limb[2*product_n];
+    vector_limb* longer_limbs_p = limbs_p;
+    vector_limb* shorter_limbs_p = longer_limbs_p + longer_n;
+    vector_limb* product_p = shorter_limbs_p + shorter_n;
+
+    vector_load_limbs( longer_hod, longer_p, longer_n, longer_limbs_p );
+    vector_load_limbs( shorter_hod, shorter_p, shorter_n, shorter_limbs_p );
+    if ( shorter_n * VEC_LIMB_BITS >= vector_karatsuba_bits ||
+         shorter_n * VEC_LIMB_BITS >= vector_toom3_bits ) {
+        vector_multiply_wide( longer_n, longer_limbs_p, shorter_n,
+                              shorter_limbs_p, product_p );
+    }
+    else {
+        vector_multiply_limbs( longer_n, longer_limbs_p, shorter_n,
+                               shorter_limbs_p, product_p );
     }
-        mac.add_product((int)longer_p[longer_hod], (int)shorter_p[shorter_hod]);
-	result_p[longer_hod+shorter_hod] = mac.shift_down();
 
-    // Set the next higher order digit to the signed product of the
-    // operand's high order digits:
-    //
-    // If there are further digits in the result fill the first with the
-    // remaining accumulation. Then fill any remaining digits based on the
-    // on the sign of the accumulation.
-    //     rawS = (raw9 >> BPD)
-    //     rS = rawS % BPD
-
-    if ( (result_hod+1) >= longer_hod+shorter_hod+1) {
-        if ( (result_hod) >= longer_hod+shorter_hod+1 ) {
-	    result_p[longer_hod+shorter_hod+1] = mac.low_bits(); // mac.shift_down();
-	    sc_digit fill = 0 > (int)result_p[longer_hod+shorter_hod+1] ? -1:0;
-	    for ( result_i = longer_hod+shorter_hod+2; result_i <= result_hod;
-	          ++result_i ) {
-	        result_p[result_i] = fill;
-	    }
-        }
+    // Apply the signs of the operands, see note (2):
+
+    if ( 0 > (int)longer_p[longer_hod] ) {
+        vector_subtract_limbs( shorter_n, &product_p[longer_n],
+	                       shorter_limbs_p );
+    }
+    if ( 0 > (int)shorter_p[shorter_hod] ) {
+        vector_subtract_limbs( longer_n, &product_p[shorter_n],
+	                       longer_limbs_p );
+    }
+
+    // Store the product and fill any remaining digits in the result based
+    // on its sign:
+
+    const int product_hod = product_n * VEC_LIMB_DIGITS - 1;
+    const int store_hod = VEC_MIN( product_hod, result_hod );
+    int       result_i;
+
+    for ( result_i = 0; result_i <= store_hod; ++result_i ) {
+        result_p[result_i] = (sc_digit)
+	    ( product_p[result_i / VEC_LIMB_DIGITS] >>
+	      ( ( result_i % VEC_LIMB_DIGITS ) * BITS_PER_DIGIT ) );
+    }
+    const sc_digit fill = 0 > (int)result_p[store_hod] ? ~0u : 0;
+    for ( ; result_i <= result_hod; ++result_i ) {
+        result_p[result_i] = fill;
+    }
+
+    if ( limbs_p != stack_limbs ) {
+        delete [] limbs_p;
     }
 }
 
@@ -1750,20 +2004,25 @@ vector_shift_left( const int       from_digits_n,
 	}
     }
 
-    // The messy case we need to shift within a digit:
+    // The messy case we need to shift within a digit. Each target digit is
+    // composed from two adjacent source digits, so there is no carry from
+    // one digit to the next, and the loop can be vectorized:
 
     else {
-        from_i = 0;
-        sc_digit carry = 0; 
-        for ( ; to_i <= to_end_hod; ++from_i, ++to_i ) {
-	    sc_digit from_digit = from_p[from_i];
-            to_p[to_i] = (from_digit << from_shift_n) | carry;
-            carry = from_digit >> carry_shift_n;
-        }
-	if ( to_i <= to_hod ) { to_p[to_i] = (fill << from_shift_n) | carry; }
-	for ( to_i = to_i+1; to_i <= to_hod; ++to_i ) {
-	    to_p[to_i] = fill;
+        const int from_end_i = to_end_hod - to_start_hod; // last from_p digit moved.
+	if ( to_end_hod < to_hod ) {
+	    to_p[to_end_hod+1] = (fill << from_shift_n) |
+	                         (from_p[from_end_i] >> carry_shift_n);
+	    for ( to_i = to_end_hod+2; to_i <= to_hod; ++to_i ) {
+		to_p[to_i] = fill;
+	    }
 	}
+        for ( to_i = to_end_hod; to_i > to_start_hod; --to_i ) {
+	    from_i = to_i - to_start_hod;
+            to_p[to_i] = (from_p[from_i] << from_shift_n) |
+	                 (from_p[from_i-1] >> carry_shift_n);
+        }
+	to_p[to_start_hod] = from_p[0] << from_shift_n;
     }
 }
 
@@ -1832,21 +2091,20 @@ vector_shift_left( const int target_n,
 
     }
 
-    // Shift left if shift_remaining < BITS_PER_DIGIT.
+    // Shift left if shift_remaining < BITS_PER_DIGIT. Each digit is composed
+    // from itself and the next lower digit, from the top down, so that the
+    // lower digit has not been shifted yet.
 
-    sc_digit* target_iter_p = target_p;
-    sc_digit* target_end_p = target_iter_p + target_n;
+    if (target_n <= 0)
+      return;
 
     int carry_shift = BITS_PER_DIGIT - shift_remaining;
-    sc_digit mask = (sc_digit)one_and_ones(carry_shift);
-
-    sc_carry carry = 0;
 
-    while (target_iter_p < target_end_p) {
-      sc_digit target_value = (*target_iter_p);
-      (*target_iter_p++) = (sc_digit)(((target_value & mask) << shift_remaining) | carry);
-      carry = target_value >> carry_shift;
+    for (int digit_i = target_n - 1; digit_i > 0; --digit_i) {
+      target_p[digit_i] = (target_p[digit_i] << shift_remaining) |
+                          (target_p[digit_i - 1] >> carry_shift);
     }
+    target_p[0] <<= shift_remaining;
 }
 
 // +----------------------------------------------------------------------------
@@ -1915,19 +2173,68 @@ vector_shift_right( const int       target_n,
     // PERFORM INTRA-DIGIT SHIFTING:
     //
     // (1) At this point target_p[0] contains the shift point. Roll through the digits in target_p
-    //     from top to bottom performing shifts smaller than BITS_PER_DIGIT bits.
+    //     from bottom to top performing shifts smaller than BITS_PER_DIGIT bits.
     // (2) Each digit will contain it high order bits as low order bits, and the next digit's
-    //     low order bits as its high order bits.
+    //     low order bits as its high order bits. The next digit has not been shifted yet, so
+    //     there is no carry from one digit to the next, and the loop can be vectorized.
 
-    int      other_shift_n = BITS_PER_DIGIT - bits_n;
-    sc_digit carry = fill << other_shift_n;
-    sc_digit *target_iter_p = (target_p + target_n );
+    if (target_n <= 0) {
+        return;
+    }
+
+    int other_shift_n = BITS_PER_DIGIT - bits_n;
 
-    while (target_p < target_iter_p) {
-        sc_digit target_val = *--target_iter_p;
-        (*target_iter_p) = (target_val >> bits_n) | carry;
-        carry = target_val << other_shift_n;
+    for (int digit_i = 0; digit_i < target_n - 1; ++digit_i) {
+        target_p[digit_i] = (target_p[digit_i] >> bits_n) |
+                            (target_p[digit_i + 1] << other_shift_n);
     }
+    target_p[target_n - 1] = (target_p[target_n - 1] >> bits_n) | (fill << other_shift_n);
+}
+
+// +----------------------------------------------------------------------------
+// |"vector_subtract_unsigned"
+// |
+// | This function subtracts the low order digits of one vector from those of
+// | another as unsigned values, returning the borrow out of the highest digit.
+// | Pairs of digits are subtracted as 64-bit words, which halves the length of
+// | the borrow chain.
+// |
+// | Notes:
+// |   (1) Either left_p or right_p may also be result_p without consequences.
+// | Arguments:
+// |     digits_n = number of digits to subtract.
+// |     left_p   = digits in the operand to subtract from.
+// |     right_p  = digits in the operand to be subtracted.
+// |     result_p = digits to be filled in in the result.
+// | Result:
+// |     borrow out of the subtraction, 0 or -1.
+// +----------------------------------------------------------------------------
+inline
+int64
+vector_subtract_unsigned( const int       digits_n,
+			  const sc_digit* left_p,
+			  const sc_digit* right_p,
+			  sc_digit*       result_p )
+{
+    uint64 borrow = 0;
+    int    digit_i;
+
+    for ( digit_i = 0; digit_i+1 < digits_n; digit_i += 2 ) {
+	const uint64 left = left_p[digit_i] |
+	                    (uint64)left_p[digit_i+1] << BITS_PER_DIGIT;
+	const uint64 right = right_p[digit_i] |
+	                     (uint64)right_p[digit_i+1] << BITS_PER_DIGIT;
+	const uint64 difference = left - right - borrow;
+	borrow = ( left < right ) | ( ( left == right ) & borrow );
+	result_p[digit_i] = (sc_digit)difference;
+	result_p[digit_i+1] = (sc_digit)(difference >> BITS_PER_DIGIT);
+    }
+    if ( digit_i < digits_n ) {
+	const int64 raw = (int64)left_p[digit_i] - right_p[digit_i] - borrow;
+	result_p[digit_i] = (sc_digit)raw;
+	borrow = raw < 0;
+    }
+    return -(int64)borrow;
 }
 
 // +----------------------------------------------------------------------------
@@ -1981,17 +2288,18 @@ vector_subtract_longer( const int       longer_hod,
 	return;
     }
 
-    int64 borrow = 0;
+    int64 borrow;
     int   digit_i;
 
-    // Subtract the low-order unsigned parts of the operands:
+    // Subtract the low-order unsigned parts of the operands, see vector_add
+    // for the bound on the length:
 
-    for ( digit_i = 0; digit_i < shorter_hod; ++digit_i ) {
-        borrow += *shorter_p++;
-        borrow -= *longer_p++;
-	*result_p++ = (sc_digit)borrow;
-	borrow >>= BITS_PER_DIGIT;
-    }
+    borrow = vector_subtract_unsigned( VEC_MIN(shorter_hod, longer_hod),
+                                       shorter_p, longer_p, result_p );
+    digit_i = shorter_hod;
+    longer_p += shorter_hod;
+    shorter_p += shorter_hod;
+    result_p += shorter_hod;
 
     // The operands are the same length: process the high order digits as
     // signed values:
@@ -2086,17 +2394,18 @@ vector_subtract_shorter( const int       longer_hod,
 	return;
     }
 
-    int64 borrow = 0;
+    int64 borrow;
     int   digit_i;
 
-    // Subtract the low-order unsigned parts of the operands:
+    // Subtract the low-order unsigned parts of the operands, see vector_add
+    // for the bound on the length:
 
-    for ( digit_i = 0; digit_i < shorter_hod; ++digit_i ) {
-        borrow -= *shorter_p++;
-        borrow += *longer_p++;
-	*result_p++ = (sc_digit)borrow;
-	borrow >>= BITS_PER_DIGIT;
-    }
+    borrow = vector_subtract_unsigned( VEC_MIN(shorter_hod, longer_hod),
+                                       longer_p, shorter_p, result_p );
+    digit_i = shorter_hod;
+    longer_p += shorter_hod;
+    shorter_p += shorter_hod;
+    result_p += shorter_hod;
 
     // The operands are the same length: treat the high order digits as
     // signed values:
@@ -2186,14 +2495,39 @@ vector_twos_complement( const int       source_hod,
     }
 }
 
+// +----------------------------------------------------------------------------
+// |"vector_divide_digits"
+// |
+// | This function divides a non-negative numerator by a non-negative
+// | denominator on 64-bit limbs, see vector_divide. It is implemented in
+// | sc_vector_utils.cpp.
+// |
+// | Arguments:
+// |     numer_hod = index of the high order digit of the numerator.
+// |     numer_p   = digits of the numerator.
+// |     denom_hod = index of the high order digit of the denominator, which
+// |                 is not zero and not larger than numer_hod.
+// |     denom_p   = digits of the denominator.
+// |     quot_n    = number of digits in 'quot_p' to be filled in.
+// |     quot_p    = digits to receive the quotient.
+// |     remain_p  = numer_hod+1 digits to receive the remainder.
+// +----------------------------------------------------------------------------
+extern
+SC_API void vector_divide_digits( int             numer_hod,
+                                  const sc_digit* numer_p,
+                                  int             denom_hod,
+                                  const sc_digit* denom_p,
+                                  int             quot_n,
+                                  sc_digit*       quot_p,
+                                  sc_digit*       remain_p );
+
 // +----------------------------------------------------------------------------
 // |"vector_divide"
 // |
 // | This function implements division of the supplied numerator by the
-// | supplied denominator. Both are vectors of sc_digit (radix32) values, but
-// | are accessed at times as if they were vectors of radix16 values. Either
-// | the quotient of the division, or the remainder, or both may be returned
-// | depending upon the caller's arguments.
+// | supplied denominator. Both are vectors of sc_digit (radix32) values.
+// | Either the quotient of the division, or the remainder, or both may be
+// | returned depending upon the caller's arguments.
 // |
 // |
 // | Notes:
@@ -2201,10 +2535,11 @@ vector_twos_complement( const int       source_hod,
 // |       Conversion of negative values, as well as conversion to negative
 // |       results is performed to allow the use of non-negative values.
 // |
-// |   (2) The quotient and remainder values are treated as radix-16 values
-// |       at times.
-// |
-// |   (3) The algorithm is basically "long division" from grade school:
+// |   (2) The division itself is performed by vector_divide_digits on
+// |       64-bit limbs, see sc_vector_utils.cpp. It uses "long division"
+// |       from grade school, Knuth's algorithm D, estimating each quotient
+// |       limb from the high order limbs of the remainder and the
+// |       denominator:
 // |
 // |                     X   Y   Z
 // |         +--------------------
@@ -2219,21 +2554,12 @@ vector_twos_complement( const int       source_hod,
 // |	           ---------------
 // |	               r3C r3D r3E
 // |
-// |       The algorithm consists of:
-// |         (a) Creating a remainder vector that initially is the numerator
-// |             for the division operation.
-// |         (b) Calculating a potential quotient radix16 digit using 64-bit
-// |             native division hardware. So divide the high-order 4 radix16
-// |             digits of the current remainder by the the high-order 3
-// |             radix16 digits of the denominator.
-// |         (c) The potential quotient digit is then multiplied by the
-// |             denominator and that value is subtracted from the remainder.
-// |         (d) If the result is negative then the quotient digit was too
-// |             large by one, so adjust the remainder by adding the
-// |             denominator, and decrement the quotient digit by one.
-// |         (e) Store the quotient digit into the quotient vector.
-// |         (f) Steps (b) through (e) are repeated until all the digits in
-// |             the quotient have been calculated.
+// |   (3) From the width given by vector_barrett_bits the denominator is
+// |       instead replaced by its reciprocal, computed with Newton's
+// |       iteration, and the numerator is divided in blocks of the size of
+// |       the denominator by multiplying with the reciprocal (Barrett
+// |       reduction). Its products use vector_multiply_wide, so that the
+// |       division of wide values is no longer quadratic.
 // |
 // | Template arguments:
 // |     SN = true if numerator is signed, false if not.
@@ -2303,24 +2629,18 @@ vector_divide( const int       numerator_n,
 
     // SET UP FOR THE CALCULATION:
     //
-    // (1) Trim the numerator and denominator to highest order non-zero value.
-    // (2) Create the denominator value to use in guesses at the quotient
-    //     digit.
-    // (3) Initialize the remainder array to the value of the numerator.
+    // Trim the numerator and denominator to highest order non-zero value.
 
     int       denom_32_hod;     // high order radix32 denominator digit.
     int       numer_32_hod;     // most significant radix32 numerator digit.
 
     denom_32_hod = vector_skip_leading_zeros( denominator_n-1, denominator_p );
-    bool denom_16_hod_odd = (bool)(denominator_p[denom_32_hod] >> 16);
-    int  denom_16_hod= 2*denom_32_hod + denom_16_hod_odd;
 
     for ( numer_32_hod = numerator_n-1;
           numer_32_hod > 0 && !numerator_p[numer_32_hod];
           --numer_32_hod ) {
         continue;
     }
-    int  numer_16_hod = 2*numer_32_hod + (bool)(numerator_p[numer_32_hod]>>16);
 
     // If the denom is zero we are in trouble...
 
@@ -2331,164 +2651,20 @@ vector_divide( const int       numerator_n,
     // If the numerator was smaller than the denominator return a zero
     // quotient and the numerator as the remainder:
 
-    if ( numer_16_hod < denom_16_hod ) {
+    if ( numer_32_hod < denom_32_hod ) {
 	return true;
     }
 
-
-    // We will estimate the quotient digits by dividing the the first four
-    // radix-16 digits of the current "remainder" value by the first three
-    // radix-16 digits of the denominator, so assemble those three denominator
-    // digits as a value we can use over and over. Use zeros for any missing
-    // low order digits so that we have three properly aligned radix-16 digits.
-
-    uint64 denom_value = (uint64)denominator_p[denom_32_hod] <<
-                  (16 << (int)!denom_16_hod_odd);
-    if ( denom_32_hod ) {
-        denom_value |= denominator_p[denom_32_hod-1] >>
-	               (denom_16_hod_odd ? 16 : 0);
-    }
-
-    // Copy the numerator into the remainder to start off the division process
-    // and zero the extra high order radix32 digit of the remainder:
-
-    sc_digit* remain_work_p = sc_temporary_digits.allocate( numerator_n+10 ); 
-
-    for (int remain_32_i = 0; remain_32_i <= numer_32_hod; ++remain_32_i ) {
-	remain_work_p[remain_32_i] = numerator_p[remain_32_i];
-    }
-    remain_work_p[numer_32_hod+1] = 0;
-
     // CALCULATE THE QUOTIENT AND REMAINDER:
     //
-    // This is done with a pair of nested loops that are applied to the radix-16
-    // representation of the numerator and denominator:
-    //   (a) The outer loop runs downwards from the most significant radix-16
-    //       digit in the numerator through the most significant radix-16 in
-    //       the denominator, effectively the values that will contribute to an
-    //       integer result (the quotient). It calculates the next guess at
-    //       a quotient radix16 digit.
-    //   (b) The inner loop runs upwards from the least significant radix32
-    //       digit in the denominator up through the most significant radix32
-    //       digit in the denominator. It subtracts the product of the
-    //       quotient digit times the denominator from the remainder.
-
-    for ( int quot_16_i = numer_16_hod - denom_16_hod; quot_16_i >= 0;
-	  --quot_16_i ) {
-
-	// Calculate some values we need to navigate our vectors:
-
-	bool quot_16_odd   = quot_16_i & 1;
-	int  quot_32_i     = quot_16_i >> 1;
-	int  remain_16_i   = quot_16_i + denom_16_hod;
-	int  remain_32_i   = remain_16_i >> 1;
-	bool remain_16_odd = remain_16_i & 1;
-
-	// Make an educated guess at the next quotient digit by dividing
-	// the current high-order 4 radix-16 digits of the remainder by the
-	// 3 high-order radix-16 digits of the denominator. Potentially the
-	// result can be larger than the radix, so adjust it down by 1
-	// if necessary.
-
-	sc_digit low_order_bits = remain_32_i > 0 ? remain_work_p[remain_32_i-1] :
-						    (sc_digit) 0;
-	uint64 numer_value;
-	if ( remain_16_odd ) {
-            numer_value = ( (uint64)remain_work_p[remain_32_i+1] << 48 ) |
-	                  ( (uint64)remain_work_p[remain_32_i] << 16 ) |
-			  ( low_order_bits >> 16 );
-	}
-	else {
-	    numer_value = ( (uint64)remain_work_p[remain_32_i] << 32 ) |
-	                    low_order_bits;
-	}
-
-	sc_digit quot_guess = (sc_digit)(numer_value / denom_value);
-	if ( quot_guess >> 16 ) {
-	    quot_guess--;
-	}
-
-	// Subtract off the product of the current guess at the quotient
-	// times the denominator vector from the remainder working vector.
-
-	int64  carry = 0;
-	int64  product;
-	uint64 quot_term = quot_guess << (quot_16_odd ? 16:0);
-
-	for ( int denom_32_i = 0; denom_32_i <= denom_32_hod; ++denom_32_i) {
-	    carry += remain_work_p[quot_32_i + denom_32_i];
-	    bool carry_was_minus = carry < 0;
-	    product = denominator_p[denom_32_i] * quot_term;
-	    bool product_hob_one = (product < 0);
-	    carry -= product;
-	    remain_work_p[quot_32_i + denom_32_i] = (sc_digit)carry;
-	    bool carry_is_minus = carry < 0;
-	    carry >>= 32;
-
-	    // Because we are subtracting two 64-bit numbers to generate the
-	    // remainder values an overflow is possible. If an overflow does
-	    // occur the upper bits of the carry value will not be correct
-	    // after it was shifted down by 32 bits. There are two cases
-	    // requiring correction:
-	    //   (1) If the carry is non-negative, and either it was negative
-	    //       before the addition of the quotient-denominator product,
-	    //       or the high order bit of the quotient-denominator product
-	    //       is one, an overflow occurred and the high order bits of
-	    //       the carry should have become ones when it was shifted down
-	    //       by 32 bits, so set those bits to one.
-	    //   (2) If the carry is negative, and it was negative before
-	    //       the addition of the quotient-denominator product and the
-	    //       high order bit of the quotient-denominator product is one,
-	    //       then the low order bit of the shifted carry has the wrong
-	    //       sense, so flip it.
-
-	    if ( !carry_is_minus && (product_hob_one || carry_was_minus ) ) {
-		carry |= (std::numeric_limits<uint64_t>::max() << 32);
-	    }
-	    else if ( carry_is_minus && product_hob_one && carry_was_minus ) {
-		carry ^= (1LL << 32);
-	    }
-	}
-
-	// If there are an odd number of digits in either the quotient or
-	// denominator there is an extra digit to be processed, so add the
-	// current carry to the remainder for that digit.
+    // This is done on 64-bit limbs by vector_divide_digits, which leaves
+    // the remainder in the low order digits of the work vector.
 
-	if ( quot_16_odd || denom_16_hod_odd ) {
-	    carry += remain_work_p[quot_32_i + denom_32_hod + 1];
-	    remain_work_p[quot_32_i + denom_32_hod + 1] = (sc_digit)carry;
-	}
-
-	// If the carry is negative we overshot by one in our approximation
-	// of the quotient digit, so add back in the denominator once and
-	// decrement the quotient guess by one:
-
-	if(carry < 0) {
-	    carry = 0;
-	    for(int restore_i = 0; restore_i <= denom_32_hod; ++restore_i) {
-		carry += (int64)denominator_p[restore_i] <<
-		                 (quot_16_odd ? 16:0);
-		carry += remain_work_p[quot_32_i + restore_i];
-		remain_work_p[quot_32_i + restore_i] = (sc_digit)carry;
-		carry >>= BITS_PER_DIGIT;
-	    }
-	    if ( quot_16_odd | denom_16_hod_odd ) {
-		remain_work_p[quot_32_i+denom_32_hod+1] += (sc_digit)carry;
-	    }
-	    quot_guess--;
-	}
-
-	// Assign the next quotient digit, if we are returning it:
+    sc_digit* remain_work_p = sc_temporary_digits.allocate( numer_32_hod+1 );
 
-	if( quotient_n && quot_32_i < quotient_n ) { 
-	    if(quot_16_odd) {
-		quotient_p[quot_32_i] = quot_guess << 16;
-	    }
-	    else {
-		quotient_p[quot_32_i] |= quot_guess;
-	    }
-	}
-    }
+    vector_divide_digits( numer_32_hod, numerator_p, denom_32_hod,
+                          denominator_p, quotient_n, quotient_p,
+			  remain_work_p );
 
     // RETURN THE QUOTIENT AND REMAINDER IF REQUESTED:
     //
@@ -2712,6 +2888,9 @@ vector_zero( int from_i, int to_i, sc_digit* target_p )
 
 #undef VEC_MIN
 #undef VEC_MAX
+#undef VEC_LIMB_DIGITS
+#undef VEC_LIMB_BITS
+#undef VEC_STACK_LIMBS
 
 } //namespace sc_dt
 
@@ -37,6 +37,7 @@
 namespace sc_core {
 
 class sc_simcontext;
+struct sc_stack_stats;
 
 
 // ----------------------------------------------------------------------------
@@ -69,6 +70,9 @@ public:
     // switch stack protection on/off
     virtual void stack_protect( bool /* enable */ ) {}
 
+    // peak stack usage in bytes, 0 if the stack has not been painted
+    virtual std::size_t stack_usage() const { return 0; }
+
 private:
 
     // disabled
@@ -107,6 +111,10 @@ public:
     // get the main coroutine
     virtual sc_cor* get_main() = 0;
 
+    // fill in the statistics of the coroutine stacks, if supported
+    virtual bool stack_stats( sc_stack_stats* ) const
+        { return false; }
+
     // get the simulation context
     sc_simcontext* simcontext()
         { return m_simc; }
@@ -35,6 +35,7 @@
 
 #include "sysc/kernel/sc_cor_pthread.h"
 #include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_stack_profile.h"
 #include "sysc/utils/sc_report.h"
 
 using namespace std;
@@ -62,6 +63,7 @@ namespace sc_core {
 
 sc_cor_pthread::sc_cor_pthread()
     : m_cor_fn_arg( 0 ), m_pkg_p( 0 )
+    , m_painted( 0 ), m_painted_size( 0 ), m_unpainted( 0 )
 {
     DEBUGF << this << ": sc_cor_pthread::sc_cor_pthread()" << std::endl;
     pthread_cond_init( &m_pt_condition, PTHREAD_NULL );
@@ -90,6 +92,8 @@ void* sc_cor_pthread::invoke_module_method(void* context_p)
     sc_cor_pthread* p = static_cast<sc_cor_pthread*>(context_p);
     DEBUGF << p << ": sc_cor_pthread::invoke_module_method()" << std::endl;
 
+    if ( p->m_pkg_p->simcontext()->stack_profile() )
+        p->paint_stack();
 
     // SUSPEND THE THREAD SO WE CAN GAIN CONTROL FROM THE PTHREAD PACKAGE:
     //
@@ -118,6 +122,48 @@ void* sc_cor_pthread::invoke_module_method(void* context_p)
 }
 
 
+// The stack of the thread is painted from its lower end (the guard area
+// is not included in the reported bounds) up to a margin below the current
+// frame, which is still in use. The bounds of the stack are only known on
+// systems providing pthread_getattr_np.
+
+void sc_cor_pthread::paint_stack()
+{
+#if defined(__GLIBC__)
+    pthread_attr_t attr;
+    if ( pthread_getattr_np( pthread_self(), &attr ) != 0 )
+        return;
+
+    void*       stack_addr = 0;
+    std::size_t stack_size = 0;
+    pthread_attr_getstack( &attr, &stack_addr, &stack_size );
+    pthread_attr_destroy( &attr );
+
+    char  marker = 0;
+    char* low  = static_cast<char*>( stack_addr );
+    char* high = &marker - 1024;
+    char* top  = static_cast<char*>( stack_addr ) + stack_size;
+    if ( high <= low || top <= high )
+        return;
+
+    m_painted = low;
+    m_painted_size = high - low;
+    m_unpainted = top - high;
+    sc_stack_profile::paint( m_painted, m_painted_size );
+#endif // defined(__GLIBC__)
+}
+
+
+// peak stack usage
+
+std::size_t sc_cor_pthread::stack_usage() const
+{
+    if ( !m_painted )
+        return 0;
+    return sc_stack_profile::usage( m_painted, m_painted_size ) + m_unpainted;
+}
+
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_cor_pkg_pthread
 //
@@ -62,6 +62,12 @@ class sc_cor_pthread : public sc_cor
 	// module method invocator (starts thread execution)
 	static void* invoke_module_method( void* context_p );
 
+    // peak stack usage, if the stack has been painted
+    virtual std::size_t stack_usage() const;
+
+    // paint the unused part of the stack of the calling thread
+    void paint_stack();
+
   public:
 	sc_cor_fn*          m_cor_fn;		// Core function.
 	void*               m_cor_fn_arg;	// Core function argument.
@@ -69,6 +75,9 @@ class sc_cor_pthread : public sc_cor
     sc_cor_pkg_pthread* m_pkg_p;        // the creating coroutine package
 	pthread_cond_t      m_pt_condition; // Condition waiting for.
 	pthread_t           m_thread;       // Our pthread storage.
+    void*               m_painted;      // painted part of the stack, if any
+    std::size_t         m_painted_size;
+    std::size_t         m_unpainted;    // used stack above the painted part
 
 private:
 
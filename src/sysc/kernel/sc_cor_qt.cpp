@@ -34,10 +34,15 @@
 #include <cerrno>
 #include <cstring>
 #include <cstdlib>
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
+#include <vector>
 
 #include "sysc/kernel/sc_cor_qt.h"
 #include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_stack_profile.h"
 #include "sysc/utils/sc_report.h"
 
 namespace sc_core {
@@ -82,35 +87,18 @@ static std::size_t sc_pagesize()
     return pagesize;
 }
 
-// ----------------------------------------------------------------------------
-//  CLASS : sc_cor_qt
-//
-//  Coroutine class implemented with QuickThreads.
-// ----------------------------------------------------------------------------
+// switch the protection of the red zone at the end of a stack on/off
 
-sc_cor_qt::~sc_cor_qt()
-{
-#ifdef SC_LEGACY_MEM_MGMT
-    std::free( m_stack );
-#else
-    if ( m_stack ) {
-        ::munmap( m_stack, m_stack_size );
-    }
-#endif
-}
-
-// switch stack protection on/off
-
-void
-sc_cor_qt::stack_protect( bool enable )
+static void
+stack_redzone_protect( void* stack, std::size_t stack_size, bool enable )
 {
     // Code needs to be tested on HP-UX and disabled if it doesn't work there
     // Code still needs to be ported to WIN32
 
     const std::size_t pagesize = sc_pagesize();
-    sc_assert( m_stack_size > ( 2 * pagesize ) );
+    sc_assert( stack_size > ( 2 * pagesize ) );
 
-    std::size_t sp_addr = reinterpret_cast<std::size_t>(m_stack);
+    std::size_t sp_addr = reinterpret_cast<std::size_t>(stack);
 #ifndef SC_HAVE_POSIX_MEMALIGN
     const std::size_t round_up_mask = pagesize - 1;
     if( sp_addr & round_up_mask ) { // misaligned allocation
@@ -123,7 +111,7 @@ sc_cor_qt::stack_protect( bool enable )
     caddr_t redzone = caddr_t( sp_addr );
 #else
     // Stacks grow from low address up to high address
-    caddr_t redzone = caddr_t( sp_addr + m_stack_size - pagesize );
+    caddr_t redzone = caddr_t( sp_addr + stack_size - pagesize );
 #endif
 
     int ret;
@@ -161,6 +149,181 @@ sc_cor_qt::stack_protect( bool enable )
     }
 }
 
+#ifndef SC_LEGACY_MEM_MGMT
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_cor_qt_stack_pool
+//
+//  Pool of coroutine stacks, which recycles the stacks by their size. A
+//  stack is mapped and its red zone is protected only once. The pages of
+//  a released stack are returned to the system with madvise, while its
+//  address space is kept for the next stack of the same size.
+// ----------------------------------------------------------------------------
+
+class sc_cor_qt_stack_pool
+{
+public:
+
+    sc_cor_qt_stack_pool()
+      : m_mutex(), m_free(), m_live(), m_pooled( 0 ), m_pooled_bytes( 0 )
+    {}
+
+    void* acquire( std::size_t size );
+    void  release( void* stack, std::size_t size );
+    void  stats( sc_stack_stats* stats );
+
+private:
+
+    typedef std::map<std::size_t, std::vector<void*> > free_map;
+    typedef std::unordered_map<void*, std::size_t>     live_map;
+
+    std::mutex  m_mutex;        // spawning may happen on several threads.
+    free_map    m_free;         // released stacks by size.
+    live_map    m_live;         // sizes of the stacks in use.
+    std::size_t m_pooled;       // # of released stacks.
+    std::size_t m_pooled_bytes; // size of the released stacks.
+};
+
+// the pool outlives all simulation contexts and is never destroyed
+static sc_cor_qt_stack_pool&
+stack_pool()
+{
+    static sc_cor_qt_stack_pool* pool = new sc_cor_qt_stack_pool();
+    return *pool;
+}
+
+void*
+sc_cor_qt_stack_pool::acquire( std::size_t size )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    void* stack = NULL;
+
+    free_map::iterator it = m_free.find( size );
+    if( it != m_free.end() && !it->second.empty() ) {
+        stack = it->second.back();
+        it->second.pop_back();
+        m_pooled --;
+        m_pooled_bytes -= size;
+    } else {
+        stack = ::mmap( NULL, size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANON, -1, 0 );
+        if( stack == MAP_FAILED ) {
+            return NULL;
+        }
+        stack_redzone_protect( stack, size, true );
+    }
+    m_live[stack] = size;
+    return stack;
+}
+
+void
+sc_cor_qt_stack_pool::release( void* stack, std::size_t size )
+{
+    // the contents of the stack are no longer needed
+    ::madvise( stack, size, MADV_DONTNEED );
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_live.erase( stack );
+    m_free[size].push_back( stack );
+    m_pooled ++;
+    m_pooled_bytes += size;
+}
+
+// resident memory of a stack as reported by mincore
+
+static std::size_t
+stack_resident_bytes( void* stack, std::size_t size )
+{
+    const std::size_t pagesize = sc_pagesize();
+#if defined(__APPLE__)
+    std::vector<char> pages( size / pagesize );
+#else
+    std::vector<unsigned char> pages( size / pagesize );
+#endif
+    if( ::mincore( stack, size, &pages[0] ) != 0 ) {
+        return 0;
+    }
+
+    std::size_t resident = 0;
+    for( std::size_t i = 0; i < pages.size(); ++i ) {
+        if( pages[i] & 1 ) {
+            resident += pagesize;
+        }
+    }
+    return resident;
+}
+
+void
+sc_cor_qt_stack_pool::stats( sc_stack_stats* stats )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    stats->live_stacks    = m_live.size();
+    stats->pooled_stacks  = m_pooled;
+    stats->reserved_bytes = m_pooled_bytes;
+    stats->resident_bytes = 0;
+
+    for( live_map::const_iterator it = m_live.begin();
+         it != m_live.end(); ++it ) {
+        stats->reserved_bytes += it->second;
+        stats->resident_bytes += stack_resident_bytes( it->first, it->second );
+    }
+    for( free_map::const_iterator it = m_free.begin();
+         it != m_free.end(); ++it ) {
+        for( std::size_t i = 0; i < it->second.size(); ++i ) {
+            stats->resident_bytes +=
+              stack_resident_bytes( it->second[i], it->first );
+        }
+    }
+}
+
+#endif // SC_LEGACY_MEM_MGMT
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_cor_qt
+//
+//  Coroutine class implemented with QuickThreads.
+// ----------------------------------------------------------------------------
+
+sc_cor_qt::~sc_cor_qt()
+{
+#ifdef SC_LEGACY_MEM_MGMT
+    std::free( m_stack );
+#else
+    if ( m_stack ) {
+        stack_pool().release( m_stack, m_stack_size );
+    }
+#endif
+}
+
+// switch stack protection on/off
+
+void
+sc_cor_qt::stack_protect( bool enable )
+{
+#ifdef SC_LEGACY_MEM_MGMT
+    stack_redzone_protect( m_stack, m_stack_size, enable );
+#else
+    // the red zone of a pooled stack stays protected (see stack_pool)
+    (void) enable;
+#endif
+}
+
+// peak stack usage
+
+std::size_t
+sc_cor_qt::stack_usage() const
+{
+    if( !m_painted )
+        return 0;
+#ifdef QUICKTHREADS_GROW_DOWN
+    return sc_stack_profile::usage( m_painted, m_painted_size, true );
+#else
+    return sc_stack_profile::usage( m_painted, m_painted_size, false );
+#endif
+}
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_cor_pkg_qt
 //
@@ -199,11 +362,7 @@ stack_alloc( void** buf, std::size_t* stack_size )
     }
     return reinterpret_cast<void*>( sp_addr );
 #else
-    *buf = ::mmap( NULL, *stack_size, PROT_READ | PROT_WRITE,
-                   MAP_PRIVATE | MAP_ANON, -1, 0 );
-    if ( *buf == MAP_FAILED ) {
-        *buf = NULL;
-    }
+    *buf = stack_pool().acquire( *stack_size );
     return *buf;
 #endif
 }
@@ -265,6 +424,18 @@ sc_cor_pkg_qt::create( std::size_t stack_size, sc_cor_fn* fn, void* arg )
                        , "failed to allocate stack memory" );
         sc_abort();
     }
+    if( simcontext()->stack_profile() )
+    {
+        // paint all of the stack except for the red zone
+        const std::size_t pagesize = sc_pagesize();
+#ifdef QUICKTHREADS_GROW_DOWN
+        cor->m_painted = static_cast<char*>( aligned_sp ) + pagesize;
+#else
+        cor->m_painted = aligned_sp;
+#endif
+        cor->m_painted_size = cor->m_stack_size - pagesize;
+        sc_stack_profile::paint( cor->m_painted, cor->m_painted_size );
+    }
     cor->m_sp = QUICKTHREADS_SP( aligned_sp, cor->m_stack_size );
     cor->m_sp = QUICKTHREADS_ARGS( cor->m_sp, arg, cor, (qt_userf_t*) fn,
                                    sc_cor_qt_wrapper );
@@ -319,6 +490,21 @@ sc_cor_pkg_qt::get_main()
     return &m_main_cor;
 }
 
+
+// fill in the statistics of the coroutine stacks
+
+bool
+sc_cor_pkg_qt::stack_stats( sc_stack_stats* stats ) const
+{
+#ifdef SC_LEGACY_MEM_MGMT
+    (void) stats;
+    return false;
+#else
+    stack_pool().stats( stats );
+    return true;
+#endif
+}
+
 } // namespace sc_core
 
 #endif
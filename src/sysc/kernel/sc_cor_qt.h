@@ -55,6 +55,7 @@ public:
     // constructor
     sc_cor_qt()
       : m_stack_size( 0 ), m_stack( 0 ), m_sp( 0 ), m_pkg( 0 )
+      , m_painted( 0 ), m_painted_size( 0 )
     {}
 
     // destructor
@@ -63,6 +64,9 @@ public:
     // switch stack protection on/off
     virtual void stack_protect( bool enable );
 
+    // peak stack usage, if the stack has been painted
+    virtual std::size_t stack_usage() const;
+
 public:
     std::size_t    m_stack_size;  // stack size
     void*          m_stack;       // stack
@@ -70,6 +74,9 @@ public:
 
     sc_cor_pkg_qt* m_pkg;         // the creating coroutine package
 
+    void*          m_painted;     // painted part of the stack, if any
+    std::size_t    m_painted_size;
+
 private:
     // disabled
     sc_cor_qt( const sc_cor_qt& );
@@ -106,6 +113,9 @@ public:
     // get the main coroutine
     virtual sc_cor* get_main();
 
+    // fill in the statistics of the coroutine stacks
+    virtual bool stack_stats( sc_stack_stats* stats ) const;
+
     // set the current coroutine (internal helper)
     inline sc_cor_qt* set_current( sc_cor_qt* );
 
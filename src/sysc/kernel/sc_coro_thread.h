@@ -0,0 +1,426 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_coro_thread.h -- Stackless thread processes based on C++20 coroutines.
+
+                      An SC_CORO_THREAD is a member function returning
+                      sc_coro_task, which suspends with co_await co_wait(...)
+                      instead of wait(...). It is executed by a method
+                      process, which resumes the coroutine whenever it is
+                      triggered, so it needs no stack of its own.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_CORO_THREAD_H_INCLUDED_
+#define SC_CORO_THREAD_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+
+#if SC_CPLUSPLUS >= 202002L && defined(__cpp_impl_coroutine)
+
+#include "sysc/kernel/sc_module.h"
+#include "sysc/kernel/sc_process_handle.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_wait.h"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <utility>
+
+#define SC_HAS_CORO_THREAD_ 1
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coro_task
+//
+//  Return type of the body of an SC_CORO_THREAD and of coroutines called
+//  from it. A task is started lazily: the body of an SC_CORO_THREAD when
+//  its process is first executed, a nested task when it is co_awaited.
+//  The task owns the coroutine frame.
+// ----------------------------------------------------------------------------
+
+class sc_coro_task
+{
+public:
+
+    class promise_type
+    {
+        friend class sc_coro_task;
+
+        // resumes the awaiting coroutine, once this one is done
+        struct final_awaiter
+        {
+            bool await_ready() const noexcept
+                { return false; }
+
+            std::coroutine_handle<>
+            await_suspend( std::coroutine_handle<promise_type> h ) noexcept
+            {
+                promise_type& p = h.promise();
+                if( !p.m_parent )
+                    return std::noop_coroutine();
+                *p.m_active = p.m_parent;
+                return p.m_parent;
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+    public:
+
+        promise_type()
+          : m_parent(), m_active( 0 ), m_exception()
+        {}
+
+        sc_coro_task get_return_object()
+            { return sc_coro_task(
+                std::coroutine_handle<promise_type>::from_promise( *this ) ); }
+
+        std::suspend_always initial_suspend() const noexcept
+            { return std::suspend_always(); }
+
+        final_awaiter final_suspend() const noexcept
+            { return final_awaiter(); }
+
+        void return_void() {}
+
+        void unhandled_exception()
+            { m_exception = std::current_exception(); }
+
+        // number of bytes allocated for coroutine frames, all threads
+        static void* operator new( std::size_t size )
+        {
+            frame_bytes() += size;
+            return ::operator new( size );
+        }
+
+        static void operator delete( void* p, std::size_t size )
+        {
+            frame_bytes() -= size;
+            ::operator delete( p );
+        }
+
+        static std::size_t& frame_bytes()
+        {
+            static thread_local std::size_t bytes = 0;
+            return bytes;
+        }
+
+    private:
+        std::coroutine_handle<>  m_parent;    // awaiting coroutine, if any.
+        std::coroutine_handle<>* m_active;    // innermost running coroutine.
+        std::exception_ptr       m_exception; // exception left the body.
+    };
+
+    typedef std::coroutine_handle<promise_type> handle_type;
+
+    sc_coro_task() : m_handle() {}
+
+    sc_coro_task( sc_coro_task&& other ) noexcept
+      : m_handle( std::exchange( other.m_handle, handle_type() ) )
+    {}
+
+    sc_coro_task& operator = ( sc_coro_task&& other ) noexcept
+    {
+        if( this != &other ) {
+            destroy();
+            m_handle = std::exchange( other.m_handle, handle_type() );
+        }
+        return *this;
+    }
+
+    ~sc_coro_task()
+        { destroy(); }
+
+    bool valid() const
+        { return static_cast<bool>( m_handle ); }
+
+    bool done() const
+        { return !m_handle || m_handle.done(); }
+
+    // start the task as the outermost coroutine of a process, active
+    // receives the innermost coroutine to be resumed on the next trigger
+    void start( std::coroutine_handle<>* active )
+    {
+        m_handle.promise().m_active = active;
+        *active = m_handle;
+    }
+
+    // rethrow an exception, which left the body of the task
+    void rethrow()
+    {
+        if( m_handle && m_handle.promise().m_exception )
+            std::rethrow_exception( m_handle.promise().m_exception );
+    }
+
+    // co_await of a nested task from another task
+
+    bool await_ready() const noexcept
+        { return !m_handle || m_handle.done(); }
+
+    std::coroutine_handle<>
+    await_suspend( handle_type parent ) noexcept
+    {
+        promise_type& p = m_handle.promise();
+        p.m_parent = parent;
+        p.m_active = parent.promise().m_active;
+        *p.m_active = m_handle;
+        return m_handle;
+    }
+
+    void await_resume()
+        { rethrow(); }
+
+private:
+
+    explicit sc_coro_task( handle_type h ) : m_handle( h ) {}
+
+    void destroy()
+    {
+        if( m_handle ) {
+            m_handle.destroy();
+            m_handle = handle_type();
+        }
+    }
+
+    handle_type m_handle;
+
+private:
+
+    // disabled
+    sc_coro_task( const sc_coro_task& );
+    sc_coro_task& operator = ( const sc_coro_task& );
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coro_awaiter
+//
+//  Result of co_wait(...), which suspends the calling coroutine until its
+//  process is triggered again.
+// ----------------------------------------------------------------------------
+
+class [[nodiscard]] sc_coro_awaiter
+{
+public:
+    bool await_ready() const noexcept
+        { return false; }
+
+    void await_suspend( std::coroutine_handle<> ) const noexcept {}
+
+    void await_resume() const noexcept {}
+};
+
+
+// ----------------------------------------------------------------------------
+//  FUNCTION : co_wait
+//
+//  The counterparts of wait(...) for coroutine threads. They set the
+//  trigger of the process like next_trigger(...) does, and the coroutine
+//  is resumed when the trigger occurs. co_wait() waits for the static
+//  sensitivity of the process. Use timed_out() after a wait with timeout.
+// ----------------------------------------------------------------------------
+
+inline sc_coro_awaiter
+co_wait()
+    { return sc_coro_awaiter(); }
+
+inline sc_coro_awaiter
+co_wait( const sc_event& e )
+    { next_trigger( e ); return sc_coro_awaiter(); }
+
+inline sc_coro_awaiter
+co_wait( const sc_event_or_list& el )
+    { next_trigger( el ); return sc_coro_awaiter(); }
+
+inline sc_coro_awaiter
+co_wait( const sc_event_and_list& el )
+    { next_trigger( el ); return sc_coro_awaiter(); }
+
+inline sc_coro_awaiter
+co_wait( const sc_time& t )
+    { next_trigger( t ); return sc_coro_awaiter(); }
+
+inline sc_coro_awaiter
+co_wait( double v, sc_time_unit tu )
+    { next_trigger( v, tu ); return sc_coro_awaiter(); }
+
+inline sc_coro_awaiter
+co_wait( const sc_time& t, const sc_event& e )
+    { next_trigger( t, e ); return sc_coro_awaiter(); }
+
+inline sc_coro_awaiter
+co_wait( double v, sc_time_unit tu, const sc_event& e )
+    { next_trigger( v, tu, e ); return sc_coro_awaiter(); }
+
+inline sc_coro_awaiter
+co_wait( const sc_time& t, const sc_event_or_list& el )
+    { next_trigger( t, el ); return sc_coro_awaiter(); }
+
+inline sc_coro_awaiter
+co_wait( double v, sc_time_unit tu, const sc_event_or_list& el )
+    { next_trigger( v, tu, el ); return sc_coro_awaiter(); }
+
+inline sc_coro_awaiter
+co_wait( const sc_time& t, const sc_event_and_list& el )
+    { next_trigger( t, el ); return sc_coro_awaiter(); }
+
+inline sc_coro_awaiter
+co_wait( double v, sc_time_unit tu, const sc_event_and_list& el )
+    { next_trigger( v, tu, el ); return sc_coro_awaiter(); }
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coro_process_host
+//
+//  Semantics of the method process executing a coroutine thread. The body
+//  is called on the first execution of the process, each later execution
+//  resumes the innermost suspended coroutine. The process is killed when
+//  the body returns, which notifies its terminated event. Blocking calls
+//  like wait(...) or a b_transport() waiting in the target are not allowed
+//  within the body, neither is a reset of the process.
+// ----------------------------------------------------------------------------
+
+class sc_coro_process_host : public sc_process_host
+{
+public:
+
+    sc_coro_process_host() : m_task(), m_active() {}
+
+    void semantics()
+    {
+        if( !m_task.valid() ) {
+            m_task = body();
+            m_task.start( &m_active );
+        }
+
+        m_active.resume();
+
+        if( m_task.done() ) {
+            m_task.rethrow();
+            sc_get_current_process_handle().kill();
+        }
+    }
+
+protected:
+
+    virtual sc_coro_task body() = 0;
+
+private:
+
+    sc_coro_task            m_task;   // outermost coroutine.
+    std::coroutine_handle<> m_active; // innermost suspended coroutine.
+};
+
+
+template< typename Module >
+class sc_coro_member_host : public sc_coro_process_host
+{
+public:
+
+    typedef sc_coro_task (Module::*member_type)();
+
+    sc_coro_member_host( Module* module_p, member_type member )
+      : m_module_p( module_p ), m_member( member )
+    {}
+
+protected:
+
+    virtual sc_coro_task body()
+        { return ( m_module_p->*m_member )(); }
+
+private:
+
+    Module*     m_module_p;
+    member_type m_member;
+};
+
+template< typename Module >
+inline sc_process_host*
+sc_make_coro_host( Module* module_p, sc_coro_task (Module::*member)() )
+{
+    return new sc_coro_member_host<Module>( module_p, member );
+}
+
+// ----------------------------------------------------------------------------
+//  FUNCTION : sc_spawn_coro
+//
+//  Spawns a coroutine thread, the body is an object whose () operator
+//  returns sc_coro_task (e.g. a coroutine lambda). The object is kept by
+//  the process. Like sc_spawn, the options may give the sensitivity.
+// ----------------------------------------------------------------------------
+
+template< typename F >
+class sc_coro_spawn_host : public sc_coro_process_host
+{
+public:
+
+    explicit sc_coro_spawn_host( F object ) : m_object( object ) {}
+
+protected:
+
+    virtual sc_coro_task body()
+        { return m_object(); }
+
+private:
+
+    F m_object;
+};
+
+template< typename F >
+inline sc_process_handle
+sc_spawn_coro( F object, const char* name_p = 0,
+               const sc_spawn_options* opt_p = 0 )
+{
+    return sc_get_curr_simcontext()->create_method_process( name_p, true,
+      SC_MAKE_FUNC_PTR( sc_coro_process_host, semantics ),
+      new sc_coro_spawn_host<F>( object ), opt_p );
+}
+
+} // namespace sc_core
+
+// SC_CORO_THREAD(func) - func is a member function returning sc_coro_task,
+// the created process accepts sensitive and dont_initialize() as usual.
+
+#define SC_CORO_THREAD(func)                                                  \
+    this->declare_coro_thread_process                                         \
+      ( ::sc_core::sc_make_coro_host                                          \
+          ( this, &SC_CURRENT_USER_MODULE_TYPE::func ),                       \
+        SC_MAKE_FUNC_PTR(::sc_core::sc_coro_process_host, semantics), #func ) \
+    SC_SEMICOLON_
+
+#endif // C++20 coroutines
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_CORO_THREAD_H_INCLUDED_
+// Taf!
@@ -0,0 +1,176 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_elab_profile.cpp -- Run time and allocations of the elaboration stages.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_elab_profile.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_module_registry.h"
+#include "sysc/communication/sc_port.h"
+#include "sysc/communication/sc_export.h"
+#include "sysc/communication/sc_prim_channel.h"
+
+#include <chrono>
+#include <iomanip>
+#include <ostream>
+
+#if defined(__GLIBC__) && \
+    ( __GLIBC__ > 2 || ( __GLIBC__ == 2 && __GLIBC_MINOR__ >= 33 ) )
+#   include <malloc.h>
+#   define SC_ELAB_PROFILE_MALLINFO2_
+#endif
+
+namespace sc_core {
+
+namespace {
+
+const char* const stage_names[sc_elab_profile::stage_count] =
+{
+    "construction",
+    "before_end_of_elaboration",
+    "complete_binding",
+    "end_of_elaboration",
+    "start_of_simulation",
+    "initialization"
+};
+
+} // anonymous namespace
+
+
+sc_elab_profile::allocation_counter sc_elab_profile::m_counter = 0;
+
+sc_elab_profile::sc_elab_profile( sc_simcontext* simc )
+  : m_simc( simc )
+  , m_counted( false )
+  , m_done( 0 )
+{
+    restart();
+}
+
+void
+sc_elab_profile::restart()
+{
+    m_counted = ( m_counter != 0 );
+    m_done = 0;
+    take( m_samples[0] );
+}
+
+void
+sc_elab_profile::set_allocation_counter( allocation_counter counter )
+{
+    m_counter = counter;
+}
+
+void
+sc_elab_profile::take( sample& s ) const
+{
+    s.wall_time = static_cast<sc_dt::uint64>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count() );
+    s.allocations = 0;
+    s.bytes = 0;
+    if( m_counted ) {
+        m_counter( s.allocations, s.bytes );
+    } else {
+#if defined(SC_ELAB_PROFILE_MALLINFO2_)
+        struct mallinfo2 info = mallinfo2();
+        s.bytes = info.uordblks + info.hblkhd;
+#endif
+    }
+}
+
+// a stage, which has been skipped, takes no time
+
+void
+sc_elab_profile::end_of( stage s )
+{
+    if( s < m_done )
+        return;
+
+    sample now;
+    take( now );
+    while( m_done <= s )
+        m_samples[++m_done] = now;
+}
+
+void
+sc_elab_profile::print( std::ostream& os ) const
+{
+    std::ios_base::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+
+    os << std::setw(28) << std::left << "stage" << std::right
+       << std::setw(12) << "time (ms)";
+    if( m_counted ) {
+        os << std::setw(14) << "allocations"
+           << std::setw(14) << "bytes";
+    } else {
+        os << std::setw(14) << "heap growth";
+    }
+    os << "\n" << std::fixed << std::setprecision(3);
+
+    for( int i = 0; i < m_done; ++i )
+        print_line( os, stage_names[i], m_samples[i], m_samples[i + 1] );
+    if( m_done > 1 )
+        print_line( os, "total", m_samples[0], m_samples[m_done] );
+
+    os << m_simc->get_module_registry()->size() << " modules, "
+       << m_simc->get_port_registry()->size() << " ports, "
+       << m_simc->get_export_registry()->size() << " exports, "
+       << m_simc->get_prim_channel_registry()->size()
+       << " primitive channels";
+
+    os.flags( flags );
+    os.precision( precision );
+}
+
+void
+sc_elab_profile::print_line( std::ostream& os, const char* name,
+                             const sample& begin, const sample& end ) const
+{
+    os << std::setw(28) << std::left << name << std::right
+       << std::setw(12) << ( end.wall_time - begin.wall_time ) / 1e6;
+    if( m_counted ) {
+        os << std::setw(14) << end.allocations - begin.allocations
+           << std::setw(14) << end.bytes - begin.bytes;
+    } else {
+        // the heap may also shrink
+        os << std::setw(14)
+           << static_cast<long long>( end.bytes - begin.bytes );
+    }
+    os << "\n";
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,128 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_elab_profile.h -- Run time and allocations of the elaboration stages.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_ELAB_PROFILE_H_INCLUDED_
+#define SC_ELAB_PROFILE_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+
+#include <iosfwd>
+
+namespace sc_core {
+
+class sc_simcontext;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_elab_profile
+//
+//  Measures the wall-clock time and the memory allocations of each stage
+//  from the construction of the module hierarchy to the start of the
+//  simulation. The simulation context marks the end of each stage, the
+//  next stage begins at the same time.
+//
+//  The allocations are taken from the counter installed by
+//  sc_set_elab_allocation_counter(). Without a counter, the growth of the
+//  heap is taken from the C library where it is available (glibc).
+// ----------------------------------------------------------------------------
+
+class SC_API sc_elab_profile
+{
+public:
+
+    enum stage
+    {
+        construction = 0,          // until sc_start()
+        before_end_of_elaboration, // callbacks, including new objects
+        complete_binding,          // of all ports
+        end_of_elaboration,        // callbacks and resets
+        start_of_simulation,       // callbacks and coroutine package
+        initialization,            // until the first delta cycle
+        stage_count
+    };
+
+    // cumulative number and size of the allocations of the program
+    typedef void (*allocation_counter)( sc_dt::uint64& allocations,
+                                        sc_dt::uint64& bytes );
+
+    explicit sc_elab_profile( sc_simcontext* simc );
+
+    // the construction stage begins now
+    void restart();
+
+    // the given stage is done, the next one begins
+    void end_of( stage s );
+
+    // all stages are done
+    bool done() const
+        { return m_done == stage_count; }
+
+    // write the report of the stages done so far
+    void print( std::ostream& os ) const;
+
+    static void set_allocation_counter( allocation_counter counter );
+
+private:
+
+    struct sample
+    {
+        sc_dt::uint64 wall_time;   // in nanoseconds
+        sc_dt::uint64 allocations; // 0 without a counter
+        sc_dt::uint64 bytes;       // allocated or in use
+    };
+
+    void take( sample& s ) const;
+    void print_line( std::ostream& os, const char* name,
+                     const sample& begin, const sample& end ) const;
+
+    sc_simcontext* m_simc;
+    bool           m_counted;      // allocations from a counter.
+    int            m_done;         // number of stages done.
+    sample         m_samples[stage_count + 1];
+
+    static allocation_counter m_counter;
+
+private:
+
+    // disabled
+    sc_elab_profile( const sc_elab_profile& );
+    sc_elab_profile& operator = ( const sc_elab_profile& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_ELAB_PROFILE_H_INCLUDED_
+// Taf!
@@ -58,9 +58,52 @@ sc_event::basename() const
     return p ? (p + 1) : m_name.c_str();
 }
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_notify_lock
+//
+//  Serializes the notifications of the parallel-safe methods, which are
+//  evaluated concurrently by sc_parallel_evaluator. Outside of a parallel
+//  batch, it does not lock anything.
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class sc_notify_lock
+{
+public:
+
+    explicit sc_notify_lock( sc_host_mutex* mtx )
+      : m_mtx( mtx )
+    {
+        if( SC_UNLIKELY_( m_mtx != 0 ) )
+            m_mtx->lock();
+    }
+
+    ~sc_notify_lock()
+    {
+        if( SC_UNLIKELY_( m_mtx != 0 ) )
+            m_mtx->unlock();
+    }
+
+private:
+
+    sc_host_mutex* m_mtx;
+
+private:
+
+    // disabled
+    sc_notify_lock( const sc_notify_lock& );
+    sc_notify_lock& operator = ( const sc_notify_lock& );
+};
+
+} // namespace
+
+
 void
 sc_event::cancel()
 {
+    sc_notify_lock lock( m_simc->concurrent_notify_mutex() );
+
     // cancel a delta or timed notification
     switch( m_notify_type ) {
     case DELTA: {
@@ -103,6 +146,8 @@ sc_event::notify()
 void
 sc_event::notify( const sc_time& t )
 {
+    sc_notify_lock lock( m_simc->concurrent_notify_mutex() );
+
     if( m_notify_type == DELTA ) {
         return;
     }
@@ -169,6 +214,7 @@ void
 sc_event::notify_delayed()
 {
     sc_warn_notify_delayed();
+    sc_notify_lock lock( m_simc->concurrent_notify_mutex() );
     if( m_notify_type != NONE ) {
         SC_REPORT_ERROR( SC_ID_NOTIFY_DELAYED_, 0 );
     }
@@ -181,6 +227,7 @@ void
 sc_event::notify_delayed( const sc_time& t )
 {
     sc_warn_notify_delayed();
+    sc_notify_lock lock( m_simc->concurrent_notify_mutex() );
     if( m_notify_type != NONE ) {
         SC_REPORT_ERROR( SC_ID_NOTIFY_DELAYED_, 0 );
     }
@@ -259,10 +306,8 @@ sc_event::reset()
     m_notify_type = NONE;
     m_delta_event_index = -1;
     m_timed = 0;
-    // clear the dynamic sensitive methods
-    m_methods_dynamic.resize(0);
-    // clear the dynamic sensitive threads
-    m_threads_dynamic.resize(0);
+    // clear the dynamic sensitive methods and threads
+    m_waiters.clear_dynamic();
 }
 
 // +----------------------------------------------------------------------------
@@ -281,10 +326,7 @@ sc_event::sc_event( const char* name )
   , m_notify_type( NONE )
   , m_delta_event_index( -1 )
   , m_timed( 0 )
-  , m_methods_static()
-  , m_methods_dynamic()
-  , m_threads_static()
-  , m_threads_dynamic()
+  , m_waiters()
   , m_name()
   , m_parent_with_hierarchy_flag(NULL)
 {
@@ -304,10 +346,7 @@ sc_event::sc_event()
   , m_notify_type( NONE )
   , m_delta_event_index( -1 )
   , m_timed( 0 )
-  , m_methods_static()
-  , m_methods_dynamic()
-  , m_threads_static()
-  , m_threads_dynamic()
+  , m_waiters()
   , m_name()
   , m_parent_with_hierarchy_flag(NULL)
 {
@@ -327,10 +366,7 @@ sc_event::sc_event( kernel_tag, const char* name )
   , m_notify_type( NONE )
   , m_delta_event_index( -1 )
   , m_timed( 0 )
-  , m_methods_static()
-  , m_methods_dynamic()
-  , m_threads_static()
-  , m_threads_dynamic()
+  , m_waiters()
   , m_name()
   , m_parent_with_hierarchy_flag(NULL)
 {
@@ -347,6 +383,8 @@ sc_event::sc_event( kernel_tag, const char* name )
 sc_event::~sc_event()
 {
     cancel();
+    if( SC_UNLIKELY_( m_simc->kernel_profile() ) )
+        m_simc->kernel_profile()->event_destroyed( this );
     if( in_hierarchy() )
     {
         sc_object_manager* object_manager_p = m_simc->get_object_manager();
@@ -358,13 +396,13 @@ sc_event::~sc_event()
             m_simc->remove_child_event( this );
     }
 
-    for(size_t i = 0; i < m_threads_dynamic.size(); ++i ) {
-        if( m_threads_dynamic[i]->m_event_p == this )
-            m_threads_dynamic[i]->m_event_p = 0;
+    for( int i = 0; i < m_waiters.size_threads_dynamic(); ++i ) {
+        if( m_waiters.thread_dynamic( i )->m_event_p == this )
+            m_waiters.thread_dynamic( i )->m_event_p = 0;
     }
-    for(size_t i = 0; i < m_methods_dynamic.size(); ++i ) {
-        if( m_methods_dynamic[i]->m_event_p == this )
-            m_methods_dynamic[i]->m_event_p = 0;
+    for( int i = 0; i < m_waiters.size_methods_dynamic(); ++i ) {
+        if( m_waiters.method_dynamic( i )->m_event_p == this )
+            m_waiters.method_dynamic( i )->m_event_p = 0;
     }
 }
 
@@ -383,72 +421,90 @@ sc_event::trigger()
     m_delta_event_index = -1;
     m_timed = 0;
 
-    int       last_i; // index of last element in vector now accessing.
-    int       size;   // size of vector now accessing.
+    if( SC_UNLIKELY_( m_simc->kernel_profile() ) )
+        m_simc->kernel_profile()->triggered( this );
 
+    int       size;   // size of list now accessing.
 
-    // trigger the static sensitive methods
+    // trigger the static sensitive methods, the methods to run are chained
+    // up and appended to the runnable queue at once
 
-    if( ( size = m_methods_static.size() ) != 0 )
+    if( ( size = m_waiters.size_methods_static() ) != 0 )
     {
-        sc_method_handle* l_methods_static = &m_methods_static[0];
+        sc_method_handle first_h = 0;
+        sc_method_handle last_h = 0;
         int i = size - 1;
         do {
-            sc_method_handle method_h = l_methods_static[i];
-            method_h->trigger_static();
+            sc_method_handle method_h = m_waiters.method_static( i );
+            if ( method_h->trigger_static() )
+            {
+                // link the method to itself, marking it as runnable
+                method_h->set_next_runnable( method_h );
+                if ( last_h )
+                    last_h->set_next_runnable( method_h );
+                else
+                    first_h = method_h;
+                last_h = method_h;
+            }
         } while( -- i >= 0 );
+        if ( first_h )
+            m_simc->push_runnable_methods( first_h, last_h );
     }
 
     // trigger the dynamic sensitive methods
 
-
-    if( ( size = m_methods_dynamic.size() ) != 0 )
+    if( ( size = m_waiters.size_methods_dynamic() ) != 0 )
     {
-	last_i = size - 1;
-	sc_method_handle* l_methods_dynamic = &m_methods_dynamic[0];
-	for ( int i = 0; i <= last_i; i++ )
+	for ( int i = 0; i < size; i++ )
 	{
-	    sc_method_handle method_h = l_methods_dynamic[i];
+	    sc_method_handle method_h = m_waiters.method_dynamic( i );
 	    if ( method_h->trigger_dynamic( this ) )
 	    {
-		l_methods_dynamic[i] = l_methods_dynamic[last_i];
-		last_i--;
+		m_waiters.remove_method_dynamic( i );
+		size--;
 		i--;
 	    }
 	}
-        m_methods_dynamic.resize(last_i+1);
     }
 
-
     // trigger the static sensitive threads
 
-    if( ( size = m_threads_static.size() ) != 0 )
+    if( ( size = m_waiters.size_threads_static() ) != 0 )
     {
-        sc_thread_handle* l_threads_static = &m_threads_static[0];
+        sc_thread_handle first_h = 0;
+        sc_thread_handle last_h = 0;
         int i = size - 1;
         do {
-            sc_thread_handle thread_h = l_threads_static[i];
-            thread_h->trigger_static();
+            sc_thread_handle thread_h = m_waiters.thread_static( i );
+            if ( thread_h->trigger_static() )
+            {
+                // link the thread to itself, marking it as runnable
+                thread_h->set_next_runnable( thread_h );
+                if ( last_h )
+                    last_h->set_next_runnable( thread_h );
+                else
+                    first_h = thread_h;
+                last_h = thread_h;
+            }
         } while( -- i >= 0 );
+        if ( first_h )
+            m_simc->push_runnable_threads( first_h, last_h );
     }
 
     // trigger the dynamic sensitive threads
 
-    if( ( size = m_threads_dynamic.size() ) != 0 )
+    if( ( size = m_waiters.size_threads_dynamic() ) != 0 )
     {
-	last_i = size - 1;
-	sc_thread_handle* l_threads_dynamic = &m_threads_dynamic[0];
-	for ( int i = 0; i <= last_i; i++ )
+	for ( int i = 0; i < size; i++ )
 	{
-	    sc_thread_handle thread_h = l_threads_dynamic[i];
+	    sc_thread_handle thread_h = m_waiters.thread_dynamic( i );
 	    if ( thread_h->trigger_dynamic( this ) )
 	    {
-		l_threads_dynamic[i] = l_threads_dynamic[last_i];
+		m_waiters.remove_thread_dynamic( i );
+		size--;
 		i--;
-		last_i--;
 	    }
 	}
-        m_threads_dynamic.resize(last_i+1);
     }
 }
 
@@ -457,19 +513,39 @@ bool sc_event::triggered() const
     return m_trigger_stamp == m_simc->change_stamp();
 }
 
+// A statically sensitive process counts only while it expects a static
+// trigger, see the trigger_static() methods of the processes.
+
+bool
+sc_event::awaited() const
+{
+    if( m_waiters.size_methods_dynamic() != 0 ||
+        m_waiters.size_threads_dynamic() != 0 ) {
+        return true;
+    }
+    for( int i = m_waiters.size_methods_static() - 1; i >= 0; -- i ) {
+        if( m_waiters.method_static( i )->m_trigger_type ==
+            sc_process_b::STATIC ) {
+            return true;
+        }
+    }
+    for( int i = m_waiters.size_threads_static() - 1; i >= 0; -- i ) {
+        if( m_waiters.thread_static( i )->m_trigger_type ==
+            sc_process_b::STATIC ) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool
 sc_event::remove_static( sc_method_handle method_h_ ) const
 {
-    int size;
-    if ( ( size = m_methods_static.size() ) != 0 ) {
-      sc_method_handle* l_methods_static = &m_methods_static[0];
-      for( int i = size - 1; i >= 0; -- i ) {
-          if( l_methods_static[i] == method_h_ ) {
-              l_methods_static[i] = l_methods_static[size - 1];
-              m_methods_static.resize(size-1);
-              return true;
-          }
-      }
+    for( int i = m_waiters.size_methods_static() - 1; i >= 0; -- i ) {
+        if( m_waiters.method_static( i ) == method_h_ ) {
+            m_waiters.remove_method_static( i );
+            return true;
+        }
     }
     return false;
 }
@@ -477,16 +553,11 @@ sc_event::remove_static( sc_method_handle method_h_ ) const
 bool
 sc_event::remove_static( sc_thread_handle thread_h_ ) const
 {
-    int size;
-    if ( ( size = m_threads_static.size() ) != 0 ) {
-      sc_thread_handle* l_threads_static = &m_threads_static[0];
-      for( int i = size - 1; i >= 0; -- i ) {
-          if( l_threads_static[i] == thread_h_ ) {
-              l_threads_static[i] = l_threads_static[size - 1];
-              m_threads_static.resize(size-1);
-              return true;
-          }
-      }
+    for( int i = m_waiters.size_threads_static() - 1; i >= 0; -- i ) {
+        if( m_waiters.thread_static( i ) == thread_h_ ) {
+            m_waiters.remove_thread_static( i );
+            return true;
+        }
     }
     return false;
 }
@@ -494,16 +565,11 @@ sc_event::remove_static( sc_thread_handle thread_h_ ) const
 bool
 sc_event::remove_dynamic( sc_method_handle method_h_ ) const
 {
-    int size;
-    if ( ( size = m_methods_dynamic.size() ) != 0 ) {
-      sc_method_handle* l_methods_dynamic = &m_methods_dynamic[0];
-      for( int i = size - 1; i >= 0; -- i ) {
-          if( l_methods_dynamic[i] == method_h_ ) {
-              l_methods_dynamic[i] = l_methods_dynamic[size - 1];
-              m_methods_dynamic.resize(size-1);
-              return true;
-          }
-      }
+    for( int i = m_waiters.size_methods_dynamic() - 1; i >= 0; -- i ) {
+        if( m_waiters.method_dynamic( i ) == method_h_ ) {
+            m_waiters.remove_method_dynamic( i );
+            return true;
+        }
     }
     return false;
 }
@@ -511,28 +577,106 @@ sc_event::remove_dynamic( sc_method_handle method_h_ ) const
 bool
 sc_event::remove_dynamic( sc_thread_handle thread_h_ ) const
 {
-    int size;
-    if ( ( size= m_threads_dynamic.size() ) != 0 ) {
-      sc_thread_handle* l_threads_dynamic = &m_threads_dynamic[0];
-      for( int i = size - 1; i >= 0; -- i ) {
-          if( l_threads_dynamic[i] == thread_h_ ) {
-              l_threads_dynamic[i] = l_threads_dynamic[size - 1];
-              m_threads_dynamic.resize(size-1);
-              return true;
-          }
-      }
+    for( int i = m_waiters.size_threads_dynamic() - 1; i >= 0; -- i ) {
+        if( m_waiters.thread_dynamic( i ) == thread_h_ ) {
+            m_waiters.remove_thread_dynamic( i );
+            return true;
+        }
     }
     return false;
 }
 
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_event_waiter_list
+//
+//  The processes sensitive to an event, statically or dynamically.
+// ----------------------------------------------------------------------------
+
+sc_event_waiter_list::sc_event_waiter_list()
+  : m_data( m_inline )
+  , m_capacity( INLINE_SIZE )
+  , m_methods_static( 0 )
+  , m_threads_static( 0 )
+  , m_methods_dynamic( 0 )
+  , m_threads_dynamic( 0 )
+{}
+
+sc_event_waiter_list::~sc_event_waiter_list()
+{
+    if( m_data != m_inline )
+        delete [] m_data;
+}
+
+void
+sc_event_waiter_list::push_back_static( sc_method_handle method_h )
+{
+    if( full() )
+        grow();
+    // make room behind the static methods
+    std::memmove( m_data + m_methods_static + 1, m_data + m_methods_static,
+                  ( m_threads_static + m_methods_dynamic ) * sizeof(void*) );
+    m_data[m_methods_static++] = method_h;
+}
+
+void
+sc_event_waiter_list::push_back_static( sc_thread_handle thread_h )
+{
+    if( full() )
+        grow();
+    // make room behind the static threads
+    std::memmove( m_data + dynamic_begin() + 1, m_data + dynamic_begin(),
+                  m_methods_dynamic * sizeof(void*) );
+    m_data[m_methods_static + m_threads_static++] = thread_h;
+}
+
+void
+sc_event_waiter_list::remove_method_static( int i )
+{
+    m_data[i] = m_data[--m_methods_static];
+    // close the gap behind the static methods
+    std::memmove( m_data + m_methods_static, m_data + m_methods_static + 1,
+                  ( m_threads_static + m_methods_dynamic ) * sizeof(void*) );
+}
+
+void
+sc_event_waiter_list::remove_thread_static( int i )
+{
+    m_data[m_methods_static + i] =
+      m_data[m_methods_static + --m_threads_static];
+    // close the gap behind the static threads
+    std::memmove( m_data + dynamic_begin(), m_data + dynamic_begin() + 1,
+                  m_methods_dynamic * sizeof(void*) );
+}
+
+void
+sc_event_waiter_list::grow()
+{
+    int    capacity = 2 * m_capacity;
+    void** data = new void*[capacity];
+    int    front = dynamic_begin() + m_methods_dynamic;
+
+    std::memcpy( data, m_data, front * sizeof(void*) );
+    std::memcpy( data + capacity - m_threads_dynamic,
+                 m_data + m_capacity - m_threads_dynamic,
+                 m_threads_dynamic * sizeof(void*) );
+
+    if( m_data != m_inline )
+        delete [] m_data;
+    m_data = data;
+    m_capacity = capacity;
+}
+
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_event_timed
 //
 //  Class for storing the time to notify a timed event.
 // ----------------------------------------------------------------------------
 
-// dedicated memory management; not MT-Safe
+// dedicated memory management; not MT-Safe, timed notifications of
+// parallel-safe method processes allocate under sc_notify_lock, and the
+// kernel frees the notifications between parallel batches
 
 union sc_event_timed_u
 {
@@ -55,6 +55,7 @@ class sc_signal_channel;
 
 // friend function declarations
 SC_API int sc_notify_time_compare( const void*, const void* );
+SC_API sc_dt::uint64 sc_notify_time_key( const void* );
 
 // ----------------------------------------------------------------------------
 //  CLASS : sc_event_expr
@@ -247,6 +248,105 @@ public:
 
 typedef sc_event_expr<sc_event_or_list> sc_event_or_expr;
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_event_waiter_list
+//
+//  The processes sensitive to an event, statically or dynamically.
+//
+//  All four lists are kept in a single array, which is stored inline for up
+//  to four processes. The static lists and the dynamic methods grow from
+//  the front of the array, the dynamic threads grow from its back, so that
+//  adding a dynamic sensitivity, which happens on every wait, never has to
+//  move other entries:
+//
+//    | methods  | threads  | methods      ...      threads |
+//    | (static) | (static) | (dynamic) ->     <- (dynamic) |
+//
+//  FOR INTERNAL USE ONLY!
+// ----------------------------------------------------------------------------
+
+class SC_API sc_event_waiter_list
+{
+public:
+
+    sc_event_waiter_list();
+    ~sc_event_waiter_list();
+
+    int size_methods_static() const  { return m_methods_static; }
+    int size_threads_static() const  { return m_threads_static; }
+    int size_methods_dynamic() const { return m_methods_dynamic; }
+    int size_threads_dynamic() const { return m_threads_dynamic; }
+
+    sc_method_handle method_static( int i ) const
+        { return static_cast<sc_method_handle>( m_data[i] ); }
+    sc_thread_handle thread_static( int i ) const
+        { return static_cast<sc_thread_handle>( m_data[m_methods_static+i] ); }
+    sc_method_handle method_dynamic( int i ) const
+        { return static_cast<sc_method_handle>( m_data[dynamic_begin()+i] ); }
+    sc_thread_handle thread_dynamic( int i ) const
+        { return static_cast<sc_thread_handle>( m_data[m_capacity-1-i] ); }
+
+    void push_back_static( sc_method_handle );
+    void push_back_static( sc_thread_handle );
+    inline void push_back_dynamic( sc_method_handle );
+    inline void push_back_dynamic( sc_thread_handle );
+
+    // remove the i-th entry, the last entry takes its place
+    void remove_method_static( int i );
+    void remove_thread_static( int i );
+    void remove_method_dynamic( int i )
+        { m_data[dynamic_begin()+i] =
+            m_data[dynamic_begin()+ --m_methods_dynamic]; }
+    void remove_thread_dynamic( int i )
+        { m_data[m_capacity-1-i] = m_data[m_capacity- m_threads_dynamic--]; }
+
+    void clear_dynamic()
+        { m_methods_dynamic = m_threads_dynamic = 0; }
+
+private:
+
+    int dynamic_begin() const
+        { return m_methods_static + m_threads_static; }
+    bool full() const
+        { return dynamic_begin() + m_methods_dynamic + m_threads_dynamic
+                 == m_capacity; }
+    void grow();
+
+private:
+
+    enum { INLINE_SIZE = 4 };
+
+    void** m_data;            // the array, m_inline or heap allocated.
+    int    m_capacity;        // size of the array.
+    int    m_methods_static;  // number of statically sensitive methods.
+    int    m_threads_static;  // number of statically sensitive threads.
+    int    m_methods_dynamic; // number of dynamically sensitive methods.
+    int    m_threads_dynamic; // number of dynamically sensitive threads.
+    void*  m_inline[INLINE_SIZE];
+
+private:
+
+    // disabled
+    sc_event_waiter_list( const sc_event_waiter_list& );
+    sc_event_waiter_list& operator = ( const sc_event_waiter_list& );
+};
+
+inline void
+sc_event_waiter_list::push_back_dynamic( sc_method_handle method_h )
+{
+    if( full() )
+        grow();
+    m_data[dynamic_begin() + m_methods_dynamic++] = method_h;
+}
+
+inline void
+sc_event_waiter_list::push_back_dynamic( sc_thread_handle thread_h )
+{
+    if( full() )
+        grow();
+    m_data[m_capacity - 1 - m_threads_dynamic++] = thread_h;
+}
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_event
 //
@@ -264,6 +364,8 @@ class SC_API sc_event
     friend class sc_method_process;
     friend class sc_thread_process;
     friend void sc_thread_cor_fn( void* arg );
+    friend class sc_async_event;
+    template<typename T> friend class sc_async_fifo;
     friend class sc_clock;
     friend class sc_event_queue;
     friend class sc_signal_channel;
@@ -318,6 +420,10 @@ private:
     void notify_internal( const sc_time& );
     void notify_next_delta();
 
+    // is a process waiting for this event, or sensitive to it and not
+    // waiting for something else?
+    bool awaited() const;
+
     bool remove_static( sc_method_handle ) const;
     bool remove_static( sc_thread_handle ) const;
     bool remove_dynamic( sc_method_handle ) const;
@@ -338,10 +444,7 @@ private:
     int             m_delta_event_index;
     sc_event_timed* m_timed;
 
-    mutable std::vector<sc_method_handle> m_methods_static;
-    mutable std::vector<sc_method_handle> m_methods_dynamic;
-    mutable std::vector<sc_thread_handle> m_threads_static;
-    mutable std::vector<sc_thread_handle> m_threads_dynamic;
+    mutable sc_event_waiter_list m_waiters; // sensitive processes.
 
     std::string                 m_name;     // name of the event
     sc_ptr_flag<sc_object_host> m_parent_with_hierarchy_flag; // parent object of
@@ -368,6 +471,7 @@ class SC_API sc_event_timed
     friend class sc_simcontext;
 
     friend SC_API int sc_notify_time_compare( const void*, const void* );
+    friend SC_API sc_dt::uint64 sc_notify_time_key( const void* );
 
 private:
 
@@ -461,28 +565,36 @@ inline
 void
 sc_event::add_static( sc_method_handle method_h ) const
 {
-    m_methods_static.push_back( method_h );
+    m_waiters.push_back_static( method_h );
+    if( SC_UNLIKELY_( !m_simc->m_sleeping_clocks.empty() ) )
+        m_simc->wake_clocks( this );
 }
 
 inline
 void
 sc_event::add_static( sc_thread_handle thread_h ) const
 {
-    m_threads_static.push_back( thread_h );
+    m_waiters.push_back_static( thread_h );
+    if( SC_UNLIKELY_( !m_simc->m_sleeping_clocks.empty() ) )
+        m_simc->wake_clocks( this );
 }
 
 inline
 void
 sc_event::add_dynamic( sc_method_handle method_h ) const
 {
-    m_methods_dynamic.push_back( method_h );
+    m_waiters.push_back_dynamic( method_h );
+    if( SC_UNLIKELY_( !m_simc->m_sleeping_clocks.empty() ) )
+        m_simc->wake_clocks( this );
 }
 
 inline
 void
 sc_event::add_dynamic( sc_thread_handle thread_h ) const
 {
-    m_threads_dynamic.push_back( thread_h );
+    m_waiters.push_back_dynamic( thread_h );
+    if( SC_UNLIKELY_( !m_simc->m_sleeping_clocks.empty() ) )
+        m_simc->wake_clocks( this );
 }
 
 
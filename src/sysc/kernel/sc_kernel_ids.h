@@ -208,6 +208,22 @@ SC_DEFINE_MESSAGE(SC_ID_UNSUSPENDABLE_NOTHREAD_  , 577,
         "unsuspendable/suspendable only valid inside a process" )
 SC_DEFINE_MESSAGE(SC_ID_UNBALANCED_UNSUSPENDALL_ , 578,
         "Unmatched unsuspendall/suspendall" )
+SC_DEFINE_MESSAGE(SC_ID_SET_PARALLEL_SAFE_         , 579,
+        "set_parallel_safe() is only allowed for SC_METHODs" )
+SC_DEFINE_MESSAGE(SC_ID_PARALLEL_EVALUATE_AFTER_START_, 580,
+        "attempt to set parallel evaluation after start will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_STACK_PROFILING_AFTER_START_, 581,
+        "attempt to set stack profiling after start will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_STACK_PROFILE_            , 582,
+        "peak stack usage of thread processes" )
+SC_DEFINE_MESSAGE(SC_ID_KERNEL_PROFILING_AFTER_START_, 583,
+        "attempt to set kernel profiling after start will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_KERNEL_PROFILE_           , 584,
+        "run time of processes and activity of events" )
+SC_DEFINE_MESSAGE(SC_ID_ELAB_PROFILING_AFTER_START_, 585,
+        "attempt to set elaboration profiling after elaboration will be ignored" )
+SC_DEFINE_MESSAGE(SC_ID_ELAB_PROFILE_             , 586,
+        "run time and allocations of the elaboration stages" )
 
 /*****************************************************************************
 
@@ -0,0 +1,442 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_kernel_profile.cpp -- Run time of processes and activity of events.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_kernel_profile.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_process.h"
+#include "sysc/kernel/sc_simcontext.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+namespace sc_core {
+
+namespace {
+
+// number of processes and events listed in the report
+const std::size_t report_lines = 20;
+
+// number of time slices and time steps recorded for the trace
+const std::size_t trace_limit = 1 << 20;
+
+// removed from the names of kernel events, see sc_event.cpp
+const char kernel_event_prefix[] = "$$$$kernel_event$$$$_";
+
+const char* process_kind( const sc_process_b* process_p )
+{
+    switch( process_p->proc_kind() ) {
+      case SC_METHOD_PROC_:  return "method";
+      case SC_THREAD_PROC_:  return "thread";
+      case SC_CTHREAD_PROC_: return "cthread";
+      default:               return "";
+    }
+}
+
+// bucket of the delta cycle histogram: 0, 1, 2, 3-4, 5-8, ...
+std::size_t delta_bucket( sc_dt::uint64 deltas )
+{
+    std::size_t bucket = 0;
+    if( deltas ) {
+        bucket = 1;
+        for( sc_dt::uint64 d = deltas - 1; d; d >>= 1 )
+            ++bucket;
+    }
+    return bucket;
+}
+
+// nanoseconds in milliseconds or microseconds with three decimals
+std::string fixed( sc_dt::uint64 value, sc_dt::uint64 unit )
+{
+    std::ostringstream os;
+    os << value / unit << '.'
+       << std::setw(3) << std::setfill('0') << value % unit * 1000 / unit;
+    return os.str();
+}
+
+void write_json_string( std::ostream& os, const std::string& s )
+{
+    os << '"';
+    for( std::size_t i = 0; i < s.size(); ++i ) {
+        unsigned char c = static_cast<unsigned char>( s[i] );
+        if( c == '"' || c == '\\' ) {
+            os << '\\' << s[i];
+        } else if( c < 0x20 ) {
+            os << "\\u00" << "0123456789abcdef"[c >> 4]
+                          << "0123456789abcdef"[c & 0xf];
+        } else {
+            os << s[i];
+        }
+    }
+    os << '"';
+}
+
+} // anonymous namespace
+
+
+sc_kernel_profile::sc_kernel_profile( sc_simcontext* simc,
+                                      const std::string& trace_file )
+  : m_simc( simc )
+  , m_trace_file( trace_file )
+  , m_start( 0 )
+  , m_processes()
+  , m_process_index()
+  , m_events()
+  , m_event_index()
+  , m_unnamed_events( no_entry )
+  , m_started( false )
+  , m_current( no_entry )
+  , m_slice_begin( 0 )
+  , m_kernel_time( 0 )
+  , m_slices()
+  , m_truncated( false )
+  , m_timesteps( 0 )
+  , m_deltas( 0 )
+  , m_max_deltas( 0 )
+  , m_max_deltas_time( 0 )
+  , m_delta_histogram()
+  , m_delta_samples()
+{
+    m_start = now();
+}
+
+sc_dt::uint64
+sc_kernel_profile::now() const
+{
+    return static_cast<sc_dt::uint64>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count() )
+      - m_start;
+}
+
+// The time before the start of the simulation (the elaboration) is not
+// accounted.
+
+void
+sc_kernel_profile::start()
+{
+    if( !m_started ) {
+        m_started = true;
+        m_slice_begin = now();
+    }
+}
+
+void
+sc_kernel_profile::update()
+{
+    sc_dt::uint64 end = now();
+    if( !m_started )
+        return;
+
+    if( m_current != no_entry ) {
+        m_processes[m_current].time += end - m_slice_begin;
+    } else {
+        m_kernel_time += end - m_slice_begin;
+    }
+
+    if( m_slices.size() < trace_limit ) {
+        slice s;
+        s.process = m_current;
+        s.begin = m_slice_begin;
+        s.end = end;
+        s.sim_time = m_simc->time_stamp().value();
+        m_slices.push_back( s );
+    } else {
+        m_truncated = true;
+    }
+    m_slice_begin = end;
+}
+
+void
+sc_kernel_profile::switch_to( const sc_process_b* process_p )
+{
+    if( !process_p ) {
+        if( m_current != no_entry ) {
+            update();
+            m_current = no_entry;
+        }
+        return;
+    }
+    update();
+
+    std::pair<std::unordered_map<const sc_process_b*, std::size_t>::iterator,
+              bool> ins =
+      m_process_index.insert( std::make_pair( process_p, m_processes.size() ) );
+    if( ins.second ) {
+        process_entry e;
+        e.name = process_p->name();
+        e.kind = process_kind( process_p );
+        e.activations = 0;
+        e.time = 0;
+        m_processes.push_back( e );
+    }
+    m_current = ins.first->second;
+}
+
+void
+sc_kernel_profile::triggered( const sc_event* event_p )
+{
+    std::unordered_map<const sc_event*, std::size_t>::iterator it =
+      m_event_index.find( event_p );
+    if( it != m_event_index.end() ) {
+        ++m_events[it->second].triggers;
+        return;
+    }
+
+    // the events created during the simulation without a name share an
+    // entry
+    std::size_t index = m_events.size();
+    if( !*event_p->name() && m_unnamed_events != no_entry ) {
+        index = m_unnamed_events;
+    } else {
+        event_entry e;
+        e.name = *event_p->name() ? event_p->name() : "(unnamed events)";
+        std::string::size_type pos = e.name.find( kernel_event_prefix );
+        if( pos != std::string::npos )
+            e.name.erase( pos, sizeof( kernel_event_prefix ) - 1 );
+        e.triggers = 0;
+        m_events.push_back( e );
+        if( !*event_p->name() )
+            m_unnamed_events = index;
+    }
+    m_event_index.insert( std::make_pair( event_p, index ) );
+    ++m_events[index].triggers;
+}
+
+void
+sc_kernel_profile::timestep( sc_dt::uint64 deltas )
+{
+    ++m_timesteps;
+    m_deltas += deltas;
+    if( deltas > m_max_deltas ) {
+        m_max_deltas = deltas;
+        m_max_deltas_time = m_simc->time_stamp().value();
+    }
+
+    std::size_t bucket = delta_bucket( deltas );
+    if( m_delta_histogram.size() <= bucket )
+        m_delta_histogram.resize( bucket + 1 );
+    ++m_delta_histogram[bucket];
+
+    if( m_delta_samples.size() < trace_limit ) {
+        delta_sample s;
+        s.wall_time = now();
+        s.deltas = deltas;
+        m_delta_samples.push_back( s );
+    } else {
+        m_truncated = true;
+    }
+}
+
+void
+sc_kernel_profile::process_destroyed( const sc_process_b* process_p )
+{
+    m_process_index.erase( process_p );
+}
+
+void
+sc_kernel_profile::event_destroyed( const sc_event* event_p )
+{
+    m_event_index.erase( event_p );
+}
+
+void
+sc_kernel_profile::print( std::ostream& os )
+{
+    update();
+
+    std::vector<std::size_t> order( m_processes.size() );
+    sc_dt::uint64 process_time = 0;
+    sc_dt::uint64 activations = 0;
+    for( std::size_t i = 0; i < m_processes.size(); ++i ) {
+        order[i] = i;
+        process_time += m_processes[i].time;
+        activations += m_processes[i].activations;
+    }
+    sc_dt::uint64 total = process_time + m_kernel_time;
+    if( total == 0 )
+        total = 1;
+
+    // longest run time first
+    struct by_time
+    {
+        const std::vector<process_entry>& p;
+        bool operator()( std::size_t a, std::size_t b ) const
+        {
+            if( p[a].time != p[b].time )
+                return p[a].time > p[b].time;
+            return p[a].name < p[b].name;
+        }
+    };
+    by_time process_order = { m_processes };
+    std::sort( order.begin(), order.end(), process_order );
+
+    os << std::setw(40) << std::left << "process"
+       << std::setw(8) << "kind" << std::right
+       << std::setw(13) << "activations"
+       << std::setw(12) << "time [ms]"
+       << std::setw(8) << "share"
+       << std::setw(12) << "avg [us]" << "\n";
+    for( std::size_t i = 0; i < order.size() && i < report_lines; ++i ) {
+        const process_entry& e = m_processes[order[i]];
+        os << std::setw(40) << std::left << e.name
+           << std::setw(8) << e.kind << std::right
+           << std::setw(13) << e.activations
+           << std::setw(12) << fixed( e.time, 1000000 )
+           << std::setw(7) << e.time * 100 / total << "%"
+           << std::setw(12)
+           << fixed( e.activations ? e.time / e.activations : 0, 1000 )
+           << "\n";
+    }
+    if( order.size() > report_lines ) {
+        os << "(" << order.size() - report_lines << " more processes)\n";
+    }
+    os << order.size() << " processes, " << activations << " activations, "
+       << fixed( process_time, 1000000 ) << " ms in processes, "
+       << fixed( m_kernel_time, 1000000 ) << " ms in the kernel\n\n";
+
+    // most triggers first
+    struct by_triggers
+    {
+        const std::vector<event_entry>& e;
+        bool operator()( std::size_t a, std::size_t b ) const
+        {
+            if( e[a].triggers != e[b].triggers )
+                return e[a].triggers > e[b].triggers;
+            return e[a].name < e[b].name;
+        }
+    };
+    order.resize( m_events.size() );
+    sc_dt::uint64 triggers = 0;
+    for( std::size_t i = 0; i < m_events.size(); ++i ) {
+        order[i] = i;
+        triggers += m_events[i].triggers;
+    }
+    by_triggers event_order = { m_events };
+    std::sort( order.begin(), order.end(), event_order );
+
+    os << std::setw(60) << std::left << "event" << std::right
+       << std::setw(13) << "triggers" << "\n";
+    for( std::size_t i = 0; i < order.size() && i < report_lines; ++i ) {
+        const event_entry& e = m_events[order[i]];
+        os << std::setw(60) << std::left << e.name << std::right
+           << std::setw(13) << e.triggers << "\n";
+    }
+    if( order.size() > report_lines ) {
+        os << "(" << order.size() - report_lines << " more events)\n";
+    }
+    os << order.size() << " events, " << triggers << " triggers\n\n";
+
+    // the current time step is not completed yet
+    sc_dt::uint64 deltas = m_simc->delta_count_at_current_time();
+    std::vector<sc_dt::uint64> histogram( m_delta_histogram );
+    std::size_t bucket = delta_bucket( deltas );
+    if( histogram.size() <= bucket )
+        histogram.resize( bucket + 1 );
+    ++histogram[bucket];
+
+    sc_dt::uint64 max_deltas = m_max_deltas;
+    sc_dt::uint64 max_deltas_time = m_max_deltas_time;
+    if( deltas > max_deltas ) {
+        max_deltas = deltas;
+        max_deltas_time = m_simc->time_stamp().value();
+    }
+
+    os << m_timesteps + 1 << " time steps, " << m_deltas + deltas
+       << " delta cycles, at most " << max_deltas << " at "
+       << sc_time::from_value( max_deltas_time ) << "\n"
+       << "delta cycles per time step:";
+    for( std::size_t i = 0; i < histogram.size(); ++i ) {
+        if( !histogram[i] )
+            continue;
+        os << "  ";
+        if( i < 3 ) {
+            os << i;
+        } else {
+            os << ( sc_dt::uint64( 1 ) << ( i - 2 ) ) + 1 << "-"
+               << ( sc_dt::uint64( 1 ) << ( i - 1 ) );
+        }
+        os << ": " << histogram[i];
+    }
+    if( m_truncated ) {
+        os << "\nthe trace has been truncated after " << trace_limit
+           << " entries";
+    }
+}
+
+// The time slices of the processes and of the kernel are written as
+// complete events of a single thread, the delta cycles of the time steps
+// as a counter.
+
+void
+sc_kernel_profile::write_trace( std::ostream& os )
+{
+    update();
+
+    os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+       << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+          "\"args\":{\"name\":\"SystemC\"}},\n"
+       << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,"
+          "\"args\":{\"name\":\"simulation\"}}";
+
+    for( std::size_t i = 0; i < m_slices.size(); ++i ) {
+        const slice& s = m_slices[i];
+        if( s.process != no_entry ) {
+            const process_entry& e = m_processes[s.process];
+            os << ",\n{\"name\":";
+            write_json_string( os, e.name );
+            os << ",\"cat\":\"" << e.kind << "\"";
+        } else {
+            os << ",\n{\"name\":\"kernel\",\"cat\":\"kernel\"";
+        }
+        os << ",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":"
+           << fixed( s.begin, 1000 ) << ",\"dur\":"
+           << fixed( s.end - s.begin, 1000 ) << ",\"args\":{\"time\":\""
+           << sc_time::from_value( s.sim_time ) << "\"}}";
+    }
+
+    for( std::size_t i = 0; i < m_delta_samples.size(); ++i ) {
+        const delta_sample& s = m_delta_samples[i];
+        os << ",\n{\"name\":\"delta cycles\",\"ph\":\"C\",\"pid\":1,\"ts\":"
+           << fixed( s.wall_time, 1000 ) << ",\"args\":{\"deltas\":" << s.deltas << "}}";
+    }
+    os << "\n]}\n";
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
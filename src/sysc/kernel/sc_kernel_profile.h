@@ -0,0 +1,188 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_kernel_profile.h -- Run time of processes and activity of events.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_KERNEL_PROFILE_H_INCLUDED_
+#define SC_KERNEL_PROFILE_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::vector
+#endif
+
+namespace sc_core {
+
+class sc_event;
+class sc_process_b;
+class sc_simcontext;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_kernel_profile
+//
+//  Measures where the simulation spends its time. The simulation context
+//  reports each switch of the current process, the wall-clock time until
+//  the next switch is accounted to the process, or to the kernel if there
+//  is no current process. In addition the activations of the processes,
+//  the triggers of the events and the delta cycles of each time step are
+//  counted. The time slices are also recorded for a trace in the Chrome
+//  trace event format, up to a limit.
+//
+//  Methods evaluated in parallel (see sc_set_parallel_evaluate) are
+//  counted, their run time is accounted to the kernel.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_kernel_profile
+{
+public:
+
+    sc_kernel_profile( sc_simcontext* simc, const std::string& trace_file );
+
+    // the simulation starts
+    void start();
+
+    // the current process changes, 0 for the kernel
+    void switch_to( const sc_process_b* process_p );
+
+    // the current process has been taken from the runnable queue
+    void activated()
+        { if( m_current != no_entry ) ++m_processes[m_current].activations; }
+
+    // an event has been triggered
+    void triggered( const sc_event* event_p );
+
+    // a time step is completed, after the given number of delta cycles
+    void timestep( sc_dt::uint64 deltas );
+
+    // the objects are destroyed, their entries are kept
+    void process_destroyed( const sc_process_b* process_p );
+    void event_destroyed( const sc_event* event_p );
+
+    // file of the trace written at the end of the simulation, if any
+    const std::string& trace_file() const
+        { return m_trace_file; }
+
+    // write the report of the processes, events and delta cycles
+    void print( std::ostream& os );
+
+    // write the time slices in the Chrome trace event format
+    void write_trace( std::ostream& os );
+
+private:
+
+    static const std::size_t no_entry = ~std::size_t( 0 );
+
+    struct process_entry
+    {
+        std::string   name;
+        const char*   kind;
+        sc_dt::uint64 activations;
+        sc_dt::uint64 time;        // in nanoseconds
+    };
+
+    struct event_entry
+    {
+        std::string   name;
+        sc_dt::uint64 triggers;
+    };
+
+    struct slice
+    {
+        std::size_t   process;     // entry, or no_entry for the kernel
+        sc_dt::uint64 begin;       // wall-clock time in nanoseconds
+        sc_dt::uint64 end;
+        sc_dt::uint64 sim_time;    // value of the simulation time
+    };
+
+    struct delta_sample
+    {
+        sc_dt::uint64 wall_time;   // end of the time step in nanoseconds
+        sc_dt::uint64 deltas;
+    };
+
+    // wall-clock time in nanoseconds since the start of the profile
+    sc_dt::uint64 now() const;
+
+    // end the current slice
+    void update();
+
+    sc_simcontext*                                     m_simc;
+    std::string                                        m_trace_file;
+    sc_dt::uint64                                      m_start;
+
+    std::vector<process_entry>                         m_processes;
+    std::unordered_map<const sc_process_b*, std::size_t> m_process_index;
+    std::vector<event_entry>                           m_events;
+    std::unordered_map<const sc_event*, std::size_t>   m_event_index;
+    std::size_t                                        m_unnamed_events;
+
+    bool                                               m_started;
+    std::size_t                                        m_current;
+    sc_dt::uint64                                      m_slice_begin;
+    sc_dt::uint64                                      m_kernel_time;
+
+    std::vector<slice>                                 m_slices;
+    bool                                               m_truncated;
+
+    sc_dt::uint64                                      m_timesteps;
+    sc_dt::uint64                                      m_deltas;
+    sc_dt::uint64                                      m_max_deltas;
+    sc_dt::uint64                                      m_max_deltas_time;
+    std::vector<sc_dt::uint64>                         m_delta_histogram;
+    std::vector<delta_sample>                          m_delta_samples;
+
+private:
+
+    // disabled
+    sc_kernel_profile( const sc_kernel_profile& );
+    sc_kernel_profile& operator = ( const sc_kernel_profile& );
+};
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_KERNEL_PROFILE_H_INCLUDED_
+// Taf!
@@ -166,7 +166,7 @@ class sc_method_process : public sc_process_b {
     virtual void throw_user( const sc_throw_it_helper& helper,
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
     bool trigger_dynamic( sc_event* );
-    inline void trigger_static();
+    inline bool trigger_static();
 
   protected:
     sc_cor*                          m_cor;        // Thread's coroutine.
@@ -323,9 +323,9 @@ inline bool sc_method_process::run_process()
 //------------------------------------------------------------------------------
 //"sc_method_process::trigger_static"
 //
-// This inline method adds the current method to the queue of runnable
-// processes, if required.  This is the case if the following criteria
-// are met:
+// This inline method determines whether the current method has to be added
+// to the queue of runnable processes.  This is the case if the following
+// criteria are met:
 //   (1) The process is in a runnable state.
 //   (2) The process is not already on the run queue.
 //   (3) The process is expecting a static trigger, 
@@ -338,35 +338,37 @@ inline bool sc_method_process::run_process()
 //   (2) If the triggering process is the same process, the trigger is
 //       ignored as well, unless SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS
 //       is defined.
+//   (3) The caller pushes the method onto the runnable queue, so that all
+//       methods triggered by an event can be queued at once.
+//
+// Result is true if the method has to be pushed onto the runnable queue.
 //------------------------------------------------------------------------------
 inline
-void
+bool
 sc_method_process::trigger_static()
 {
     if ( (m_state & ps_bit_disabled) || is_runnable() ||
           m_trigger_type != STATIC )
-        return;
+        return false;
 
 #if ! defined( SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS )
     if( SC_UNLIKELY_( sc_get_current_process_b() == this ) )
     {
         report_immediate_self_notification();
-        return;
+        return false;
     }
 #endif // SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS
 
     // If we get here then the method is has satisfied its wait, if its 
     // suspended mark its state as ready to run. If its not suspended then 
-    // push it onto the runnable queue.
+    // it has to be pushed onto the runnable queue.
 
     if ( m_state & ps_bit_suspended )
     {
         m_state = m_state | ps_bit_ready_to_run;
+        return false;
     }
-    else
-    {
-        simcontext()->push_runnable_method(this);
-    }
+    return true;
 }
 
 #undef DEBUG_MSG
@@ -296,6 +296,20 @@ sc_module::declare_thread_process( sc_entry_func func, const char* name )
     sensitive_neg << handle;
 }
 
+// the coroutine thread is executed by a method process, host_p is owned
+// by the process (see sc_coro_thread.h)
+
+void
+sc_module::declare_coro_thread_process( sc_process_host* host_p,
+                                        sc_entry_func func, const char* name )
+{
+    sc_process_handle handle =
+      simcontext()->create_method_process( name, true, func, host_p, 0 );
+    sensitive << handle;
+    sensitive_pos << handle;
+    sensitive_neg << handle;
+}
+
 sc_process_handle
 sc_module::declare_cthread_process( sc_entry_func func, const char* name )
 {
@@ -431,6 +445,22 @@ sc_module::set_stack_size( std::size_t size )
     }
 }
 
+void
+sc_module::set_parallel_safe()
+{
+    sc_process_handle proc_h( sc_get_last_created_process_handle() );
+    sc_method_handle  method_h = (sc_method_handle)proc_h;
+
+    if ( method_h )
+    {
+	method_h->set_parallel_safe( true );
+    }
+    else
+    {
+	SC_REPORT_WARNING( SC_ID_SET_PARALLEL_SAFE_, 0 );
+    }
+}
+
 
 int
 sc_module::append_port( sc_port_base* port_ )
@@ -160,6 +160,8 @@ protected:
     template<typename EdgeType>
     void declare_cthread_process( sc_entry_func func,const char* name, EdgeType& edge )
       { sensitive( declare_cthread_process(func, name), edge ); }
+    void declare_coro_thread_process( sc_process_host* host_p,
+                                      sc_entry_func func, const char* name );
 
     // to prevent initialization for SC_METHODs and SC_THREADs
     void dont_initialize();
@@ -305,6 +307,10 @@ protected:
     // Function to set the stack size of the current (c)thread process.
     void set_stack_size( std::size_t );
 
+    // Function to allow the last created method process to be evaluated
+    // concurrently with other such methods (see sc_set_parallel_evaluate).
+    void set_parallel_safe();
+
     int append_port( sc_port_base* );
 
 private:
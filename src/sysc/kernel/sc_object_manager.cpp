@@ -33,6 +33,7 @@
 #include <cctype>
 #include <cstddef>
 #include <cctype>
+#include <cstring>
 #include <algorithm> // pick up std::sort.
 
 #include "sysc/kernel/sc_object.h"
@@ -49,6 +50,24 @@
 
 namespace sc_core {
 
+namespace {
+
+// FNV-1a hash of a hierarchical name
+inline std::size_t
+name_hash( const char* name, std::size_t length )
+{
+    sc_dt::uint64 hash = 14695981039346656037ULL;
+    for ( std::size_t i = 0; i < length; ++i ) {
+        hash ^= static_cast<unsigned char>( name[i] );
+        hash *= 1099511628211ULL;
+    }
+    return static_cast<std::size_t>( hash ^ ( hash >> 32 ) );
+}
+
+const std::size_t min_slot_count = 64;
+
+} // anonymous namespace
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_object_manager
 //
@@ -56,11 +75,11 @@ namespace sc_core {
 // ----------------------------------------------------------------------------
 
 sc_object_manager::sc_object_manager() :
-    m_event_it(),
-    m_event_walk_ok(0),
     m_instance_table(),
+    m_instance_slots(),
+    m_instance_removed(0),
     m_module_name_stack(0),
-    m_object_it(),
+    m_object_it(0),
     m_object_stack(),
     m_object_walk_ok()
 {
@@ -79,10 +98,13 @@ sc_object_manager::~sc_object_manager()
 
     for ( it = m_instance_table.begin(); it != m_instance_table.end(); it++) 
     {
-        if(it->second.m_name_origin == SC_NAME_OBJECT) {
-            sc_object* obj_p = static_cast<sc_object*>(it->second.m_element_p);
+        if(it->m_name_origin == SC_NAME_OBJECT) {
+            sc_object* obj_p = static_cast<sc_object*>(it->m_element_p);
             obj_p->m_simc = 0;
         }
+        else if(it->m_name_origin == SC_NAME_EXTERNAL) {
+            delete [] it->m_name;
+        }
     }
 }
 
@@ -99,54 +121,40 @@ sc_object_manager::~sc_object_manager()
 // +----------------------------------------------------------------------------
 std::string sc_object_manager::create_name(const char* leaf_name) 
 { 
-    bool        clash;                  // true if path name exists in obj table
-    std::string leafname_string;        // string containing the leaf name.
-    std::string parentname_string;      // parent path name 
+    std::size_t parent_length;          // length of the parent path name.
     sc_object*  parent_p;               // parent for this instance or NULL.
-    std::string result_orig_string;     // save for warning message.
     std::string result_string;          // name to return.
  
     // CONSTRUCT PATHNAME TO THE NAME TO BE RETURNED:
-    // 
-    // If there is not a leaf name generate one. 
+    //
+    // The name is built in place, the strings for the warning message are
+    // only created if there is a clash.
 
     parent_p = sc_get_curr_simcontext()->active_object();
-    parentname_string = parent_p ? parent_p->name() : ""; 
-    leafname_string = leaf_name; 
+    parent_length = parent_p ? parent_p->m_name.size() + 1 : 0;
+    result_string.reserve( parent_length + std::strlen(leaf_name) );
     if (parent_p) {
-        result_string = parentname_string;
+        result_string += parent_p->m_name;
 	result_string += SC_HIERARCHY_CHAR;
-	result_string += leafname_string;
-    } else { 
-        result_string = leafname_string;
-    } 
-
-    // SAVE the original path name 
-
-    result_orig_string = result_string;
+    }
+    result_string += leaf_name;
 
     // MAKE SURE THE ENTITY NAME IS UNIQUE:
     // 
     // If not use unique name generator to make it unique. 
 
-    clash = false; 
-    for (;;)
+    if ( name_exists(result_string) )
     {
-	    if ( !name_exists(result_string) )
-	    {
-	        break;
-	    }
-        clash = true; 
-        leafname_string = sc_gen_unique_name(leafname_string.c_str(), false); 
-	if (parent_p) {
-	    result_string = parentname_string;
-	    result_string += SC_HIERARCHY_CHAR;
-	    result_string += leafname_string;
-	} else { 
-	    result_string = leafname_string;
-	} 
-    } 
-    if (clash) { 
+        std::string leafname_string = leaf_name; // current leaf name.
+        std::string result_orig_string = result_string; // for the message.
+        do
+        {
+            leafname_string =
+              sc_gen_unique_name(leafname_string.c_str(), false); 
+            result_string.resize( parent_length );
+            result_string += leafname_string;
+        } while ( name_exists(result_string) );
+
 	std::string message = result_orig_string;
 	message += ". Latter declaration will be renamed to ";
 	message += result_string;
@@ -169,9 +177,7 @@ std::string sc_object_manager::create_name(const char* leaf_name)
 bool
 sc_object_manager::name_exists(const std::string& name)
 {
-    instance_table_t::const_iterator it = m_instance_table.find(name);
-    return (it != m_instance_table.end()) &&
-           (it->second.m_name_origin != SC_NAME_NONE);
+    return find_entry(name.c_str(), name.size()) != NULL;
 }
 
 // +----------------------------------------------------------------------------
@@ -187,13 +193,8 @@ sc_object_manager::name_exists(const std::string& name)
 const char*
 sc_object_manager::get_name(const std::string& name)
 {
-    instance_table_t::iterator it = m_instance_table.find(name);
-    if (it != m_instance_table.end() &&
-        it->second.m_name_origin != SC_NAME_NONE) {
-        return it->first.c_str();
-    } else {
-        return NULL;
-    }
+    table_entry* entry_p = find_entry(name.c_str(), name.size());
+    return entry_p ? entry_p->m_name : NULL;
 }
 
 // +----------------------------------------------------------------------------
@@ -209,12 +210,10 @@ sc_object_manager::get_name(const std::string& name)
 sc_event*
 sc_object_manager::find_event(const char* name)
 {
-    instance_table_t::iterator it;
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EVENT)
+    table_entry* entry_p = find_entry(name, std::strlen(name));
+    if(entry_p && entry_p->m_name_origin == SC_NAME_EVENT)
     {
-        return static_cast<sc_event*>(it->second.m_element_p);
+        return static_cast<sc_event*>(entry_p->m_element_p);
     } else {
         return NULL;
     }
@@ -233,12 +232,10 @@ sc_object_manager::find_event(const char* name)
 sc_object*
 sc_object_manager::find_object(const char* name)
 {
-    instance_table_t::iterator it;
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_OBJECT)
+    table_entry* entry_p = find_entry(name, std::strlen(name));
+    if(entry_p && entry_p->m_name_origin == SC_NAME_OBJECT)
     {
-        return static_cast<sc_object*>(it->second.m_element_p);
+        return static_cast<sc_object*>(entry_p->m_element_p);
     } else {
         return NULL;
     }
@@ -250,24 +247,15 @@ sc_object_manager::find_object(const char* name)
 // | 
 // | This method initializes the object iterator to point to the first object
 // | in the instance table, and returns its address. If there are no objects
-// | in the table a NULL value is returned.
+// | in the table a NULL value is returned. The objects are visited in the
+// | order of their creation.
 // +----------------------------------------------------------------------------
 sc_object*
 sc_object_manager::first_object()
 {
-    sc_object* result_p; // result to return.
-
     m_object_walk_ok = true;
-    result_p = NULL;
-    for ( m_object_it = m_instance_table.begin(); 
-          m_object_it != m_instance_table.end(); 
-	  m_object_it++ )
-    {
-        if(m_object_it->second.m_name_origin == SC_NAME_OBJECT) {
-            return static_cast<sc_object*>(m_object_it->second.m_element_p);
-        }
-    }
-    return result_p;
+    m_object_it = 0;
+    return next_object();
 }
 
 // +----------------------------------------------------------------------------
@@ -337,12 +325,15 @@ sc_object_manager::hierarchy_size()
 bool
 sc_object_manager::insert_external_name(const std::string& name)
 {
-    if(!name_exists(name)) {
-        m_instance_table[name].m_element_p = NULL;
-        m_instance_table[name].m_name_origin = SC_NAME_EXTERNAL;
+    table_entry* entry_p = find_entry(name.c_str(), name.size());
+    if(!entry_p) {
+        // the table keeps its own copy of external names
+        char* name_p = new char[name.size() + 1];
+        std::memcpy(name_p, name.c_str(), name.size() + 1);
+        insert_entry(name_p, name.size(), NULL, SC_NAME_EXTERNAL);
         return true;
     } else {
-        table_entry element = m_instance_table[name];
+        table_entry element = *entry_p;
         std::stringstream msg;
         msg << name << " ("
             << ((element.m_name_origin == SC_NAME_OBJECT)
@@ -368,8 +359,8 @@ sc_object_manager::insert_external_name(const std::string& name)
 void
 sc_object_manager::insert_event(const std::string& name, sc_event* event_p)
 {
-    m_instance_table[name].m_element_p = static_cast<void*>(event_p);
-    m_instance_table[name].m_name_origin = SC_NAME_EVENT;
+    insert_entry(name.c_str(), name.size(), static_cast<void*>(event_p),
+                 SC_NAME_EVENT);
 }
 
 // +----------------------------------------------------------------------------
@@ -385,33 +376,29 @@ sc_object_manager::insert_event(const std::string& name, sc_event* event_p)
 void
 sc_object_manager::insert_object(const std::string& name, sc_object* object_p)
 {
-    m_instance_table[name].m_element_p = static_cast<void*>(object_p);
-    m_instance_table[name].m_name_origin = SC_NAME_OBJECT;
+    insert_entry(name.c_str(), name.size(), static_cast<void*>(object_p),
+                 SC_NAME_OBJECT);
 }
 
 // +----------------------------------------------------------------------------
 // |"sc_object_manager::next_object"
 // | 
-// | This method returns the next object pointed to by the instance iterator.
+// | This method returns the next object pointed to by the instance iterator,
+// | which holds the index of the first entry not visited yet.
 // +----------------------------------------------------------------------------
 sc_object*
 sc_object_manager::next_object()
 {
-    sc_object* result_p; // result to return.
-
     sc_assert( m_object_walk_ok );
 
-    if ( m_object_it == m_instance_table.end() ) return NULL;
-    m_object_it++;
-
-    for ( result_p = NULL; m_object_it != m_instance_table.end(); 
-	  m_object_it++ )
+    while ( m_object_it < m_instance_table.size() )
     {
-        if(m_object_it->second.m_name_origin == SC_NAME_OBJECT) {
-            return static_cast<sc_object*>(m_object_it->second.m_element_p);
+        table_entry& entry = m_instance_table[m_object_it++];
+        if(entry.m_name_origin == SC_NAME_OBJECT) {
+            return static_cast<sc_object*>(entry.m_element_p);
         }
     }
-    return result_p;
+    return NULL;
 }
 
 // +----------------------------------------------------------------------------
@@ -479,13 +466,10 @@ sc_object_manager::top_of_module_name_stack_name() const
 void
 sc_object_manager::remove_event(const std::string& name)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EVENT)
+    table_entry* entry_p = find_entry(name.c_str(), name.size());
+    if(entry_p && entry_p->m_name_origin == SC_NAME_EVENT)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        remove_entry(entry_p);
     }
 }
 
@@ -501,13 +485,10 @@ sc_object_manager::remove_event(const std::string& name)
 void
 sc_object_manager::remove_object(const std::string& name)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_OBJECT)
+    table_entry* entry_p = find_entry(name.c_str(), name.size());
+    if(entry_p && entry_p->m_name_origin == SC_NAME_OBJECT)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        remove_entry(entry_p);
     }
 }
 
@@ -523,19 +504,177 @@ sc_object_manager::remove_object(const std::string& name)
 bool
 sc_object_manager::remove_external_name(const std::string& name)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EXTERNAL)
+    table_entry* entry_p = find_entry(name.c_str(), name.size());
+    if(entry_p && entry_p->m_name_origin == SC_NAME_EXTERNAL)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        const char* name_p = entry_p->m_name;
+        remove_entry(entry_p);
+        delete [] name_p;
         return true;
     } else {
         return false;
     }
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::find_entry"
+// |
+// | This method returns the entry of the instance table with the supplied
+// | name, or NULL if the name is not in the table.
+// |
+// | Arguments:
+// |     name   -> hierarchical name, need not be terminated.
+// |     length =  length of the name.
+// +----------------------------------------------------------------------------
+sc_object_manager::table_entry*
+sc_object_manager::find_entry(const char* name, std::size_t length)
+{
+    if ( m_instance_slots.empty() )
+        return NULL;
+
+    std::size_t hash = name_hash(name, length);
+    std::size_t mask = m_instance_slots.size() - 1;
+    for ( std::size_t slot = hash & mask; m_instance_slots[slot];
+          slot = (slot + 1) & mask )
+    {
+        table_entry& entry = m_instance_table[m_instance_slots[slot] - 1];
+        if ( entry.m_hash == hash && entry.m_length == length &&
+             std::memcmp(entry.m_name, name, length) == 0 )
+            return &entry;
+    }
+    return NULL;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::insert_entry"
+// |
+// | This method appends an entry to the instance table, or replaces the
+// | element of the entry with the same name. The name is not copied, it must
+// | stay valid until the entry is removed.
+// |
+// | Arguments:
+// |     name      -> hierarchical name.
+// |     length    =  length of the name.
+// |     element_p -> element to be inserted.
+// |     origin    =  kind of the element.
+// +----------------------------------------------------------------------------
+void
+sc_object_manager::insert_entry(const char* name, std::size_t length,
+                                void* element_p, sc_name_origin origin)
+{
+    table_entry* entry_p = find_entry(name, length);
+    if ( entry_p ) {
+        entry_p->m_name = name;
+        entry_p->m_element_p = element_p;
+        entry_p->m_name_origin = origin;
+        return;
+    }
+
+    // keep the hash table at most half full, and the removed entries
+    // at most half of the instance table
+
+    std::size_t live = m_instance_table.size() - m_instance_removed;
+    if ( 2 * (live + 1) > m_instance_slots.size() ) {
+        rehash( std::max( min_slot_count, 2 * m_instance_slots.size() ) );
+    } else if ( m_instance_removed > live ) {
+        rehash( m_instance_slots.size() );
+    }
+
+    table_entry entry;
+    entry.m_name = name;
+    entry.m_length = length;
+    entry.m_hash = name_hash(name, length);
+    entry.m_element_p = element_p;
+    entry.m_name_origin = origin;
+    m_instance_table.push_back(entry);
+
+    std::size_t mask = m_instance_slots.size() - 1;
+    std::size_t slot = entry.m_hash & mask;
+    while ( m_instance_slots[slot] )
+        slot = (slot + 1) & mask;
+    m_instance_slots[slot] = static_cast<unsigned>( m_instance_table.size() );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::remove_entry"
+// |
+// | This method removes the supplied entry from the hash table. The entry
+// | stays in the instance table, so that an object walk is not disturbed,
+// | until the table is compacted by rehash().
+// |
+// | Arguments:
+// |     entry_p -> entry to be removed.
+// +----------------------------------------------------------------------------
+void
+sc_object_manager::remove_entry(table_entry* entry_p)
+{
+    unsigned    index = static_cast<unsigned>( entry_p - &m_instance_table[0] );
+    std::size_t mask = m_instance_slots.size() - 1;
+    std::size_t slot = entry_p->m_hash & mask;
+    while ( m_instance_slots[slot] != index + 1 )
+        slot = (slot + 1) & mask;
+
+    // close the gap, so that no probe sequence is interrupted
+
+    for ( std::size_t next = (slot + 1) & mask; m_instance_slots[next];
+          next = (next + 1) & mask )
+    {
+        std::size_t home =
+          m_instance_table[m_instance_slots[next] - 1].m_hash & mask;
+        if ( ((next - home) & mask) >= ((next - slot) & mask) ) {
+            m_instance_slots[slot] = m_instance_slots[next];
+            slot = next;
+        }
+    }
+    m_instance_slots[slot] = 0;
+
+    entry_p->m_name = NULL;
+    entry_p->m_element_p = NULL;
+    entry_p->m_name_origin = SC_NAME_NONE;
+    m_instance_removed++;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::rehash"
+// |
+// | This method drops the removed entries from the instance table, and
+// | rebuilds the hash table with the supplied number of slots. An object
+// | walk in progress continues with the first entry it has not visited.
+// |
+// | Arguments:
+// |     slot_count = number of slots, a power of two.
+// +----------------------------------------------------------------------------
+void
+sc_object_manager::rehash(std::size_t slot_count)
+{
+    if ( m_instance_removed ) {
+        std::size_t live = 0;
+        std::size_t object_it = m_object_it;
+        for ( std::size_t i = 0; i < m_instance_table.size(); ++i )
+        {
+            if ( i == m_object_it )
+                object_it = live;
+            if ( m_instance_table[i].m_name_origin != SC_NAME_NONE )
+                m_instance_table[live++] = m_instance_table[i];
+        }
+        if ( m_object_it >= m_instance_table.size() )
+            object_it = live;
+        m_object_it = object_it;
+        m_instance_table.resize(live);
+        m_instance_removed = 0;
+    }
+
+    m_instance_slots.assign(slot_count, 0);
+    std::size_t mask = slot_count - 1;
+    for ( std::size_t i = 0; i < m_instance_table.size(); ++i )
+    {
+        std::size_t slot = m_instance_table[i].m_hash & mask;
+        while ( m_instance_slots[slot] )
+            slot = (slot + 1) & mask;
+        m_instance_slots[slot] = static_cast<unsigned>( i + 1 );
+    }
+}
+
 } // namespace sc_core
 
 // $Log: sc_object_manager.cpp,v $
@@ -30,7 +30,8 @@
 #ifndef SC_OBJECT_MANAGER_H
 #define SC_OBJECT_MANAGER_H
 
-#include <map>
+#include <cstddef>
+#include <string>
 #include <vector>
 
 namespace sc_core {
@@ -44,6 +45,11 @@ class sc_module_name;
 //  CLASS : sc_object_manager
 //
 //  Manager of objects.
+//
+//  The instance table holds the hierarchical names in order of insertion.
+//  It is indexed by an open addressing hash table with linear probing. The
+//  names of objects and events are not copied, the entries point to the
+//  names held by the elements themselves.
 // ----------------------------------------------------------------------------
 
 class sc_object_manager
@@ -63,14 +69,20 @@ protected:
 
     struct table_entry
     {
-        table_entry() : m_element_p(NULL), m_name_origin(SC_NAME_NONE) {}
-
-	    void*          m_element_p; // can be an sc_object or an sc_event
+        table_entry()
+          : m_name(NULL), m_length(0), m_hash(0)
+          , m_element_p(NULL), m_name_origin(SC_NAME_NONE)
+        {}
+
+        const char*    m_name;      // hierarchical name, NULL if removed
+        std::size_t    m_length;    // length of the name
+        std::size_t    m_hash;      // hash value of the name
+        void*          m_element_p; // can be an sc_object or an sc_event
         sc_name_origin m_name_origin;
     };
 
 public:
-    typedef std::map<std::string,table_entry> instance_table_t;
+    typedef std::vector<table_entry>          instance_table_t;
     typedef std::vector<sc_object_host*>      object_vector_t;
 
     sc_object_manager();
@@ -104,13 +116,19 @@ private:
     void remove_object(const std::string& name);
     bool remove_external_name(const std::string& name);
 
+    table_entry* find_entry( const char* name, std::size_t length );
+    void insert_entry( const char* name, std::size_t length,
+                       void* element_p, sc_name_origin origin );
+    void remove_entry( table_entry* entry_p );
+    void rehash( std::size_t slot_count );
+
 private:
 
-    instance_table_t::iterator m_event_it;          // event instance iterator.
-    bool                       m_event_walk_ok;     // true if can walk events.
     instance_table_t           m_instance_table;    // table of instances.
+    std::vector<unsigned>      m_instance_slots;    // hash index (entry + 1).
+    std::size_t                m_instance_removed;  // # of removed entries.
     sc_module_name*            m_module_name_stack; // sc_module_name stack.
-    instance_table_t::iterator m_object_it;         // object instance iterator.
+    std::size_t                m_object_it;         // object instance iterator.
     object_vector_t            m_object_stack;      // sc_object stack.
     bool                       m_object_walk_ok;    // true if can walk objects.
 };
@@ -0,0 +1,353 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_parallel_evaluator.cpp -- Evaluation of independent method processes
+                               on a pool of host threads.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_parallel_evaluator.h"
+#include "sysc/kernel/sc_except.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/communication/sc_prim_channel.h"
+
+namespace sc_core {
+
+// set while the host thread evaluates the methods of a batch
+static thread_local sc_parallel_evaluator* sc_parallel_evaluator_p = 0;
+static thread_local unsigned               sc_parallel_thread_id = 0;
+
+namespace {
+
+// ends a method, which issued a report with the SC_THROW action
+struct sc_parallel_report_thrown {};
+
+} // namespace
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::sc_parallel_evaluator"
+// |
+// | This is the object instance constructor for this class. It starts the
+// | helper host threads, which wait for the first batch.
+// |
+// | Arguments:
+// |     simc      = simulation context the methods belong to.
+// |     n_threads = number of host threads, including the simulator thread.
+// +----------------------------------------------------------------------------
+sc_parallel_evaluator::sc_parallel_evaluator( sc_simcontext& simc,
+                                              unsigned n_threads )
+  : m_simc( &simc )
+  , m_batch()
+  , m_workers()
+  , m_reports( n_threads ? n_threads : 1 )
+  , m_mutex()
+  , m_start_cond()
+  , m_done_cond()
+  , m_generation(0)
+  , m_busy(0)
+  , m_shutdown(false)
+  , m_exception()
+  , m_next(0)
+  , m_chunk(1)
+{
+    for ( unsigned id = 1; id < n_threads; ++id )
+        m_workers.push_back( std::thread( &sc_parallel_evaluator::worker,
+                                          this, id ) );
+}
+
+sc_parallel_evaluator::~sc_parallel_evaluator()
+{
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_shutdown = true;
+    }
+    m_start_cond.notify_all();
+    for ( std::size_t i = 0; i < m_workers.size(); ++i )
+        m_workers[i].join();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::execute"
+// |
+// | This method evaluates the collected methods on all threads of the pool
+// | and returns once every method of the batch has completed.
+// |
+// | While the batch is executing, update requests and event notifications
+// | are routed through their mutex-protected paths. There is no current
+// | process, so writer checks of signals are suspended for the batch.
+// |
+// | The reports issued by the methods are passed to the report handler
+// | once the batch has completed.
+// |
+// | Result is false if a method threw an exception, or the report handler
+// | did, in which case the error has been propagated to the simulation
+// | context.
+// +----------------------------------------------------------------------------
+bool
+sc_parallel_evaluator::execute()
+{
+    if ( m_batch.empty() )
+        return true;
+
+    sc_prim_channel_registry* registry_p = m_simc->get_prim_channel_registry();
+
+    registry_p->m_concurrent_updates = true;
+    m_simc->m_concurrent_notify = true;
+
+    // Hand out the batch in chunks, small enough to balance the load of
+    // methods with different run times.
+
+    std::size_t n_threads = m_workers.size() + 1;
+    m_chunk = m_batch.size() / ( 4 * n_threads );
+    if ( m_chunk == 0 )
+        m_chunk = 1;
+    m_next.store( 0, std::memory_order_relaxed );
+
+    if ( m_workers.empty() || m_batch.size() == 1 )
+    {
+        run_batch( 0 );
+    }
+    else
+    {
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_busy = static_cast<unsigned>( m_workers.size() );
+            ++m_generation;
+        }
+        m_start_cond.notify_all();
+
+        run_batch( 0 );
+
+        std::unique_lock<std::mutex> lock( m_mutex );
+        while ( m_busy != 0 )
+            m_done_cond.wait( lock );
+    }
+
+    m_simc->m_concurrent_notify = false;
+    registry_p->m_concurrent_updates = false;
+    m_batch.clear();
+
+    if ( !deliver_reports() )
+    {
+        m_exception = std::exception_ptr();
+        return false;
+    }
+
+    if ( m_exception )
+    {
+        std::exception_ptr ex = m_exception;
+        m_exception = std::exception_ptr();
+        try {
+            std::rethrow_exception( ex );
+        }
+        catch( ... ) {
+            m_simc->set_error( sc_handle_exception() );
+        }
+        return false;
+    }
+    return true;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::run_batch"
+// |
+// | This method claims chunks of the current batch until it is exhausted.
+// | It is executed by every thread of the pool.
+// |
+// | Arguments:
+// |     id = index of the thread in the pool, 0 for the simulator thread.
+// +----------------------------------------------------------------------------
+void
+sc_parallel_evaluator::run_batch( unsigned id )
+{
+    const std::size_t size = m_batch.size();
+    sc_parallel_evaluator_p = this;
+    sc_parallel_thread_id = id;
+    for ( ;; )
+    {
+        std::size_t first = m_next.fetch_add( m_chunk );
+        if ( first >= size )
+            break;
+        std::size_t last = first + m_chunk;
+        if ( last > size )
+            last = size;
+        for ( std::size_t i = first; i < last; ++i )
+            run_method( m_batch[i] );
+    }
+    sc_parallel_evaluator_p = 0;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::evaluating"
+// |
+// | This method returns true if the calling host thread is evaluating the
+// | methods of a batch, the simulator thread included.
+// +----------------------------------------------------------------------------
+bool
+sc_parallel_evaluator::evaluating()
+{
+    return sc_parallel_evaluator_p != 0;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::report_mutex"
+// |
+// | This method returns the mutex, which sc_report_handler holds while it
+// | looks up the actions of a report issued during a batch.
+// +----------------------------------------------------------------------------
+std::mutex&
+sc_parallel_evaluator::report_mutex()
+{
+    static std::mutex mtx;
+    return mtx;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::defer_report"
+// |
+// | This method is called by sc_report_handler for a report issued by a
+// | method of a batch, which has not been suppressed. The report handler
+// | and its actions are not thread-safe, so the report is queued for the
+// | calling thread and is passed to the handler by the simulator thread in
+// | execute(). If the actions include SC_THROW, the method is ended here.
+// |
+// | Arguments:
+// |     rep     = report to be passed to the handler.
+// |     actions = actions of the report.
+// +----------------------------------------------------------------------------
+void
+sc_parallel_evaluator::defer_report( const sc_report& rep,
+                                     sc_actions actions )
+{
+    sc_assert( sc_parallel_evaluator_p );
+    sc_parallel_evaluator_p->m_reports[sc_parallel_thread_id].push_back(
+        deferred_report( rep, actions ) );
+    if ( actions & SC_THROW )
+        throw sc_parallel_report_thrown();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::deliver_reports"
+// |
+// | This method passes the reports deferred during the batch to the report
+// | handler, the reports of each thread in the order they were issued.
+// |
+// | Result is false if the handler threw an exception, which has been
+// | propagated to the simulation context. The remaining reports are dropped.
+// +----------------------------------------------------------------------------
+bool
+sc_parallel_evaluator::deliver_reports()
+{
+    bool ok = true;
+    for ( std::size_t t = 0; t < m_reports.size(); ++t )
+    {
+        report_queue& queue = m_reports[t];
+        for ( std::size_t i = 0; ok && i < queue.size(); ++i )
+        {
+            try {
+                if ( queue[i].actions & SC_CACHE_REPORT )
+                    sc_report_handler::cache_report( queue[i].report );
+                sc_report_handler::handler( queue[i].report,
+                                            queue[i].actions );
+            }
+            catch( ... ) {
+                m_simc->set_error( sc_handle_exception() );
+                ok = false;
+            }
+        }
+        queue.clear();
+    }
+    return ok;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::run_method"
+// |
+// | This method executes a single method of the batch. The self-link set up
+// | in defer() is cleared first, so that the method can be triggered again
+// | during the upcoming update and notification phases.
+// |
+// | Only the first exception of a batch is kept, it is converted to an
+// | sc_report by the simulator thread in execute().
+// +----------------------------------------------------------------------------
+void
+sc_parallel_evaluator::run_method( sc_method_handle method_h )
+{
+    sc_process_b* proc_p = method_h;
+    proc_p->m_runnable_p = 0;
+    if ( proc_p->m_state & sc_process_b::ps_bit_zombie )
+        return;
+
+    try {
+        proc_p->semantics();
+    }
+    catch( const sc_parallel_report_thrown& ) {
+        // the report is passed to the handler after the batch
+    }
+    catch( ... ) {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        if ( !m_exception )
+            m_exception = std::current_exception();
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::worker"
+// |
+// | This method is the body of the helper host threads. It waits for a new
+// | batch, takes part in its evaluation and signals its completion.
+// +----------------------------------------------------------------------------
+void
+sc_parallel_evaluator::worker( unsigned id )
+{
+    unsigned generation = 0;
+    for ( ;; )
+    {
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            while ( !m_shutdown && m_generation == generation )
+                m_start_cond.wait( lock );
+            if ( m_shutdown )
+                return;
+            generation = m_generation;
+        }
+
+        run_batch( id );
+
+        std::unique_lock<std::mutex> lock( m_mutex );
+        if ( --m_busy == 0 )
+            m_done_cond.notify_one();
+    }
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,188 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_parallel_evaluator.h -- Evaluation of independent method processes
+                             on a pool of host threads.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_PARALLEL_EVALUATOR_H_INCLUDED_
+#define SC_PARALLEL_EVALUATOR_H_INCLUDED_
+
+#include "sysc/kernel/sc_method_process.h"
+#include "sysc/utils/sc_report.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sc_core {
+
+class sc_simcontext;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_parallel_evaluator
+//
+//  Executes the method processes that have been marked as parallel-safe
+//  (see sc_module::set_parallel_safe) on a pool of host threads. The
+//  simulator thread collects these methods while draining the runnable
+//  queue during the evaluation phase and runs the batch before the update
+//  phase, which acts as the synchronization barrier.
+//
+//  Parallel-safe methods may only:
+//    - read channels,
+//    - write primitive channels (request_update), each channel from a
+//      single process only,
+//    - issue delta or timed notifications of events (notify(sc_time),
+//      cancel()), which are serialized by the simulation context.
+//  They must not use immediate notification, notify_delayed, next_trigger,
+//  process control, resets, or access the current process handle.
+//
+//  There is no current process during the batch, so the writer policy
+//  checks of signals (SC_ONE_WRITER) are not performed for these methods.
+//
+//  The report handler is not thread-safe. The reports issued during the
+//  batch are filtered (verbosity, actions) under a lock, and those that are
+//  not suppressed are passed to the handler by the simulator thread once
+//  the batch has completed. A report whose actions include SC_THROW ends
+//  the method, like the exception thrown by the handler would.
+//
+//  FOR INTERNAL USE ONLY!
+// ----------------------------------------------------------------------------
+
+class sc_parallel_evaluator
+{
+public:
+
+    // the simulator thread takes part in the evaluation, so a pool of
+    // n_threads uses n_threads-1 additional host threads.
+    sc_parallel_evaluator( sc_simcontext& simc, unsigned n_threads );
+    ~sc_parallel_evaluator();
+
+    unsigned threads() const
+        { return static_cast<unsigned>( m_workers.size() ) + 1; }
+
+    // can this method be deferred to the parallel batch?
+    inline bool accepts( sc_method_handle method_h ) const;
+
+    // add a method to the current batch
+    inline void defer( sc_method_handle method_h );
+
+    bool empty() const
+        { return m_batch.empty(); }
+
+    // execute the current batch, returns false if a process failed
+    bool execute();
+
+    // is the calling host thread evaluating a method of a batch?
+    static bool evaluating();
+
+    // serializes the filtering of the reports issued during the batch
+    static std::mutex& report_mutex();
+
+    // pass a report issued during the batch to the handler after the batch,
+    // see sc_report_handler
+    static void defer_report( const sc_report& rep, sc_actions actions );
+
+private:
+
+    struct deferred_report
+    {
+        deferred_report( const sc_report& rep, sc_actions act )
+          : report( rep ), actions( act ) {}
+
+        sc_report  report;
+        sc_actions actions;
+    };
+
+    typedef std::vector<deferred_report> report_queue;
+
+    void worker( unsigned id );
+    void run_batch( unsigned id );
+    void run_method( sc_method_handle method_h );
+    bool deliver_reports();
+
+private:
+
+    sc_simcontext*                m_simc;
+    std::vector<sc_method_handle> m_batch;       // methods to evaluate.
+    std::vector<std::thread>      m_workers;     // helper host threads.
+    std::vector<report_queue>     m_reports;     // deferred, per thread.
+
+    std::mutex                    m_mutex;       // guards the fields below.
+    std::condition_variable       m_start_cond;  // new batch available.
+    std::condition_variable       m_done_cond;   // all workers finished.
+    unsigned                      m_generation;  // batch sequence number.
+    unsigned                      m_busy;        // # of workers in batch.
+    bool                          m_shutdown;    // workers should exit.
+    std::exception_ptr            m_exception;   // first failure in batch.
+
+    std::atomic<std::size_t>      m_next;        // next batch entry to run.
+    std::size_t                   m_chunk;       // entries claimed at once.
+
+private:
+
+    // disabled
+    sc_parallel_evaluator( const sc_parallel_evaluator& );
+    sc_parallel_evaluator& operator = ( const sc_parallel_evaluator& );
+};
+
+// IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
+
+inline bool
+sc_parallel_evaluator::accepts( sc_method_handle method_h ) const
+{
+    const sc_process_b* proc_p = method_h;
+    return proc_p->m_parallel_safe
+        && proc_p->m_resets.empty()
+        && proc_p->m_throw_status == sc_process_b::THROW_NONE;
+}
+
+// The deferred method is linked to itself, so that it is still considered
+// to be runnable (and is not queued a second time) until it is executed.
+
+inline void
+sc_parallel_evaluator::defer( sc_method_handle method_h )
+{
+    sc_process_b* proc_p = method_h;
+    proc_p->m_runnable_p = proc_p;
+    m_batch.push_back( method_h );
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_PARALLEL_EVALUATOR_H_INCLUDED_
+// Taf!
@@ -38,6 +38,7 @@
 #include "sysc/kernel/sc_sensitive.h"
 #include "sysc/kernel/sc_process_handle.h"
 #include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_kernel_profile.h"
 #include <sstream>
 
 namespace sc_core {
@@ -540,6 +541,7 @@ sc_process_b::sc_process_b( const char* name_p, bool is_thread, bool free_host,
     m_event_count(0),
     m_event_list_p(0),
     m_exist_p(0),
+    m_parallel_safe( false ),
     m_free_host( free_host ),
     m_has_reset_signal( false ),
     m_has_stack(false),
@@ -585,6 +587,9 @@ sc_process_b::sc_process_b( const char* name_p, bool is_thread, bool free_host,
 //------------------------------------------------------------------------------
 sc_process_b::~sc_process_b()
 {
+    sc_kernel_profile* profile_p = simcontext()->kernel_profile();
+    if ( profile_p ) profile_p->process_destroyed( this );
+
     // DELETE SEMANTICS OBJECTS IF NEED BE:
 
     if ( m_free_host ) delete m_semantics_host_p;
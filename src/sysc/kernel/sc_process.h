@@ -212,6 +212,7 @@ class SC_API sc_process_b : public sc_object_host {
 
     friend class sc_event;
     friend class sc_object;
+    friend class sc_parallel_evaluator;
     friend class sc_port_base;
     friend class sc_runnable;
     friend class sc_sensitive;
@@ -288,8 +289,12 @@ class SC_API sc_process_b : public sc_object_host {
     bool dont_initialize() const { return m_dont_init; }
     virtual void dont_initialize( bool dont );
     std::string dump_state() const;
+    bool parallel_safe() const { return m_parallel_safe; }
+    void set_parallel_safe( bool safe ) { m_parallel_safe = safe; }
     inline sc_curr_proc_kind proc_kind() const;
     sc_event& reset_event();
+    virtual std::size_t stack_size() const { return 0; }
+    virtual std::size_t stack_usage() const { return 0; }
     sc_event& terminated_event();
 
   public:
@@ -371,6 +376,7 @@ class SC_API sc_process_b : public sc_object_host {
     int                          m_event_count;     // number of events.
     const sc_event_list*         m_event_list_p;    // event list waiting on.
     sc_process_b*                m_exist_p;         // process existence link.
+    bool                         m_parallel_safe;   // may run on a worker.
     bool                         m_free_host;       // free sc_semantic_host_p.
     bool                         m_has_reset_signal;  // has reset_signal_is.
     bool                         m_has_stack;       // true is stack present.
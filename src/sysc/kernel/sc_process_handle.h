@@ -115,6 +115,8 @@ class SC_API sc_process_handle {
     inline sc_event& reset_event() const;
     inline void resume(
         sc_descendant_inclusion_info descendants=SC_NO_DESCENDANTS );
+    inline std::size_t stack_size() const;
+    inline std::size_t stack_usage() const;
     inline void suspend(
         sc_descendant_inclusion_info descendants=SC_NO_DESCENDANTS );
     inline void sync_reset_off(
@@ -381,6 +383,22 @@ inline sc_curr_proc_kind sc_process_handle::proc_kind() const
     return m_target_p ?  m_target_p->proc_kind() : SC_NO_PROC_;
 }
 
+// return the stack size of this object instance's target, 0 if it has
+// no stack.
+
+inline std::size_t sc_process_handle::stack_size() const
+{
+    return m_target_p ? m_target_p->stack_size() : 0;
+}
+
+// return the peak stack usage of this object instance's target, 0 if it
+// is unknown (see sc_set_stack_profiling).
+
+inline std::size_t sc_process_handle::stack_usage() const
+{
+    return m_target_p ? m_target_p->stack_usage() : 0;
+}
+
 // reset this object instance's target.
 
 inline void sc_process_handle::reset( sc_descendant_inclusion_info descendants )
@@ -224,6 +224,44 @@ inline void sc_runnable::push_back_thread( sc_thread_handle thread_h )
 }
 
 
+//------------------------------------------------------------------------------
+//"sc_runnable::push_back_methods"
+//
+// This method appends a chain of method processes to the back of the queue of
+// runnable method processes. The chain is linked via the processes' runnable
+// links, the link of its last process is overwritten.
+//     first_h -> first method process of the chain.
+//     last_h  -> last method process of the chain.
+//------------------------------------------------------------------------------
+inline void sc_runnable::push_back_methods( sc_method_handle first_h,
+                                            sc_method_handle last_h )
+{
+    DEBUG_MSG(DEBUG_NAME,first_h,"pushing back methods");
+    last_h->set_next_runnable(SC_NO_METHODS);
+    m_methods_push_tail->set_next_runnable(first_h);
+    m_methods_push_tail = last_h;
+}
+
+
+//------------------------------------------------------------------------------
+//"sc_runnable::push_back_threads"
+//
+// This method appends a chain of thread processes to the back of the queue of
+// runnable thread processes. The chain is linked via the processes' runnable
+// links, the link of its last process is overwritten.
+//     first_h -> first thread process of the chain.
+//     last_h  -> last thread process of the chain.
+//------------------------------------------------------------------------------
+inline void sc_runnable::push_back_threads( sc_thread_handle first_h,
+                                            sc_thread_handle last_h )
+{
+    DEBUG_MSG(DEBUG_NAME,first_h,"pushing back threads");
+    last_h->set_next_runnable(SC_NO_THREADS);
+    m_threads_push_tail->set_next_runnable(first_h);
+    m_threads_push_tail = last_h;
+}
+
+
 //------------------------------------------------------------------------------
 //"sc_runnable::push_front_method"
 //
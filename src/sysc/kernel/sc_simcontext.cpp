@@ -40,6 +40,7 @@
 #include "sysc/kernel/sc_module_registry.h"
 #include "sysc/kernel/sc_name_gen.h"
 #include "sysc/kernel/sc_object_manager.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
 #include "sysc/kernel/sc_cthread_process.h"
 #include "sysc/kernel/sc_method_process.h"
 #include "sysc/kernel/sc_thread_process.h"
@@ -47,7 +48,11 @@
 #include "sysc/kernel/sc_reset.h"
 #include "sysc/kernel/sc_ver.h"
 #include "sysc/kernel/sc_dynamic_processes.h"
+#include "sysc/kernel/sc_kernel_profile.h"
+#include "sysc/kernel/sc_elab_profile.h"
+#include "sysc/kernel/sc_stack_profile.h"
 #include "sysc/kernel/sc_stage_callback_registry.h"
+#include "sysc/communication/sc_clock.h"
 #include "sysc/communication/sc_port.h"
 #include "sysc/communication/sc_export.h"
 #include "sysc/communication/sc_prim_channel.h"
@@ -59,7 +64,9 @@
 #include "sysc/utils/sc_utils_ids.h"
 
 #include <algorithm>
+#include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <sstream>
 
 // DEBUGGING MACROS:
@@ -209,6 +216,12 @@ sc_notify_time_compare( const void* p1, const void* p2 )
     }
 }
 
+SC_API sc_dt::uint64
+sc_notify_time_key( const void* p )
+{
+    return static_cast<const sc_event_timed*>( p )->notify_time().value();
+}
+
 
 // +============================================================================
 // | CLASS sc_invoke_method - class to invoke sc_method's to support
@@ -328,11 +341,60 @@ sc_simcontext::init()
     else
         m_write_check = SC_SIGNAL_WRITE_CHECK_DEFAULT_;
 
+    const char* parallel_evaluate = std::getenv("SC_PARALLEL_EVALUATE");
+    m_parallel_threads = 1;
+    if ( parallel_evaluate != NULL )
+    {
+        int n_threads = std::atoi( parallel_evaluate );
+        if ( n_threads > 1 )
+            m_parallel_threads = static_cast<unsigned>( n_threads );
+    }
+
+    const char* stack_profile = std::getenv("SC_STACK_PROFILE");
+    sc_string_view stack_profile_s =
+      (stack_profile != NULL) ? stack_profile : "";
+    m_stack_profile = NULL;
+    if ( !stack_profile_s.empty() && stack_profile_s != "0" )
+        m_stack_profile = new sc_stack_profile( this );
+
+    // SC_KERNEL_PROFILE=1 writes the trace to the default file, any other
+    // value is taken as the name of the file
+    const char* kernel_profile = std::getenv("SC_KERNEL_PROFILE");
+    sc_string_view kernel_profile_s =
+      (kernel_profile != NULL) ? kernel_profile : "";
+    m_kernel_profile = NULL;
+    if ( !kernel_profile_s.empty() && kernel_profile_s != "0" )
+        m_kernel_profile = new sc_kernel_profile( this,
+          kernel_profile_s == "1" ? "sc_kernel_profile.json" : kernel_profile );
+
+    const char* elab_profile = std::getenv("SC_ELAB_PROFILE");
+    sc_string_view elab_profile_s =
+      (elab_profile != NULL) ? elab_profile : "";
+    m_elab_profile = NULL;
+    if ( !elab_profile_s.empty() && elab_profile_s != "0" )
+        m_elab_profile = new sc_elab_profile( this );
+
+    const char* lazy_clocks = std::getenv("SC_LAZY_CLOCKS");
+    sc_string_view lazy_clocks_s = (lazy_clocks != NULL) ? lazy_clocks : "";
+    m_lazy_clocks = !lazy_clocks_s.empty() && lazy_clocks_s != "0";
+    m_sleeping_clocks.clear();
+
+    const char* timed_queue = std::getenv("SC_TIMED_EVENT_QUEUE");
+    sc_string_view timed_queue_s = (timed_queue != NULL) ? timed_queue : "";
+
     // FINISH INITIALIZATIONS:
 
     reset_curr_proc();
     m_next_proc_id = -1;
-    m_timed_events = new sc_ppq<sc_event_timed*>( 128, sc_notify_time_compare );
+    if ( timed_queue_s == "WHEEL" ) {
+        m_timed_events = NULL;
+        m_timed_wheel =
+          new sc_timing_wheel<sc_event_timed*>( sc_notify_time_key );
+    } else {
+        m_timed_events =
+          new sc_ppq<sc_event_timed*>( 128, sc_notify_time_compare );
+        m_timed_wheel = NULL;
+    }
     m_null_event_p = NULL;
     m_something_to_trace = false;
     m_runnable = new sc_runnable;
@@ -360,6 +422,8 @@ sc_simcontext::init()
     m_stage = (sc_stage)(0);
     m_suspend = 0;
     m_unsuspendable = 0;
+    m_parallel_evaluator = NULL;
+    m_concurrent_notify = false;
 }
 
 void
@@ -368,6 +432,7 @@ sc_simcontext::clean()
     // remove remaining zombie processes
     do_collect_processes();
 
+    delete m_parallel_evaluator;
     delete m_stub_registry;
     delete m_method_invoker_p;
     delete m_error;
@@ -377,6 +442,7 @@ sc_simcontext::clean()
     delete m_runnable;
     delete m_null_event_p;
     delete m_timed_events;
+    delete m_timed_wheel;
     delete m_process_table;
     delete m_name_gen;
     delete m_stage_cb_registry;
@@ -385,6 +451,12 @@ sc_simcontext::clean()
     delete m_port_registry;
     delete m_module_registry;
     delete m_object_manager;
+    delete m_stack_profile;
+    m_stack_profile = NULL;
+    delete m_kernel_profile;
+    m_kernel_profile = NULL;
+    delete m_elab_profile;
+    m_elab_profile = NULL;
 
     m_delta_events.clear();
     m_child_objects.clear();
@@ -405,6 +477,7 @@ sc_simcontext::sc_simcontext() :
     m_process_table(0), m_curr_proc_info(), m_current_writer(0),
     m_write_check(SC_SIGNAL_WRITE_CHECK_DEFAULT_), m_next_proc_id(-1),
     m_child_events(), m_child_objects(), m_delta_events(), m_timed_events(0),
+    m_timed_wheel(0),
     m_trace_files(), m_something_to_trace(false), m_runnable(0), m_collectable(0),
     m_time_params(), m_curr_time(SC_ZERO_TIME), m_max_time(SC_ZERO_TIME),
     m_change_stamp(0), m_delta_count(0), m_initial_delta_count_at_current_time(0),
@@ -414,7 +487,10 @@ sc_simcontext::sc_simcontext() :
     m_in_simulator_control(false), m_end_of_simulation_called(false),
     m_simulation_status(SC_ELABORATION), m_start_of_simulation_called(false),
     m_cor_pkg(0), m_cor(0), m_reset_finder_q(0),
-    m_suspend(0), m_unsuspendable(0)
+    m_suspend(0), m_unsuspendable(0),
+    m_parallel_threads(1), m_parallel_evaluator(0), m_concurrent_notify(false),
+    m_concurrent_notify_mutex(), m_stack_profile(0), m_kernel_profile(0),
+    m_elab_profile(0), m_lazy_clocks(false), m_sleeping_clocks()
 {
     init();
 }
@@ -517,13 +593,25 @@ sc_simcontext::crunch( bool once )
 	    sc_method_handle method_h = pop_runnable_method();
 	    while( method_h != 0 ) {
 		empty_eval_phase = false;
-		if ( !method_h->run_process() )
+		if ( m_parallel_evaluator &&
+		     m_parallel_evaluator->accepts( method_h ) )
+		{
+		    m_parallel_evaluator->defer( method_h );
+		}
+		else if ( !method_h->run_process() )
 		{
 		    goto out;
 		}
 		method_h = pop_runnable_method();
 	    }
 
+	    // execute deferred parallel-safe method processes
+
+	    if ( m_parallel_evaluator && !m_parallel_evaluator->execute() )
+	    {
+		goto out;
+	    }
+
 	    // execute (c)thread processes
 
 	    m_runnable->toggle_threads();
@@ -658,6 +746,10 @@ sc_simcontext::elaborate()
         return;
     }
 
+    if( m_elab_profile ) {
+        m_elab_profile->end_of( sc_elab_profile::construction );
+    }
+
     // Instantiate the method invocation module
     // (not added to public object hierarchy)
 
@@ -680,6 +772,9 @@ sc_simcontext::elaborate()
 
     }
     SC_DO_STAGE_CALLBACK_(construction_done); // SC_POST_BEFORE_END_OF_ELABORATION
+    if( m_elab_profile ) {
+        m_elab_profile->end_of( sc_elab_profile::before_end_of_elaboration );
+    }
 
     // SIGNAL THAT ELABORATION IS DONE
     //
@@ -690,6 +785,14 @@ sc_simcontext::elaborate()
     m_elaboration_done = true;
     set_simulation_status(SC_END_OF_ELABORATION);
 
+    // the binding is completed first thing in elaboration_done() anyway,
+    // doing it here separates its cost from the callbacks
+
+    m_port_registry->complete_binding();
+    if( m_elab_profile ) {
+        m_elab_profile->end_of( sc_elab_profile::complete_binding );
+    }
+
     m_port_registry->elaboration_done();
     m_export_registry->elaboration_done();
     m_prim_channel_registry->elaboration_done();
@@ -697,6 +800,9 @@ sc_simcontext::elaborate()
     SC_DO_STAGE_CALLBACK_(elaboration_done); // SC_POST_END_OF_ELABORATION
     sc_reset::reconcile_resets(m_reset_finder_q);
     m_reset_finder_q = NULL;
+    if( m_elab_profile ) {
+        m_elab_profile->end_of( sc_elab_profile::end_of_elaboration );
+    }
 
     // check for call(s) to sc_stop
     if( m_forced_stop ) {
@@ -719,6 +825,11 @@ sc_simcontext::prepare_to_simulate()
     m_cor_pkg = new sc_cor_pkg_t( this );
     m_cor = m_cor_pkg->get_main();
 
+    // instantiate the host threads for parallel evaluation, if requested
+    if ( m_parallel_threads > 1 )
+        m_parallel_evaluator =
+          new sc_parallel_evaluator( *this, m_parallel_threads );
+
     // NOTIFY ALL OBJECTS THAT SIMULATION IS ABOUT TO START:
 
     set_simulation_status(SC_START_OF_SIMULATION);
@@ -728,6 +839,9 @@ sc_simcontext::prepare_to_simulate()
     m_module_registry->start_simulation();
     SC_DO_STAGE_CALLBACK_(start_simulation); // SC_POST_START_OF_SIMULATION
     m_start_of_simulation_called = true;
+    if( m_elab_profile ) {
+        m_elab_profile->end_of( sc_elab_profile::start_of_simulation );
+    }
 
     // CHECK FOR CALL(S) TO sc_stop
 
@@ -818,6 +932,14 @@ sc_simcontext::prepare_to_simulate()
         } while( -- i >= 0 );
         m_delta_events.clear();
     }
+
+    if( m_elab_profile ) {
+        m_elab_profile->end_of( sc_elab_profile::initialization );
+        std::stringstream msg;
+        msg << "\n";
+        m_elab_profile->print( msg );
+        SC_REPORT_INFO( SC_ID_ELAB_PROFILE_, msg.str().c_str() );
+    }
 }
 
 void
@@ -847,6 +969,9 @@ sc_simcontext::initialize( bool no_crunch )
     elaborate();
 
     prepare_to_simulate();
+    if( m_kernel_profile ) {
+        m_kernel_profile->start();
+    }
     initial_crunch(no_crunch);
     m_in_simulator_control = false;
 }
@@ -949,14 +1074,14 @@ sc_simcontext::simulate( const sc_time& duration )
 	    // PROCESS TIMED NOTIFICATIONS AT THE CURRENT TIME
 
 	    do {
-		sc_event_timed* et = m_timed_events->extract_top();
+		sc_event_timed* et = extract_timed_event();
 		sc_event* e = et->event();
 		delete et;
 		if( e != 0 ) {
 		    e->trigger();
 		}
-	    } while( m_timed_events->size() &&
-		     m_timed_events->top()->notify_time() == t );
+	    } while( timed_events_size() &&
+		     timed_events_top()->notify_time() == t );
 
 	} while( m_runnable->is_empty() );
     } while ( t < until_t ); // hold off on the delta for the until_t time.
@@ -969,6 +1094,30 @@ exit_pause:
     m_in_simulator_control = false;
 }
 
+// The process is about to run, it may wait for its static sensitivity
+// afterwards, so the clocks it is sensitive to have to resume their edges.
+
+void
+sc_simcontext::wake_clocks( const sc_process_b* process_p )
+{
+    const std::vector<const sc_event*>& events = process_p->m_static_events;
+    for( std::size_t i = 0;
+         i < events.size() && !m_sleeping_clocks.empty(); ++i ) {
+        wake_clocks( events[i] );
+    }
+}
+
+void
+sc_simcontext::wake_clocks( const sc_event* event_p )
+{
+    // a clock removes itself from the list when it wakes up, the entry
+    // moved into its place has already been checked
+    for( std::size_t i = m_sleeping_clocks.size(); i-- > 0; ) {
+        if( m_sleeping_clocks[i]->drives( event_p ) )
+            m_sleeping_clocks[i]->wake();
+    }
+}
+
 void
 sc_simcontext::do_timestep(const sc_time& t)
 {
@@ -982,6 +1131,10 @@ sc_simcontext::do_timestep(const sc_time& t)
     }
 #endif
 
+    if( m_kernel_profile ) {
+        m_kernel_profile->timestep( delta_count_at_current_time() );
+    }
+
     m_curr_time = t;
     m_change_stamp++;
     m_initial_delta_count_at_current_time = m_delta_count;
@@ -1070,6 +1223,30 @@ sc_simcontext::end()
     m_module_registry->simulation_done();
     SC_DO_STAGE_CALLBACK_(simulation_done); // SC_POST_END_OF_SIMULATION
     m_end_of_simulation_called = true;
+
+    if ( m_stack_profile ) {
+        std::stringstream msg;
+        msg << "\n";
+        m_stack_profile->print( msg );
+        SC_REPORT_INFO( SC_ID_STACK_PROFILE_, msg.str().c_str() );
+    }
+
+    if ( m_kernel_profile ) {
+        std::stringstream msg;
+        msg << "\n";
+        m_kernel_profile->print( msg );
+        const std::string& file = m_kernel_profile->trace_file();
+        if ( !file.empty() ) {
+            std::ofstream os( file.c_str() );
+            if ( os ) {
+                m_kernel_profile->write_trace( os );
+                msg << "\ntrace written to " << file;
+            } else {
+                msg << "\ncannot write the trace to " << file;
+            }
+        }
+        SC_REPORT_INFO( SC_ID_KERNEL_PROFILE_, msg.str().c_str() );
+    }
 }
 
 void
@@ -1376,15 +1553,15 @@ sc_simcontext::is_running() const
 bool
 sc_simcontext::next_time( sc_time& result ) const
 {
-    while( m_timed_events->size()
+    while( timed_events_size()
            && ( !m_suspend ||  m_unsuspendable )
          ) {
-	sc_event_timed* et = m_timed_events->top();
+	sc_event_timed* et = timed_events_top();
 	if( et->event() != 0 ) {
 	    result = et->notify_time();
 	    return true;
 	}
-	delete m_timed_events->extract_top();
+	delete extract_timed_event();
     }
     return false;
 }
@@ -1878,6 +2055,212 @@ sc_get_stop_mode()
     return stop_mode;
 }
 
+//------------------------------------------------------------------------------
+//"sc_set_parallel_evaluate"
+//
+// This function sets the number of host threads used to evaluate method
+// processes, which have been marked as parallel-safe. A value of 0 or 1
+// disables the parallel evaluation. The default can also be set via the
+// environment variable SC_PARALLEL_EVALUATE.
+//     n_threads = number of host threads, including the simulator thread.
+//------------------------------------------------------------------------------
+SC_API void sc_set_parallel_evaluate( unsigned n_threads )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( simc_p->m_ready_to_simulate )
+    {
+        SC_REPORT_WARNING( SC_ID_PARALLEL_EVALUATE_AFTER_START_, "" );
+        return;
+    }
+    simc_p->m_parallel_threads = ( n_threads > 1 ) ? n_threads : 1;
+}
+
+SC_API unsigned sc_get_parallel_evaluate()
+{
+    return sc_get_curr_simcontext()->m_parallel_threads;
+}
+
+//------------------------------------------------------------------------------
+//"sc_get_stack_stats"
+//
+// This function returns the number and memory use of the stacks of the
+// thread processes. Only coroutine packages keeping their own stacks (the
+// QuickThreads package) report them, the result is empty otherwise.
+//------------------------------------------------------------------------------
+SC_API sc_stack_stats sc_get_stack_stats()
+{
+    sc_stack_stats stats;
+    sc_cor_pkg* cor_pkg = sc_get_curr_simcontext()->cor_pkg();
+    if ( cor_pkg )
+        cor_pkg->stack_stats( &stats );
+    return stats;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_stack_profiling"
+//
+// This function enables the measurement of the peak stack usage of thread
+// processes. The stacks are filled with a pattern when they are created,
+// which makes them resident in memory. The peak usage of a thread can be
+// queried via sc_process_handle::stack_usage(), a report of all threads
+// with recommended stack sizes is issued at sc_stop(). The measurement can
+// also be enabled via the environment variable SC_STACK_PROFILE.
+//     enable = true to paint the stacks of threads created from now on.
+//------------------------------------------------------------------------------
+SC_API void sc_set_stack_profiling( bool enable )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( simc_p->m_ready_to_simulate )
+    {
+        SC_REPORT_WARNING( SC_ID_STACK_PROFILING_AFTER_START_, "" );
+        return;
+    }
+    if ( enable && !simc_p->m_stack_profile )
+    {
+        simc_p->m_stack_profile = new sc_stack_profile( simc_p );
+    }
+    else if ( !enable )
+    {
+        delete simc_p->m_stack_profile;
+        simc_p->m_stack_profile = NULL;
+    }
+}
+
+SC_API bool sc_get_stack_profiling()
+{
+    return sc_get_curr_simcontext()->stack_profile() != NULL;
+}
+
+//------------------------------------------------------------------------------
+//"sc_print_stack_profile"
+//
+// This function writes the stack report, which is issued at sc_stop(), on
+// demand. Nothing is written, if the stack profiling is disabled.
+//------------------------------------------------------------------------------
+SC_API void sc_print_stack_profile( ::std::ostream& os )
+{
+    sc_stack_profile* profile_p = sc_get_curr_simcontext()->stack_profile();
+    if ( profile_p )
+        profile_p->print( os );
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_kernel_profiling"
+//
+// This function enables the measurement of the wall-clock time spent in
+// each process, of the activations of the processes, of the triggers of
+// the events and of the delta cycles in each time step. A report is issued
+// at sc_stop(), and a trace in the Chrome trace event format (for
+// chrome://tracing or Perfetto) is written. The measurement can also be
+// enabled via the environment variable SC_KERNEL_PROFILE.
+//     enable     = true to measure the simulation.
+//     trace_file = name of the trace file, no trace for NULL or "".
+//------------------------------------------------------------------------------
+SC_API void sc_set_kernel_profiling( bool enable, const char* trace_file )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( simc_p->m_ready_to_simulate )
+    {
+        SC_REPORT_WARNING( SC_ID_KERNEL_PROFILING_AFTER_START_, "" );
+        return;
+    }
+    delete simc_p->m_kernel_profile;
+    simc_p->m_kernel_profile = NULL;
+    if ( enable )
+    {
+        simc_p->m_kernel_profile =
+          new sc_kernel_profile( simc_p, trace_file ? trace_file : "" );
+    }
+}
+
+SC_API bool sc_get_kernel_profiling()
+{
+    return sc_get_curr_simcontext()->kernel_profile() != NULL;
+}
+
+//------------------------------------------------------------------------------
+//"sc_print_kernel_profile"
+//
+// This function writes the report, which is issued at sc_stop(), on demand.
+// Nothing is written, if the kernel profiling is disabled.
+//------------------------------------------------------------------------------
+SC_API void sc_print_kernel_profile( ::std::ostream& os )
+{
+    sc_kernel_profile* profile_p = sc_get_curr_simcontext()->kernel_profile();
+    if ( profile_p )
+        profile_p->print( os );
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_elab_profiling"
+//
+// This function enables the measurement of the wall-clock time and of the
+// memory allocations of the elaboration stages: the construction of the
+// hierarchy until sc_start(), the before_end_of_elaboration callbacks, the
+// completion of the port binding, the end_of_elaboration callbacks, the
+// start_of_simulation callbacks and the initialization of the processes.
+// The construction stage begins with this call. A report is issued before
+// the first delta cycle. The measurement can also be enabled via the
+// environment variable SC_ELAB_PROFILE.
+//     enable = true to measure the elaboration.
+//------------------------------------------------------------------------------
+SC_API void sc_set_elab_profiling( bool enable )
+{
+    sc_simcontext* simc_p = sc_get_curr_simcontext();
+    if ( simc_p->m_elaboration_done )
+    {
+        SC_REPORT_WARNING( SC_ID_ELAB_PROFILING_AFTER_START_, "" );
+        return;
+    }
+    if ( enable && !simc_p->m_elab_profile )
+    {
+        simc_p->m_elab_profile = new sc_elab_profile( simc_p );
+    }
+    else if ( !enable )
+    {
+        delete simc_p->m_elab_profile;
+        simc_p->m_elab_profile = NULL;
+    }
+}
+
+SC_API bool sc_get_elab_profiling()
+{
+    return sc_get_curr_simcontext()->elab_profile() != NULL;
+}
+
+//------------------------------------------------------------------------------
+//"sc_print_elab_profile"
+//
+// This function writes the report of the elaboration stages done so far on
+// demand. Nothing is written, if the elaboration profiling is disabled.
+//------------------------------------------------------------------------------
+SC_API void sc_print_elab_profile( ::std::ostream& os )
+{
+    sc_elab_profile* profile_p = sc_get_curr_simcontext()->elab_profile();
+    if ( profile_p )
+        profile_p->print( os );
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_elab_allocation_counter"
+//
+// This function installs a counter of the memory allocations of the
+// program, e.g., by a replacement of the global operator new, for the
+// elaboration profile. Without a counter, the profile reports the growth
+// of the heap where the C library provides it. If the elaboration is being
+// measured, its construction stage begins again with this call.
+//     counter = function returning the number of allocations and the
+//               number of bytes allocated so far, NULL for none.
+//------------------------------------------------------------------------------
+SC_API void sc_set_elab_allocation_counter(
+  void (*counter)( sc_dt::uint64& allocations, sc_dt::uint64& bytes ) )
+{
+    sc_elab_profile::set_allocation_counter( counter );
+    sc_elab_profile* profile_p = sc_get_curr_simcontext()->elab_profile();
+    if ( profile_p && !sc_get_curr_simcontext()->elaboration_done() )
+        profile_p->restart();
+}
+
 SC_API bool sc_is_unwinding()
 {
     return sc_get_current_process_handle().is_unwinding();
@@ -37,6 +37,7 @@
 #include "sysc/kernel/sc_stage_callback_if.h"
 #include "sysc/utils/sc_hash.h"
 #include "sysc/utils/sc_pq.h"
+#include "sysc/utils/sc_timing_wheel.h"
 
 #include "sysc/communication/sc_host_mutex.h"
 
@@ -49,6 +50,7 @@ namespace sc_core {
 
 // forward declarations
 
+class sc_clock;
 class sc_cor;
 class sc_cor_pkg;
 class sc_event;
@@ -63,7 +65,11 @@ class sc_name_gen;
 class sc_object;
 class sc_object_host;
 class sc_object_manager;
+class sc_parallel_evaluator;
 class sc_stage_callback_registry;
+class sc_stack_profile;
+class sc_kernel_profile;
+class sc_elab_profile;
 class sc_process_handle;
 class sc_port_registry;
 class sc_prim_channel_registry;
@@ -99,6 +105,45 @@ enum sc_stop_mode {          // sc_stop modes:
 extern SC_API void sc_set_stop_mode( sc_stop_mode mode );
 extern SC_API sc_stop_mode sc_get_stop_mode();
 
+// number of host threads used to evaluate parallel-safe method processes
+extern SC_API void sc_set_parallel_evaluate( unsigned n_threads );
+extern SC_API unsigned sc_get_parallel_evaluate();
+
+// statistics of the stacks of thread processes (see sc_get_stack_stats)
+struct SC_API sc_stack_stats
+{
+    sc_stack_stats()
+      : live_stacks( 0 ), pooled_stacks( 0 )
+      , reserved_bytes( 0 ), resident_bytes( 0 )
+    {}
+
+    std::size_t live_stacks;    // stacks of existing thread processes.
+    std::size_t pooled_stacks;  // released stacks, kept for reuse.
+    std::size_t reserved_bytes; // address space of live and pooled stacks.
+    std::size_t resident_bytes; // resident memory of live and pooled stacks.
+};
+extern SC_API sc_stack_stats sc_get_stack_stats();
+
+// peak stack usage of thread processes, reported at sc_stop()
+extern SC_API void sc_set_stack_profiling( bool enable );
+extern SC_API bool sc_get_stack_profiling();
+extern SC_API void sc_print_stack_profile( ::std::ostream& os );
+
+// run time of processes, activity of events and delta cycles, reported at
+// sc_stop()
+extern SC_API void sc_set_kernel_profiling( bool enable,
+  const char* trace_file = "sc_kernel_profile.json" );
+extern SC_API bool sc_get_kernel_profiling();
+extern SC_API void sc_print_kernel_profile( ::std::ostream& os );
+
+// run time and allocations of the elaboration stages, reported before the
+// first delta cycle
+extern SC_API void sc_set_elab_profiling( bool enable );
+extern SC_API bool sc_get_elab_profiling();
+extern SC_API void sc_print_elab_profile( ::std::ostream& os );
+extern SC_API void sc_set_elab_allocation_counter(
+  void (*counter)( sc_dt::uint64& allocations, sc_dt::uint64& bytes ) );
+
 enum sc_starvation_policy 
 {
     SC_EXIT_ON_STARVATION,
@@ -174,6 +219,7 @@ class SC_API sc_simcontext
     friend class sc_time_tuple;
     friend class sc_clock;
     friend class sc_method_process;
+    friend class sc_parallel_evaluator;
     friend class sc_stage_callback_registry;
     friend class sc_port_registry;
     friend class sc_process_b;
@@ -199,6 +245,11 @@ class SC_API sc_simcontext
     friend SC_API void sc_unsuspend_all();
     friend SC_API void sc_unsuspendable();
     friend SC_API void sc_suspendable();
+    friend SC_API void sc_set_parallel_evaluate( unsigned );
+    friend SC_API unsigned sc_get_parallel_evaluate();
+    friend SC_API void sc_set_stack_profiling( bool );
+    friend SC_API void sc_set_kernel_profiling( bool, const char* );
+    friend SC_API void sc_set_elab_profiling( bool );
 
     friend SC_API void sc_register_stage_callback(sc_stage_callback_if & cb,
                                                   unsigned int mask);
@@ -313,6 +364,12 @@ public:
 
     sc_cor_pkg* cor_pkg()
         { return m_cor_pkg; }
+    sc_stack_profile* stack_profile() const
+        { return m_stack_profile; }
+    sc_kernel_profile* kernel_profile() const
+        { return m_kernel_profile; }
+    sc_elab_profile* elab_profile() const
+        { return m_elab_profile; }
     sc_cor* next_cor();
 
     void add_reset_finder( sc_reset_finder* );
@@ -345,6 +402,12 @@ private:
     int add_delta_event( sc_event* );
     void remove_delta_event( sc_event* );
     void add_timed_event( sc_event_timed* );
+    // guards the notification state while a parallel batch is running
+    sc_host_mutex* concurrent_notify_mutex()
+        { return m_concurrent_notify ? &m_concurrent_notify_mutex : 0; }
+    int timed_events_size() const;
+    sc_event_timed* timed_events_top() const;
+    sc_event_timed* extract_timed_event() const;
 
     void trace_cycle( bool delta_cycle );
 
@@ -359,6 +422,8 @@ private:
 
     void push_runnable_method( sc_method_handle );
     void push_runnable_thread( sc_thread_handle );
+    void push_runnable_methods( sc_method_handle, sc_method_handle );
+    void push_runnable_threads( sc_thread_handle, sc_thread_handle );
 
     void push_runnable_method_front( sc_method_handle );
     void push_runnable_thread_front( sc_thread_handle );
@@ -379,6 +444,13 @@ private:
 
     inline void set_simulation_status(sc_status status);
 
+private:
+
+    // wake the sleeping lazy clocks, which drive the event, or the static
+    // events of the process
+    void wake_clocks( const sc_event* );
+    void wake_clocks( const sc_process_b* );
+
 private:
 
     enum execution_phases {
@@ -410,7 +482,8 @@ private:
     std::vector<sc_object*>     m_child_objects;
 
     std::vector<sc_event*>      m_delta_events;
-    sc_ppq<sc_event_timed*>*    m_timed_events;
+    sc_ppq<sc_event_timed*>*    m_timed_events;  // binary heap, or
+    sc_timing_wheel<sc_event_timed*>* m_timed_wheel; // timing wheel.
 
     sc_event*                   m_null_event_p;
 
@@ -449,6 +522,18 @@ private:
     int                         m_suspend;
     int                         m_unsuspendable;
 
+    unsigned                    m_parallel_threads;   // see sc_set_parallel_evaluate
+    sc_parallel_evaluator*      m_parallel_evaluator; // evaluates parallel-safe methods.
+    bool                        m_concurrent_notify;  // parallel batch is running.
+    sc_host_mutex               m_concurrent_notify_mutex;
+
+    sc_stack_profile*           m_stack_profile; // see sc_set_stack_profiling
+    sc_kernel_profile*          m_kernel_profile;// see sc_set_kernel_profiling
+    sc_elab_profile*            m_elab_profile;  // see sc_set_elab_profiling
+
+    bool                        m_lazy_clocks;     // see sc_clock::set_lazy
+    std::vector<sc_clock*>      m_sleeping_clocks; // lazy clocks without edges.
+
 private:
 
     // disabled
@@ -694,7 +779,30 @@ inline
 void
 sc_simcontext::add_timed_event( sc_event_timed* et )
 {
-    m_timed_events->insert( et );
+    if( m_timed_wheel ) m_timed_wheel->insert( et );
+    else                m_timed_events->insert( et );
+}
+
+inline
+int
+sc_simcontext::timed_events_size() const
+{
+    return m_timed_wheel ? m_timed_wheel->size() : m_timed_events->size();
+}
+
+inline
+sc_event_timed*
+sc_simcontext::timed_events_top() const
+{
+    return m_timed_wheel ? m_timed_wheel->top() : m_timed_events->top();
+}
+
+inline
+sc_event_timed*
+sc_simcontext::extract_timed_event() const
+{
+    return m_timed_wheel ? m_timed_wheel->extract_top()
+                         : m_timed_events->extract_top();
 }
 
 // ----------------------------------------------------------------------------
@@ -33,6 +33,7 @@
 #define SC_SIMCONTEXT_INT_H
 
 #include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_kernel_profile.h"
 #include "sysc/kernel/sc_runnable.h"
 #include "sysc/kernel/sc_runnable_int.h"
 
@@ -75,6 +76,8 @@ sc_simcontext::set_curr_proc( sc_process_b* process_h )
     m_curr_proc_info.kind           = process_h->proc_kind();
     m_current_writer =
       (m_write_check != SC_SIGNAL_WRITE_CHECK_DISABLE_) ? process_h : 0;
+    if( SC_UNLIKELY_( m_kernel_profile ) )
+        m_kernel_profile->switch_to( process_h );
 }
 
 inline
@@ -85,6 +88,8 @@ sc_simcontext::reset_curr_proc()
     m_curr_proc_info.kind           = SC_NO_PROC_;
     m_current_writer                = 0;
     sc_process_b::m_last_created_process_p = 0;
+    if( SC_UNLIKELY_( m_kernel_profile ) )
+        m_kernel_profile->switch_to( 0 );
 }
 
 inline
@@ -205,6 +210,14 @@ sc_simcontext::push_runnable_method( sc_method_handle method_h )
     m_runnable->push_back_method( method_h );
 }
 
+inline
+void
+sc_simcontext::push_runnable_methods( sc_method_handle first_h,
+                                      sc_method_handle last_h )
+{
+    m_runnable->push_back_methods( first_h, last_h );
+}
+
 inline
 void
 sc_simcontext::push_runnable_method_front( sc_method_handle method_h )
@@ -219,6 +232,14 @@ sc_simcontext::push_runnable_thread( sc_thread_handle thread_h )
     m_runnable->push_back_thread( thread_h );
 }
 
+inline
+void
+sc_simcontext::push_runnable_threads( sc_thread_handle first_h,
+                                      sc_thread_handle last_h )
+{
+    m_runnable->push_back_threads( first_h, last_h );
+}
+
 inline
 void
 sc_simcontext::push_runnable_thread_front( sc_thread_handle thread_h )
@@ -237,6 +258,10 @@ sc_simcontext::pop_runnable_method()
 	return 0;
     }
     set_curr_proc( (sc_process_b*)method_h );
+    if( SC_UNLIKELY_( m_kernel_profile ) )
+        m_kernel_profile->activated();
+    if( SC_UNLIKELY_( !m_sleeping_clocks.empty() ) )
+        wake_clocks( method_h );
     return method_h;
 }
 
@@ -250,6 +275,10 @@ sc_simcontext::pop_runnable_thread()
 	return 0;
     }
     set_curr_proc( (sc_process_b*)thread_h );
+    if( SC_UNLIKELY_( m_kernel_profile ) )
+        m_kernel_profile->activated();
+    if( SC_UNLIKELY_( !m_sleeping_clocks.empty() ) )
+        wake_clocks( thread_h );
     return thread_h;
 }
 
@@ -0,0 +1,197 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_stack_profile.cpp -- Peak stack usage of thread processes.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_stack_profile.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_thread_process.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+
+namespace sc_core {
+
+namespace {
+
+const unsigned char paint_pattern = 0xa5;
+
+// granularity of the recommended stack sizes
+const std::size_t stack_page = 4096;
+
+// number of threads listed in the report
+const std::size_t report_lines = 20;
+
+struct report_entry
+{
+    const char* name;
+    std::size_t stack_size;
+    std::size_t peak;
+    std::size_t recommended;
+
+    // largest savings first
+    bool operator < ( const report_entry& other ) const
+    {
+        std::size_t saved = stack_size - std::min( stack_size, recommended );
+        std::size_t other_saved =
+          other.stack_size - std::min( other.stack_size, other.recommended );
+        if( saved != other_saved )
+            return saved > other_saved;
+        return std::strcmp( name, other.name ) < 0;
+    }
+};
+
+} // anonymous namespace
+
+
+sc_stack_profile::sc_stack_profile( sc_simcontext* simc )
+  : m_simc( simc )
+  , m_destroyed()
+{}
+
+void
+sc_stack_profile::paint( void* begin, std::size_t size )
+{
+    std::memset( begin, paint_pattern, size );
+}
+
+std::size_t
+sc_stack_profile::usage( const void* begin, std::size_t size, bool grow_down )
+{
+    const unsigned char* p = static_cast<const unsigned char*>( begin );
+    std::size_t unused = 0;
+
+    if( grow_down ) {
+        while( unused < size && p[unused] == paint_pattern )
+            ++unused;
+    } else {
+        while( unused < size && p[size - 1 - unused] == paint_pattern )
+            ++unused;
+    }
+    return size - unused;
+}
+
+// the observed peak plus 25 percent and the red zone page, rounded up to
+// whole pages
+
+std::size_t
+sc_stack_profile::recommended_size( std::size_t peak )
+{
+    std::size_t size = peak + peak / 4 + stack_page;
+    size = ( size + stack_page - 1 ) / stack_page * stack_page;
+    return std::max( size, 4 * stack_page );
+}
+
+void
+sc_stack_profile::record( const char* name, std::size_t stack_size,
+                          std::size_t peak )
+{
+    entry e;
+    e.name = name;
+    e.stack_size = stack_size;
+    e.peak = peak;
+    m_destroyed.push_back( e );
+}
+
+void
+sc_stack_profile::print( std::ostream& os ) const
+{
+    std::vector<report_entry> entries;
+    std::size_t unknown = 0;
+
+    for( sc_object* obj_p = m_simc->first_object(); obj_p;
+         obj_p = m_simc->next_object() ) {
+        sc_thread_handle thread_p = dynamic_cast<sc_thread_handle>( obj_p );
+        if( !thread_p )
+            continue;
+        report_entry e;
+        e.name = thread_p->name();
+        e.stack_size = thread_p->stack_size();
+        e.peak = thread_p->stack_usage();
+        e.recommended = recommended_size( e.peak );
+        if( e.peak == 0 ) {
+            ++unknown;
+        } else {
+            entries.push_back( e );
+        }
+    }
+    for( std::size_t i = 0; i < m_destroyed.size(); ++i ) {
+        report_entry e;
+        e.name = m_destroyed[i].name.c_str();
+        e.stack_size = m_destroyed[i].stack_size;
+        e.peak = m_destroyed[i].peak;
+        e.recommended = recommended_size( e.peak );
+        if( e.peak == 0 ) {
+            ++unknown;
+        } else {
+            entries.push_back( e );
+        }
+    }
+    std::sort( entries.begin(), entries.end() );
+
+    std::size_t total_size = 0;
+    std::size_t total_recommended = 0;
+    std::size_t max_peak = 0;
+    for( std::size_t i = 0; i < entries.size(); ++i ) {
+        total_size += entries[i].stack_size;
+        total_recommended +=
+          std::min( entries[i].stack_size, entries[i].recommended );
+        max_peak = std::max( max_peak, entries[i].peak );
+    }
+
+    os << std::setw(40) << std::left << "thread" << std::right
+       << std::setw(12) << "stack size"
+       << std::setw(12) << "peak usage"
+       << std::setw(13) << "recommended" << "\n";
+    for( std::size_t i = 0; i < entries.size() && i < report_lines; ++i ) {
+        os << std::setw(40) << std::left << entries[i].name << std::right
+           << std::setw(12) << entries[i].stack_size
+           << std::setw(12) << entries[i].peak
+           << std::setw(13) << entries[i].recommended << "\n";
+    }
+    if( entries.size() > report_lines ) {
+        os << "(" << entries.size() - report_lines << " more threads)\n";
+    }
+    os << entries.size() << " threads, " << total_size << " bytes of stack,"
+       << " peak usage " << max_peak << " bytes, "
+       << total_recommended << " bytes recommended";
+    if( unknown ) {
+        os << "\n" << unknown << " threads without painted stacks";
+    }
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
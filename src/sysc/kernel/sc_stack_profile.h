@@ -0,0 +1,116 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_stack_profile.h -- Peak stack usage of thread processes.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_STACK_PROFILE_H_INCLUDED_
+#define SC_STACK_PROFILE_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::vector
+#endif
+
+namespace sc_core {
+
+class sc_simcontext;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_stack_profile
+//
+//  Measures the peak stack usage of thread processes. The coroutine
+//  packages paint the stacks with a pattern when they are created, the
+//  peak usage is found by searching for the deepest overwritten word.
+//  The peak usage of a thread is recorded when it is destroyed, the
+//  report covers the existing and the destroyed threads.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_stack_profile
+{
+public:
+
+    explicit sc_stack_profile( sc_simcontext* simc );
+
+    // fill a stack area with the pattern
+    static void paint( void* begin, std::size_t size );
+
+    // bytes of a painted stack area, which have been used since painting,
+    // counted from the top of the area (stacks growing down) or from its
+    // bottom (stacks growing up)
+    static std::size_t usage( const void* begin, std::size_t size,
+                              bool grow_down = true );
+
+    // stack size recommended for the observed peak usage
+    static std::size_t recommended_size( std::size_t peak );
+
+    // record the peak usage of a destroyed thread
+    void record( const char* name, std::size_t stack_size, std::size_t peak );
+
+    // write the report of all threads
+    void print( std::ostream& os ) const;
+
+private:
+
+    struct entry
+    {
+        std::string name;
+        std::size_t stack_size;
+        std::size_t peak;
+    };
+
+    sc_simcontext*     m_simc;
+    std::vector<entry> m_destroyed; // threads, which no longer exist.
+
+private:
+
+    // disabled
+    sc_stack_profile( const sc_stack_profile& );
+    sc_stack_profile& operator = ( const sc_stack_profile& );
+};
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_STACK_PROFILE_H_INCLUDED_
+// Taf!
@@ -32,6 +32,7 @@
 #include "sysc/kernel/sc_process_handle.h"
 #include "sysc/kernel/sc_simcontext_int.h"
 #include "sysc/kernel/sc_module.h"
+#include "sysc/kernel/sc_stack_profile.h"
 #include "sysc/utils/sc_machine.h"
 
 // DEBUGGING MACROS:
@@ -443,6 +444,18 @@ sc_thread_process::sc_thread_process( const char* name_p, bool free_host,
 
 }
 
+//------------------------------------------------------------------------------
+//"sc_thread_process::stack_usage"
+//
+// This method returns the peak number of bytes used on the stack of this
+// thread so far. The result is 0 if the stack has not been painted when
+// it was created (see sc_set_stack_profiling).
+//------------------------------------------------------------------------------
+std::size_t sc_thread_process::stack_usage() const
+{
+    return m_cor_p ? m_cor_p->stack_usage() : 0;
+}
+
 //------------------------------------------------------------------------------
 //"sc_thread_process::~sc_thread_process"
 //
@@ -454,6 +467,9 @@ sc_thread_process::~sc_thread_process()
     // DESTROY THE COROUTINE FOR THIS THREAD:
 
     if( m_cor_p != 0 ) {
+        sc_stack_profile* profile_p = simcontext()->stack_profile();
+        if( profile_p )
+            profile_p->record( name(), m_stack_size, m_cor_p->stack_usage() );
         m_cor_p->stack_protect( false );
         delete m_cor_p;
         m_cor_p = 0;
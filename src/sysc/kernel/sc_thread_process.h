@@ -124,6 +124,10 @@ class sc_thread_process : public sc_process_b {
     virtual const char* kind() const
         { return "sc_thread_process"; }
 
+    virtual std::size_t stack_size() const
+        { return m_stack_size; }
+    virtual std::size_t stack_usage() const;
+
   protected:
     // may not be deleted manually (called from sc_process_b)
     virtual ~sc_thread_process();
@@ -151,7 +155,7 @@ class sc_thread_process : public sc_process_b {
         sc_descendant_inclusion_info descendants = SC_NO_DESCENDANTS );
 
     bool trigger_dynamic( sc_event* );
-    inline void trigger_static();
+    inline bool trigger_static();
 
     void wait( const sc_event& );
     void wait( const sc_event_or_list& );
@@ -453,9 +457,9 @@ inline sc_cor* get_cor_pointer( sc_process_b* process_p )
 //------------------------------------------------------------------------------
 //"sc_thread_process::trigger_static"
 //
-// This inline method adds the current thread to the queue of runnable
-// processes if required.  This is the case if the following criteria
-// are met:
+// This inline method determines whether the current thread has to be added
+// to the queue of runnable processes.  This is the case if the following
+// criteria are met:
 //   (1) The process is in a runnable state.
 //   (2) The process is not already on the run queue.
 //   (3) The process is expecting a static trigger,
@@ -469,9 +473,13 @@ inline sc_cor* get_cor_pointer( sc_process_b* process_p )
 //   (2) If the triggering process is the same process, the trigger is
 //       ignored as well, unless SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS
 //       is defined.
+//   (3) The caller pushes the thread onto the runnable queue, so that all
+//       threads triggered by an event can be queued at once.
+//
+// Result is true if the thread has to be pushed onto the runnable queue.
 //------------------------------------------------------------------------------
 inline
-void
+bool
 sc_thread_process::trigger_static()
 {
     // No need to try queueing this thread if one of the following is true:
@@ -482,33 +490,33 @@ sc_thread_process::trigger_static()
 
     if ( (m_state & ps_bit_disabled) || is_runnable() ||
           m_trigger_type != STATIC )
-        return;
+        return false;
 
 #if ! defined( SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS )
     if( SC_UNLIKELY_( sc_get_current_process_b() == this ) )
     {
         report_immediate_self_notification();
-        return;
+        return false;
     }
 #endif // SC_ENABLE_IMMEDIATE_SELF_NOTIFICATIONS
 
     if ( m_wait_cycle_n > 0 && THROW_NONE == m_throw_status )
     {
         --m_wait_cycle_n;
-        return;
+        return false;
     }
 
     // If we get here, then the thread has satisfied its wait criteria. If it is
     // suspended, then mark its state as ready to run. If it is not suspended,
-    // then push it onto the runnable queue.
+    // then it has to be pushed onto the runnable queue.
 
     if ( m_state & ps_bit_suspended )
     {
         m_state = m_state | ps_bit_ready_to_run;
-        return;
+        return false;
     }
 
-    simcontext()->push_runnable_thread(this);
+    return true;
 }
 
 #undef DEBUG_MSG
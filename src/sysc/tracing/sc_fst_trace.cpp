@@ -0,0 +1,1401 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_fst_trace.cpp - Implementation of FST tracing.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  The file consists of blocks, each starting with a one byte type and the
+  big-endian 64 bit length of the block (including the length itself):
+
+    header     - times, counts, timescale, version and date (fixed size)
+    value      - values at the start of the block, the value changes of
+                 each variable (compressed on their own), an index of
+                 these and the table of the time steps in the block
+    geometry   - the bit width of each variable
+    hierarchy  - scopes and variable names, as a gzip stream
+
+  A variable is identified by its handle, its position in the geometry.
+  The changes of a variable are the time step, relative to its previous
+  change, and the new value. Without zlib, the same blocks are written
+  uncompressed, which is allowed by the format.
+
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_ver.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/datatypes/bit/sc_bit.h"
+#include "sysc/datatypes/bit/sc_logic.h"
+#include "sysc/datatypes/bit/sc_lv_base.h"
+#include "sysc/datatypes/int/sc_signed.h"
+#include "sysc/datatypes/int/sc_unsigned.h"
+#include "sysc/datatypes/int/sc_int_base.h"
+#include "sysc/datatypes/int/sc_uint_base.h"
+#include "sysc/datatypes/int/sc_vector_utils.h"
+#include "sysc/datatypes/int/sc_signed_inlines.h"
+#include "sysc/datatypes/int/sc_signed_ops.h"
+#include "sysc/datatypes/int/sc_unsigned_inlines.h"
+#include "sysc/datatypes/fx/fx.h"
+#include "sysc/tracing/sc_fst_trace.h"
+#include "sysc/tracing/sc_trace_buffer.h"
+#include "sysc/utils/sc_report.h" // sc_assert
+
+#if defined(SC_HAVE_ZLIB)
+#  include <zlib.h>
+#endif
+
+namespace sc_core {
+
+namespace {
+
+// block types
+const unsigned char fst_bl_hdr    = 0;
+const unsigned char fst_bl_vcdata = 1;
+const unsigned char fst_bl_geom   = 3;
+const unsigned char fst_bl_hier   = 4;
+
+// hierarchy entries
+const unsigned char fst_st_vcd_module    = 0;
+const unsigned char fst_st_gen_attrbegin = 252;
+const unsigned char fst_st_vcd_scope     = 254;
+const unsigned char fst_st_vcd_upscope   = 255;
+const unsigned char fst_at_misc          = 0;
+const unsigned char fst_mt_comment       = 0;
+const unsigned char fst_vd_implicit      = 0;
+
+// variable types
+const unsigned char fst_vt_vcd_event = 0;
+const unsigned char fst_vt_vcd_real  = 3;
+const unsigned char fst_vt_vcd_time  = 8;
+const unsigned char fst_vt_vcd_wire  = 16;
+
+// size of the header block, without the type
+const sc_dt::uint64 fst_hdr_size = 329;
+const std::size_t fst_hdr_version_size = 128;
+const std::size_t fst_hdr_date_size = 119;
+
+// offsets of the fields completed, when the file is closed
+const long fst_hdr_offs_start_time = 9;
+const long fst_hdr_offs_num_scopes = 41;
+
+// the readers check the byte order of reals with this value
+const double fst_double_endtest = 2.7182818284590452354;
+
+// the block is written at the next time step, when the value changes
+// exceed this size
+const std::size_t fst_block_size = 1 << 25;
+
+// the time steps of a block are limited by the 32 bit time deltas
+const unsigned fst_block_time_steps = 1 << 24;
+
+// values of single bits, other than '0' and '1', in the value changes
+const char fst_rcv_str[] = "xzhuwl-?";
+
+// shortest value changes of a variable, which are compressed
+const std::size_t fst_compress_min = 32;
+
+// zlib level of the values, the fastest one gives nearly the same size
+const int fst_compress_level = 1;
+
+void
+put_varint( std::vector<unsigned char>& buf, sc_dt::uint64 v )
+{
+    while( v >= 0x80 ) {
+        buf.push_back( static_cast<unsigned char>( v | 0x80 ) );
+        v >>= 7;
+    }
+    buf.push_back( static_cast<unsigned char>( v ) );
+}
+
+void
+put_uint64( std::vector<unsigned char>& buf, sc_dt::uint64 v )
+{
+    for( int shift = 56; shift >= 0; shift -= 8 )
+        buf.push_back( static_cast<unsigned char>( v >> shift ) );
+}
+
+void
+set_uint64( unsigned char* p, sc_dt::uint64 v )
+{
+    for( int shift = 56; shift >= 0; shift -= 8 )
+        *p++ = static_cast<unsigned char>( v >> shift );
+}
+
+void
+put_bytes( std::vector<unsigned char>& buf, const void* p, std::size_t n )
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>( p );
+    buf.insert( buf.end(), bytes, bytes + n );
+}
+
+void
+put_string( std::vector<unsigned char>& buf, const std::string& s )
+{
+    put_bytes( buf, s.data(), s.size() );
+    buf.push_back( 0 );
+}
+
+// append the data compressed in the zlib format, if this is smaller,
+// returns false and appends nothing otherwise
+
+bool
+put_compressed( std::vector<unsigned char>& buf, const void* p,
+                std::size_t n, int level )
+{
+#if defined(SC_HAVE_ZLIB)
+    std::size_t pos = buf.size();
+    uLongf len = compressBound( static_cast<uLong>( n ) );
+    buf.resize( pos + len );
+    int rc = compress2( &buf[pos], &len, static_cast<const Bytef*>( p ),
+                        static_cast<uLong>( n ), level );
+    if( rc == Z_OK && len < n ) {
+        buf.resize( pos + len );
+        return true;
+    }
+    buf.resize( pos );
+#endif
+    return false;
+}
+
+// append the data as a gzip stream
+
+#if !defined(SC_HAVE_ZLIB)
+sc_dt::uint64
+crc32( const std::vector<unsigned char>& data )
+{
+    static unsigned table[256];
+    if( !table[1] ) {
+        for( unsigned i = 0; i < 256; ++i ) {
+            unsigned c = i;
+            for( int k = 0; k < 8; ++k )
+                c = ( c & 1 ) ? 0xedb88320u ^ ( c >> 1 ) : c >> 1;
+            table[i] = c;
+        }
+    }
+    unsigned crc = 0xffffffffu;
+    for( std::size_t i = 0; i < data.size(); ++i )
+        crc = table[( crc ^ data[i] ) & 0xff] ^ ( crc >> 8 );
+    return crc ^ 0xffffffffu;
+}
+#endif
+
+void
+put_gzip( std::vector<unsigned char>& buf,
+          const std::vector<unsigned char>& data )
+{
+#if defined(SC_HAVE_ZLIB)
+    z_stream strm;
+    std::memset( &strm, 0, sizeof( strm ) );
+    int rc = deflateInit2( &strm, 4, Z_DEFLATED, 15 + 16, 8,
+                           Z_DEFAULT_STRATEGY );
+    sc_assert( rc == Z_OK );
+
+    std::size_t pos = buf.size();
+    uLong len = deflateBound( &strm, static_cast<uLong>( data.size() ) );
+    buf.resize( pos + len );
+    strm.next_in = const_cast<Bytef*>( data.empty() ? 0 : &data[0] );
+    strm.avail_in = static_cast<uInt>( data.size() );
+    strm.next_out = &buf[pos];
+    strm.avail_out = static_cast<uInt>( len );
+    rc = deflate( &strm, Z_FINISH );
+    sc_assert( rc == Z_STREAM_END );
+    buf.resize( pos + strm.total_out );
+    deflateEnd( &strm );
+#else
+    // header, stored deflate blocks, CRC and size
+    static const unsigned char header[10] =
+      { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff };
+    put_bytes( buf, header, sizeof( header ) );
+
+    std::size_t pos = 0;
+    do {
+        std::size_t n = std::min<std::size_t>( data.size() - pos, 0xffff );
+        buf.push_back( pos + n == data.size() ? 1 : 0 );
+        buf.push_back( static_cast<unsigned char>( n ) );
+        buf.push_back( static_cast<unsigned char>( n >> 8 ) );
+        buf.push_back( static_cast<unsigned char>( ~n ) );
+        buf.push_back( static_cast<unsigned char>( ~n >> 8 ) );
+        if( n )
+            put_bytes( buf, &data[pos], n );
+        pos += n;
+    } while( pos < data.size() );
+
+    sc_dt::uint64 tail[2] = { crc32( data ), data.size() };
+    for( int i = 0; i < 2; ++i )
+        for( int shift = 0; shift < 32; shift += 8 )
+            buf.push_back( static_cast<unsigned char>( tail[i] >> shift ) );
+#endif
+}
+
+// the value of up to 64 bits as characters, all bits are 'x' if it does
+// not fit
+
+void
+write_bits( char* dst, int bit_width, sc_dt::uint64 value, bool fits )
+{
+    if( !fits ) {
+        std::memset( dst, 'x', bit_width );
+        return;
+    }
+    for( int bitindex = bit_width - 1; bitindex >= 0; --bitindex )
+        *dst++ = ( bitindex < 64 && ( ( value >> bitindex ) & 1 ) ) ? '1' : '0';
+}
+
+void
+write_real( char* dst, double value )
+{
+    std::memcpy( dst, &value, sizeof( double ) );
+}
+
+// Pack the characters '0' and '1' into bits, from the most significant
+// bit of the first byte, eight characters at a time. Returns false, if
+// there are other characters.
+
+bool
+pack_bits( unsigned char* dst, const char* value, int width )
+{
+    const sc_dt::uint64 ones  = 0x0101010101010101ULL;
+    const sc_dt::uint64 zeros = 0x3030303030303030ULL; // "00000000"
+
+    int i = 0;
+    for( ; i + 8 <= width; i += 8 ) {
+        sc_dt::uint64 chars;
+        std::memcpy( &chars, value + i, 8 );
+        if( ( chars & ~ones ) != zeros )
+            return false;
+        // gather the low bits of the bytes in memory order (little endian)
+        *dst++ = static_cast<unsigned char>(
+                   ( ( chars & ones ) * 0x8040201008040201ULL ) >> 56 );
+    }
+    if( i < width ) {
+        unsigned char bits = 0;
+        for( int j = 0; i < width; ++i, ++j ) {
+            if( ( value[i] & ~1 ) != '0' )
+                return false;
+            bits |= static_cast<unsigned char>( ( value[i] & 1 ) << ( 7 - j ) );
+        }
+        *dst = bits;
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : fst_trace
+//
+//  Base class for FST traces.
+// ----------------------------------------------------------------------------
+
+class fst_trace
+{
+public:
+
+    fst_trace( const std::string& name_ )
+      : name( name_ ), var_type( fst_vt_vcd_wire ), bit_width( 0 )
+      , handle( 0 ), offset( 0 ), last_index( 0 ), changes()
+    {}
+
+    virtual ~fst_trace() {}
+
+    virtual void set_width() {}
+
+    virtual bool changed() = 0;
+
+    // Store the current value as the old value, and write it to dst as
+    // bit_width characters '0', '1', 'x', 'z', or as a double for reals.
+    virtual void write( char* dst ) = 0;
+
+    bool is_real() const
+        { return var_type == fst_vt_vcd_real; }
+
+    // bytes of the value
+    std::size_t size() const
+        { return is_real() ? sizeof( double ) : bit_width; }
+
+    const std::string name;
+    unsigned char     var_type;
+    int               bit_width;
+
+    // state of the trace file
+    sc_dt::uint64              handle;     // 1 .. number of variables.
+    std::size_t                offset;     // in the current values.
+    unsigned                   last_index; // time step of last change.
+    std::vector<unsigned char> changes;    // value changes in the block.
+};
+
+
+/*****************************************************************************/
+
+class fst_sc_event_trace : public fst_trace
+{
+public:
+    fst_sc_event_trace( const sc_dt::uint64& trigger_stamp_,
+                        const std::string& name_ )
+      : fst_trace( name_ )
+      , trigger_stamp( trigger_stamp_ ), old_trigger_stamp( trigger_stamp_ )
+    {
+        var_type = fst_vt_vcd_event;
+        bit_width = 1;
+    }
+
+    bool changed()
+        { return trigger_stamp != old_trigger_stamp; }
+
+    void write( char* dst )
+    {
+        *dst = '1';
+        old_trigger_stamp = trigger_stamp;
+    }
+
+protected:
+    const sc_dt::uint64& trigger_stamp;
+    sc_dt::uint64        old_trigger_stamp;
+};
+
+/*****************************************************************************/
+
+class fst_sc_time_trace : public fst_trace
+{
+public:
+    fst_sc_time_trace( const sc_time& object_, const std::string& name_ )
+      : fst_trace( name_ ), object( object_ ), old_value( object_.value() )
+    {
+        var_type = fst_vt_vcd_time;
+        bit_width = 64;
+    }
+
+    bool changed()
+        { return object.value() != old_value; }
+
+    void write( char* dst )
+    {
+        old_value = object.value();
+        write_bits( dst, bit_width, old_value, true );
+    }
+
+protected:
+    const sc_time& object;
+    sc_dt::uint64  old_value;
+};
+
+/*****************************************************************************/
+
+// bool, sc_bit and sc_logic
+
+template <class T>
+class fst_bit_trace : public fst_trace
+{
+public:
+    fst_bit_trace( const T& object_, const std::string& name_ )
+      : fst_trace( name_ ), object( object_ ), old_value( object_ )
+    {
+        bit_width = 1;
+    }
+
+    bool changed()
+        { return object != old_value; }
+
+    void write( char* dst )
+    {
+        old_value = object;
+        *dst = to_char( object );
+    }
+
+protected:
+    static char to_char( bool b )
+        { return b ? '1' : '0'; }
+    static char to_char( const sc_dt::sc_bit& b )
+        { return b.to_bool() ? '1' : '0'; }
+    static char to_char( const sc_dt::sc_logic& l )
+        { return "01zx"[l.value()]; }
+
+    const T& object;
+    T        old_value;
+};
+
+/*****************************************************************************/
+
+// integers of the C++ types, with a given width
+
+template <class T>
+class fst_integer_trace : public fst_trace
+{
+public:
+    fst_integer_trace( const T& object_, const std::string& name_,
+                       int width_ )
+      : fst_trace( name_ ), object( object_ ), old_value( object_ )
+    {
+        bit_width = width_;
+    }
+
+    bool changed()
+        { return object != old_value; }
+
+    void write( char* dst )
+    {
+        old_value = object;
+        bool fits = true;
+        if( std::numeric_limits<T>::is_signed ) {
+            sc_dt::int64 value = static_cast<sc_dt::int64>( object );
+            if( bit_width < 64 ) {
+                value >>= bit_width - 1;
+                fits = ( value == 0 || value == -1 );
+            }
+        } else {
+            sc_dt::uint64 value = static_cast<sc_dt::uint64>( object );
+            if( bit_width < 64 )
+                fits = ( ( value >> bit_width ) == 0 );
+        }
+        write_bits( dst, bit_width, static_cast<sc_dt::uint64>( object ),
+                    fits );
+    }
+
+protected:
+    const T& object;
+    T        old_value;
+};
+
+/*****************************************************************************/
+
+// sc_int_base and sc_uint_base
+
+template <class T>
+class fst_int_base_trace : public fst_trace
+{
+public:
+    fst_int_base_trace( const T& object_, const std::string& name_ )
+      : fst_trace( name_ ), object( object_ ), old_value( object_.length() )
+    {
+        old_value = object;
+    }
+
+    bool changed()
+        { return object != old_value; }
+
+    void write( char* dst )
+    {
+        old_value = object;
+        write_bits( dst, bit_width,
+                    static_cast<sc_dt::uint64>( object.value() ), true );
+    }
+
+    void set_width()
+        { bit_width = object.length(); }
+
+protected:
+    const T& object;
+    T        old_value;
+};
+
+/*****************************************************************************/
+
+// sc_signed and sc_unsigned
+
+template <class T>
+class fst_digits_trace : public fst_trace
+{
+public:
+    fst_digits_trace( const T& object_, const std::string& name_ )
+      : fst_trace( name_ ), object( object_ ), old_value( object_.length() )
+    {
+        old_value = object;
+    }
+
+    bool changed()
+        { return object != old_value; }
+
+    void write( char* dst )
+    {
+        old_value = object;
+        const sc_dt::sc_digit* digits = object.get_digits();
+        for( int bitindex = bit_width - 1; bitindex >= 0; --bitindex ) {
+            *dst++ = "01"[( digits[bitindex / BITS_PER_DIGIT]
+                            >> ( bitindex % BITS_PER_DIGIT ) ) & 1];
+        }
+    }
+
+    void set_width()
+        { bit_width = object.length(); }
+
+protected:
+    const T& object;
+    T        old_value;
+};
+
+/*****************************************************************************/
+
+// sc_bv_base and sc_lv_base
+
+template <class T>
+class fst_T_trace : public fst_trace
+{
+public:
+    fst_T_trace( const T& object_, const std::string& name_ )
+      : fst_trace( name_ ), object( object_ ), old_value( object_ )
+    {}
+
+    bool changed()
+        { return !( object == old_value ); }
+
+    void write( char* dst )
+    {
+        old_value = object;
+        for( int bitindex = bit_width - 1; bitindex >= 0; --bitindex )
+            *dst++ = "01zx"[object.get_bit( bitindex )];
+    }
+
+    void set_width()
+        { bit_width = object.length(); }
+
+protected:
+    const T& object;
+    T        old_value;
+};
+
+/*****************************************************************************/
+
+// float, double, sc_fxval and sc_fxval_fast
+
+template <class T>
+class fst_real_trace : public fst_trace
+{
+public:
+    fst_real_trace( const T& object_, const std::string& name_ )
+      : fst_trace( name_ ), object( object_ ), old_value( object_ )
+    {
+        var_type = fst_vt_vcd_real;
+        bit_width = 1;
+    }
+
+    bool changed()
+        { return object != old_value; }
+
+    void write( char* dst )
+    {
+        old_value = object;
+        write_real( dst, to_double( object ) );
+    }
+
+protected:
+    static double to_double( double d )
+        { return d; }
+    static double to_double( const sc_dt::sc_fxval& v )
+        { return v.to_double(); }
+    static double to_double( const sc_dt::sc_fxval_fast& v )
+        { return v.to_double(); }
+
+    const T& object;
+    T        old_value;
+};
+
+/*****************************************************************************/
+
+class fst_sc_fxnum_trace : public fst_trace
+{
+public:
+    fst_sc_fxnum_trace( const sc_dt::sc_fxnum& object_,
+                        const std::string& name_ )
+      : fst_trace( name_ ), object( object_ )
+      , old_value( object_.m_params.type_params(),
+                   object_.m_params.enc(),
+                   object_.m_params.cast_switch(),
+                   0 )
+    {
+        old_value = object;
+    }
+
+    bool changed()
+        { return object != old_value; }
+
+    void write( char* dst )
+    {
+        old_value = object;
+        for( int bitindex = object.wl() - 1; bitindex >= 0; --bitindex )
+            *dst++ = "01"[object[bitindex]];
+    }
+
+    void set_width()
+        { bit_width = object.wl(); }
+
+protected:
+    const sc_dt::sc_fxnum& object;
+    sc_dt::sc_fxnum        old_value;
+};
+
+/*****************************************************************************/
+
+class fst_sc_fxnum_fast_trace : public fst_trace
+{
+public:
+    fst_sc_fxnum_fast_trace( const sc_dt::sc_fxnum_fast& object_,
+                             const std::string& name_ )
+      : fst_trace( name_ ), object( object_ )
+      , old_value( object_.m_params.type_params(),
+                   object_.m_params.enc(),
+                   object_.m_params.cast_switch(),
+                   0 )
+    {
+        old_value = object;
+    }
+
+    bool changed()
+        { return object != old_value; }
+
+    void write( char* dst )
+    {
+        old_value = object;
+        for( int bitindex = object.wl() - 1; bitindex >= 0; --bitindex )
+            *dst++ = "01"[object[bitindex]];
+    }
+
+    void set_width()
+        { bit_width = object.wl(); }
+
+protected:
+    const sc_dt::sc_fxnum_fast& object;
+    sc_dt::sc_fxnum_fast        old_value;
+};
+
+
+/*****************************************************************************
+ FST hierarchy
+ *****************************************************************************/
+
+struct fst_scope
+{
+    void add_trace( fst_trace* trace );
+    void write( std::vector<unsigned char>& buf, unsigned& scopes,
+                const std::string& scope_name = "SystemC" ) const;
+
+    ~fst_scope();
+
+private:
+    std::vector<std::pair<std::string, fst_trace*> > m_traces;
+    std::map<std::string, fst_scope*>                m_scopes;
+};
+
+fst_scope::~fst_scope()
+{
+    for( std::map<std::string, fst_scope*>::iterator it = m_scopes.begin();
+         it != m_scopes.end(); ++it )
+        delete it->second;
+}
+
+void
+fst_scope::add_trace( fst_trace* trace )
+{
+    static bool warned = false;
+    std::string name = trace->name;
+
+    // Remove name problems associated with [] in the names, as in VCD
+    bool braces_removed = false;
+    for( std::size_t i = 0; i < name.length(); ++i ) {
+        if( name[i] == '[' ) {
+            name[i] = '(';
+            braces_removed = true;
+        } else if( name[i] == ']' ) {
+            name[i] = ')';
+            braces_removed = true;
+        }
+    }
+    if( braces_removed && !warned ) {
+        std::stringstream ss;
+        ss << trace->name << ":\n"
+            "\tTraced objects found with name containing [], which may be\n"
+            "\tinterpreted by the waveform viewer in unexpected ways.\n"
+            "\tSo the [] is automatically replaced by ().";
+        SC_REPORT_WARNING( SC_ID_TRACING_OBJECT_NAME_FILTERED_
+                         , ss.str().c_str() );
+        warned = true;
+    }
+
+    fst_scope* scope = this;
+    std::string::size_type begin = 0, end;
+    while( ( end = name.find( '.', begin ) ) != std::string::npos ) {
+        fst_scope*& sub = scope->m_scopes[name.substr( begin, end - begin )];
+        if( !sub )
+            sub = new fst_scope;
+        scope = sub;
+        begin = end + 1;
+    }
+    scope->m_traces.push_back( std::make_pair( name.substr( begin ), trace ) );
+}
+
+void
+fst_scope::write( std::vector<unsigned char>& buf, unsigned& scopes,
+                  const std::string& scope_name ) const
+{
+    buf.push_back( fst_st_vcd_scope );
+    buf.push_back( fst_st_vcd_module );
+    put_string( buf, scope_name );
+    put_string( buf, "" ); // component
+    ++scopes;
+
+    for( std::size_t i = 0; i < m_traces.size(); ++i ) {
+        const fst_trace* t = m_traces[i].second;
+        buf.push_back( t->var_type );
+        buf.push_back( fst_vd_implicit );
+        put_string( buf, m_traces[i].first );
+        put_varint( buf, t->size() );
+        put_varint( buf, 0 ); // no alias
+    }
+
+    for( std::map<std::string, fst_scope*>::const_iterator
+           it = m_scopes.begin(); it != m_scopes.end(); ++it )
+        it->second->write( buf, scopes, it->first );
+
+    buf.push_back( fst_st_vcd_upscope );
+}
+
+
+/*****************************************************************************
+ FST value blocks
+ *****************************************************************************/
+
+// A full block is compressed and written by a host thread, while the
+// simulation continues with the next block.
+
+struct fst_block
+{
+    fst_block() : begin_time(), end_time(), frame(), time_table()
+                , time_count(), changes()
+    {}
+
+    void write( sc_trace_buffer* out ) const;
+
+    sc_dt::uint64                           begin_time;
+    sc_dt::uint64                           end_time;
+    std::vector<char>                       frame;      // initial values.
+    std::vector<unsigned char>              time_table; // time steps.
+    unsigned                                time_count;
+    std::vector<std::vector<unsigned char> > changes;   // of each variable.
+};
+
+void
+fst_block::write( sc_trace_buffer* out ) const
+{
+    std::vector<unsigned char> buf;
+    sc_dt::uint64 maxhandle = changes.size();
+
+    buf.push_back( fst_bl_vcdata );
+    put_uint64( buf, 0 );            // length, set below
+    put_uint64( buf, begin_time );
+    put_uint64( buf, end_time );
+    put_uint64( buf, 0 );            // memory for the changes, set below
+
+    // values at the start of the block
+    put_varint( buf, frame.size() );
+    std::vector<unsigned char> packed;
+    if( !frame.empty()
+        && put_compressed( packed, &frame[0], frame.size(),
+                               fst_compress_level ) ) {
+        put_varint( buf, packed.size() );
+        put_varint( buf, maxhandle );
+        put_bytes( buf, &packed[0], packed.size() );
+    } else {
+        put_varint( buf, frame.size() );
+        put_varint( buf, maxhandle );
+        if( !frame.empty() )
+            put_bytes( buf, &frame[0], frame.size() );
+    }
+
+    // value changes of each variable, the index refers to them relative
+    // to the position of the pack type
+    put_varint( buf, maxhandle );
+    std::size_t vc_start = buf.size();
+    buf.push_back( 'Z' );
+
+    std::vector<sc_dt::uint64> positions( changes.size() );
+    sc_dt::uint64 memory = 0;
+    for( std::size_t i = 0; i < changes.size(); ++i ) {
+        const std::vector<unsigned char>& data = changes[i];
+        if( data.empty() )
+            continue;
+
+        positions[i] = buf.size() - vc_start;
+        memory += data.size();
+        packed.clear();
+        if( data.size() >= fst_compress_min
+            && put_compressed( packed, &data[0], data.size(),
+                               fst_compress_level ) ) {
+            put_varint( buf, data.size() );
+            put_bytes( buf, &packed[0], packed.size() );
+        } else {
+            put_varint( buf, 0 );
+            put_bytes( buf, &data[0], data.size() );
+        }
+    }
+
+    // index: position deltas of the variables with changes, and counts
+    // of the variables without
+    std::size_t index_start = buf.size();
+    sc_dt::uint64 previous = 0;
+    sc_dt::uint64 unchanged = 0;
+    for( std::size_t i = 0; i < changes.size(); ++i ) {
+        if( !positions[i] ) {
+            ++unchanged;
+            continue;
+        }
+        if( unchanged ) {
+            put_varint( buf, unchanged << 1 );
+            unchanged = 0;
+        }
+        put_varint( buf, ( ( positions[i] - previous ) << 1 ) | 1 );
+        previous = positions[i];
+    }
+    if( unchanged )
+        put_varint( buf, unchanged << 1 );
+    put_uint64( buf, buf.size() - index_start );
+
+    // time steps
+    std::size_t time_size = buf.size();
+    if( !put_compressed( buf, &time_table[0], time_table.size(), 9 ) )
+        put_bytes( buf, &time_table[0], time_table.size() );
+    time_size = buf.size() - time_size;
+    put_uint64( buf, time_table.size() );
+    put_uint64( buf, time_size );
+    put_uint64( buf, time_count );
+
+    set_uint64( &buf[1], buf.size() - 1 );
+    set_uint64( &buf[25], memory );
+
+    out->put( reinterpret_cast<const char*>( &buf[0] ), buf.size() );
+}
+
+
+/*****************************************************************************
+           fst_trace_file functions
+ *****************************************************************************/
+
+fst_trace_file::fst_trace_file(const char *name)
+  : sc_trace_file_base( name, "fst" )
+  , traces()
+  , vars()
+  , comments()
+  , values()
+  , block(new fst_block())
+  , pending(new fst_block())
+  , block_bytes(0)
+  , start_time(0)
+  , last_time(0)
+  , blocks(0)
+  , scopes(0)
+  , out(new sc_trace_buffer())
+  , writer()
+{}
+
+void
+fst_trace_file::open_fp()
+{
+    sc_assert( !fp && filename() );
+    fp = std::fopen( filename(), "wb" );
+    if( !fp ) {
+        SC_REPORT_ERROR( SC_ID_TRACING_FOPEN_FAILED_, filename() );
+        sc_abort(); // can't recover from here
+    }
+    out->open( fp );
+}
+
+void
+fst_trace_file::do_initialize()
+{
+    // assign the handles and the positions of the values, the ignored
+    // traces keep their place, as the trace file base refers to it
+    for( std::size_t i = 0; i < traces.size(); ++i ) {
+        fst_trace* t = traces[i];
+        t->set_width();
+        if( t->bit_width <= 0 ) {
+            std::stringstream ss;
+            ss << "'" << t->name << "' has 0 bits";
+            SC_REPORT_ERROR( SC_ID_TRACING_OBJECT_IGNORED_, ss.str().c_str() );
+            continue;
+        }
+        vars.push_back( t );
+        t->handle = vars.size();
+        t->offset = values.size();
+        values.resize( values.size() + t->size(), 'x' );
+    }
+
+    write_header();
+
+    // the initial values are the changes at the first time step, the
+    // frame of the first block contains them, too
+    start_time = time_in_trace_units();
+    start_block();
+    next_time( start_time );
+    for( std::size_t i = 0; i < vars.size(); ++i ) {
+        fst_trace* t = vars[i];
+        if( t->var_type != fst_vt_vcd_event || t->changed() )
+            record_value( t );
+    }
+    block->frame = values;
+}
+
+void fst_trace_file::trace( sc_trace_file* ) const {
+    SC_REPORT_ERROR( sc_core::SC_ID_INTERNAL_ERROR_
+                   , "invalid call to fst_trace_file::trace(sc_trace_file*)" );
+}
+
+void
+fst_trace_file::add_trace( fst_trace* t, const std::string& name )
+{
+    if( add_trace_check( name ) )
+        traces.push_back( t );
+    else
+        delete t;
+}
+
+// ----------------------------------------------------------------------------
+
+void
+fst_trace_file::trace( const sc_event& object_, const std::string& name_ )
+{
+    add_trace( new fst_sc_event_trace( event_trigger_stamp( object_ ), name_ )
+             , name_ );
+}
+
+void
+fst_trace_file::trace( const sc_time& object_, const std::string& name_ )
+{
+    add_trace( new fst_sc_time_trace( object_, name_ ), name_ );
+}
+
+#define DEFN_TRACE_METHOD(tp, trace_class)                                    \
+void                                                                          \
+fst_trace_file::trace( const tp& object_, const std::string& name_ )          \
+{                                                                             \
+    add_trace( new trace_class<tp>( object_, name_ ), name_ );                \
+}
+
+DEFN_TRACE_METHOD(bool, fst_bit_trace)
+DEFN_TRACE_METHOD(sc_dt::sc_bit, fst_bit_trace)
+DEFN_TRACE_METHOD(sc_dt::sc_logic, fst_bit_trace)
+
+DEFN_TRACE_METHOD(float, fst_real_trace)
+DEFN_TRACE_METHOD(double, fst_real_trace)
+DEFN_TRACE_METHOD(sc_dt::sc_fxval, fst_real_trace)
+DEFN_TRACE_METHOD(sc_dt::sc_fxval_fast, fst_real_trace)
+
+DEFN_TRACE_METHOD(sc_dt::sc_int_base, fst_int_base_trace)
+DEFN_TRACE_METHOD(sc_dt::sc_uint_base, fst_int_base_trace)
+DEFN_TRACE_METHOD(sc_dt::sc_signed, fst_digits_trace)
+DEFN_TRACE_METHOD(sc_dt::sc_unsigned, fst_digits_trace)
+
+DEFN_TRACE_METHOD(sc_dt::sc_bv_base, fst_T_trace)
+DEFN_TRACE_METHOD(sc_dt::sc_lv_base, fst_T_trace)
+
+#undef DEFN_TRACE_METHOD
+
+void
+fst_trace_file::trace( const sc_dt::sc_fxnum& object_,
+                       const std::string& name_ )
+{
+    add_trace( new fst_sc_fxnum_trace( object_, name_ ), name_ );
+}
+
+void
+fst_trace_file::trace( const sc_dt::sc_fxnum_fast& object_,
+                       const std::string& name_ )
+{
+    add_trace( new fst_sc_fxnum_fast_trace( object_, name_ ), name_ );
+}
+
+#define DEFN_TRACE_METHOD_WIDTH(tp)                                           \
+void                                                                          \
+fst_trace_file::trace( const tp&          object_,                            \
+                       const std::string& name_,                              \
+                       int                width_ )                            \
+{                                                                             \
+    add_trace( new fst_integer_trace<tp>( object_, name_, width_ ), name_ );  \
+}
+
+DEFN_TRACE_METHOD_WIDTH(char)
+DEFN_TRACE_METHOD_WIDTH(short)
+DEFN_TRACE_METHOD_WIDTH(int)
+DEFN_TRACE_METHOD_WIDTH(long)
+DEFN_TRACE_METHOD_WIDTH(unsigned char)
+DEFN_TRACE_METHOD_WIDTH(unsigned short)
+DEFN_TRACE_METHOD_WIDTH(unsigned int)
+DEFN_TRACE_METHOD_WIDTH(unsigned long)
+DEFN_TRACE_METHOD_WIDTH(sc_dt::int64)
+DEFN_TRACE_METHOD_WIDTH(sc_dt::uint64)
+
+#undef DEFN_TRACE_METHOD_WIDTH
+
+void
+fst_trace_file::trace( const unsigned&    object_,
+                       const std::string& name_,
+                       const char**       enum_literals_ )
+{
+    // number of bits required to represent the index of the literals
+    unsigned nliterals = 0;
+    while( enum_literals_[nliterals] )
+        ++nliterals;
+    int width = 0;
+    for( unsigned maxindex = nliterals - 1; maxindex != 0; maxindex >>= 1 )
+        ++width;
+
+    add_trace( new fst_integer_trace<unsigned>( object_, name_, width )
+             , name_ );
+}
+
+
+void
+fst_trace_file::write_comment( const std::string& comment )
+{
+    comments.push_back( comment );
+}
+
+sc_dt::uint64
+fst_trace_file::time_in_trace_units() const
+{
+    unit_type now_units_high, now_units_low;
+    timestamp_in_trace_units( now_units_high, now_units_low );
+    if( has_low_units() ) {
+        for( int i = low_units_len(); i > 0; --i )
+            now_units_high *= 10;
+    }
+    return now_units_high + now_units_low;
+}
+
+void
+fst_trace_file::cycle( bool this_is_a_delta_cycle )
+{
+    // Trace delta cycles only when enabled
+    if( !delta_cycles() && this_is_a_delta_cycle ) return;
+
+    // Check for initialization
+    if( initialize() )
+        return;
+
+    if( !has_low_units() ) {
+        unit_type now_units_high, now_units_low;
+        timestamp_in_trace_units( now_units_high, now_units_low );
+        if( now_units_low != 0 ) {
+            std::stringstream ss;
+            ss << "\n\tCurrent kernel time is " << sc_time_stamp();
+            ss << "\n\tFST trace time unit is " << fs_unit_to_str(trace_unit_fs);
+            ss << "\n\tUse 'tracefile->set_time_unit(double, sc_time_unit);' to increase the time resolution.";
+            SC_REPORT_WARNING( SC_ID_TRACING_VCD_TIME_RESOLUTION_, ss.str().c_str() );
+        }
+    }
+
+    sc_dt::uint64 now = time_in_trace_units();
+
+    if( delta_cycles() ) {
+        if( this_is_a_delta_cycle && sc_delta_count_at_current_time() == 0
+            && now <= last_time && block->time_count > 1 ) {
+            std::stringstream ss;
+            ss <<"\n\tThis can occur when delta cycle tracing is activated."
+               <<"\n\tSome delta cycles at " << sc_time_stamp() << " are not shown in the FST file."
+               <<"\n\tUse 'tracefile->set_time_unit(double, sc_time_unit);' to increase the time resolution.";
+            SC_REPORT_WARNING( SC_ID_TRACING_REVERSED_TIME_, ss.str().c_str() );
+            return;
+        }
+
+        // Value updates can't happen during timed notification
+        if( !this_is_a_delta_cycle )
+            return;
+    }
+
+    // only the traces of updated channels and the polled ones
+    bool time_recorded = false;
+    const std::vector<std::size_t>& l_check = traces_to_check();
+    for( std::size_t i = 0; i < l_check.size(); ++i ) {
+        fst_trace* t = traces[l_check[i]];
+        if( t->handle && t->changed() ) {
+            if( !time_recorded ) {
+                next_time( now );
+                time_recorded = true;
+            }
+            record_value( t );
+        }
+    }
+}
+
+void
+fst_trace_file::next_time( sc_dt::uint64 now )
+{
+    // values of the same or an earlier time step are added to the latest
+    if( block->time_count && now <= last_time )
+        return;
+
+    if( block_bytes >= fst_block_size
+        || block->time_count >= fst_block_time_steps ) {
+        flush_block();
+        start_block();
+    }
+
+    // the first time step of a block is absolute
+    if( !block->time_count ) {
+        block->begin_time = now;
+        put_varint( block->time_table, now );
+    } else {
+        put_varint( block->time_table, now - last_time );
+    }
+    block_bytes += 2;
+    ++block->time_count;
+    last_time = now;
+}
+
+void
+fst_trace_file::record_value( fst_trace* t )
+{
+    char* value = &values[t->offset];
+    t->write( value );
+
+    unsigned index = block->time_count - 1;
+    sc_dt::uint64 delta = index - t->last_index;
+    t->last_index = index;
+
+    std::vector<unsigned char>& buf = t->changes;
+    std::size_t size = buf.size();
+
+    if( t->is_real() ) {
+        put_varint( buf, ( delta << 1 ) | 1 );
+        put_bytes( buf, value, sizeof( double ) );
+    } else if( t->bit_width == 1 ) {
+        if( value[0] == '0' || value[0] == '1' ) {
+            put_varint( buf, ( delta << 2 ) | ( ( value[0] & 1 ) << 1 ) );
+        } else {
+            unsigned rcv = 0;
+            while( rcv < 7 && fst_rcv_str[rcv] != value[0] )
+                ++rcv;
+            put_varint( buf, ( delta << 4 ) | ( rcv << 1 ) | 1 );
+        }
+    } else {
+        int width = t->bit_width;
+        put_varint( buf, delta << 1 );
+        std::size_t pos = buf.size();
+        buf.resize( pos + ( width + 7 ) / 8 );
+        if( !pack_bits( &buf[pos], value, width ) ) {
+            // not only '0' and '1', the characters follow unpacked
+            buf.resize( size );
+            put_varint( buf, ( delta << 1 ) | 1 );
+            put_bytes( buf, value, width );
+        }
+    }
+    block_bytes += buf.size() - size;
+}
+
+void
+fst_trace_file::start_block()
+{
+    block->frame = values;
+    block->time_table.clear();
+    block->time_count = 0;
+    block_bytes = 0;
+    for( std::size_t i = 0; i < vars.size(); ++i )
+        vars[i]->last_index = 0;
+}
+
+// Hand the current block to the writer thread, after the previous one is
+// written. The buffers of the changes are exchanged with the ones of the
+// previous block, so they keep their capacity.
+
+void
+fst_trace_file::flush_block()
+{
+    if( writer.joinable() )
+        writer.join();
+
+    std::swap( block, pending );
+    pending->end_time = last_time;
+    pending->changes.resize( vars.size() );
+    for( std::size_t i = 0; i < vars.size(); ++i ) {
+        pending->changes[i].swap( vars[i]->changes );
+        vars[i]->changes.clear();
+    }
+    writer = std::thread( &fst_block::write, pending, out );
+    ++blocks;
+}
+
+void
+fst_trace_file::write_geometry()
+{
+    std::vector<unsigned char> geometry;
+    for( std::size_t i = 0; i < vars.size(); ++i )
+        put_varint( geometry, vars[i]->is_real() ? 0 : vars[i]->size() );
+
+    std::vector<unsigned char> buf;
+    buf.push_back( fst_bl_geom );
+    put_uint64( buf, 0 );            // length, set below
+    put_uint64( buf, geometry.size() );
+    put_uint64( buf, vars.size() );
+    if( geometry.empty()
+        || !put_compressed( buf, &geometry[0], geometry.size(), 9 ) )
+        put_bytes( buf, geometry.empty() ? 0 : &geometry[0], geometry.size() );
+    set_uint64( &buf[1], buf.size() - 1 );
+
+    out->put( reinterpret_cast<const char*>( &buf[0] ), buf.size() );
+}
+
+void
+fst_trace_file::write_hierarchy()
+{
+    std::vector<unsigned char> hierarchy;
+
+    // the readers limit the names to 512 characters
+    for( std::size_t i = 0; i < comments.size(); ++i ) {
+        hierarchy.push_back( fst_st_gen_attrbegin );
+        hierarchy.push_back( fst_at_misc );
+        hierarchy.push_back( fst_mt_comment );
+        put_string( hierarchy, comments[i].substr( 0, 511 ) );
+        put_varint( hierarchy, 0 );
+    }
+
+    fst_scope top_scope;
+    for( std::size_t i = 0; i < vars.size(); ++i )
+        top_scope.add_trace( vars[i] );
+    top_scope.write( hierarchy, scopes );
+
+    std::vector<unsigned char> buf;
+    buf.push_back( fst_bl_hier );
+    put_uint64( buf, 0 );            // length, set below
+    put_uint64( buf, hierarchy.size() );
+    put_gzip( buf, hierarchy );
+    set_uint64( &buf[1], buf.size() - 1 );
+
+    out->put( reinterpret_cast<const char*>( &buf[0] ), buf.size() );
+}
+
+// The times and the counts are written as zero, and completed, when the
+// file is closed.
+
+void
+fst_trace_file::write_header()
+{
+    std::vector<unsigned char> buf;
+    buf.push_back( fst_bl_hdr );
+    put_uint64( buf, fst_hdr_size );
+    put_uint64( buf, 0 );                    // start time
+    put_uint64( buf, 0 );                    // end time
+    put_bytes( buf, &fst_double_endtest, sizeof( double ) );
+    put_uint64( buf, fst_block_size );       // memory used by the writer
+    put_uint64( buf, 0 );                    // number of scopes
+    put_uint64( buf, 0 );                    // number of variables
+    put_uint64( buf, 0 );                    // maximum handle
+    put_uint64( buf, 0 );                    // number of value blocks
+
+    // timescale as power of ten
+    int exponent = -15;
+    for( unit_type unit = trace_unit_fs; unit >= 10; unit /= 10 )
+        ++exponent;
+    buf.push_back( static_cast<unsigned char>( exponent ) );
+
+    std::string version = std::string( sc_version() )
+                            .substr( 0, fst_hdr_version_size - 1 );
+    std::time_t now = std::time( 0 );
+    std::string date = std::string( std::asctime( std::localtime( &now ) ) )
+                         .substr( 0, fst_hdr_date_size - 1 );
+    version.resize( fst_hdr_version_size );
+    date.resize( fst_hdr_date_size );
+    put_bytes( buf, version.data(), version.size() );
+    put_bytes( buf, date.data(), date.size() );
+
+    buf.push_back( 0 );                      // file type: Verilog
+    put_uint64( buf, 0 );                    // time zero
+    sc_assert( buf.size() == fst_hdr_size + 1 );
+
+    out->put( reinterpret_cast<const char*>( &buf[0] ), buf.size() );
+}
+
+fst_trace_file::~fst_trace_file()
+{
+    if( is_initialized() ) {
+        // end of the simulation as the last time step
+        sc_dt::uint64 now = time_in_trace_units();
+        if( now > last_time )
+            next_time( now );
+
+        flush_block();
+        writer.join();
+        write_geometry();
+        write_hierarchy();
+        out->close();
+
+        std::vector<unsigned char> buf;
+        put_uint64( buf, start_time );
+        put_uint64( buf, last_time );
+        std::fseek( fp, fst_hdr_offs_start_time, SEEK_SET );
+        std::fwrite( &buf[0], 1, buf.size(), fp );
+
+        buf.clear();
+        put_uint64( buf, scopes );
+        put_uint64( buf, vars.size() );
+        put_uint64( buf, vars.size() );
+        put_uint64( buf, blocks );
+        std::fseek( fp, fst_hdr_offs_num_scopes, SEEK_SET );
+        std::fwrite( &buf[0], 1, buf.size(), fp );
+    }
+    out->close();
+    delete out;
+
+    delete block;
+    delete pending;
+    for( std::size_t i = 0; i < traces.size(); ++i )
+        delete traces[i];
+}
+
+// ----------------------------------------------------------------------------
+
+SC_API sc_trace_file*
+sc_create_fst_trace_file(const char * name)
+{
+    sc_trace_file * tf = new fst_trace_file(name);
+    return tf;
+}
+
+SC_API void
+sc_close_fst_trace_file( sc_trace_file* tf )
+{
+    fst_trace_file* fst_tf = static_cast<fst_trace_file*>(tf);
+    delete fst_tf;
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,234 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_fst_trace.h - Implementation of FST tracing.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_FST_TRACE_H_INCLUDED_
+#define SC_FST_TRACE_H_INCLUDED_
+
+#include "sysc/tracing/sc_trace_file_base.h"
+
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::vector
+#endif
+
+namespace sc_core {
+
+class sc_trace_buffer;
+class fst_trace;  // defined in sc_fst_trace.cpp
+struct fst_block; // defined in sc_fst_trace.cpp
+
+// ----------------------------------------------------------------------------
+//  CLASS : fst_trace_file
+//
+//  Trace file in the FST format of GTKWave. The value changes are kept
+//  per variable in memory and written in large blocks, in which the
+//  changes of each variable are compressed on their own, by a host
+//  thread. The blocks are followed by the geometry and the hierarchy of
+//  the variables, the header at the beginning of the file is completed
+//  when it is closed, so the file is only complete after
+//  sc_close_fst_trace_file().
+// ----------------------------------------------------------------------------
+
+class fst_trace_file
+  : public sc_trace_file_base
+{
+public:
+
+    // Create an FST trace file.
+    // `Name' forms the base of the name to which `.fst' is added.
+    fst_trace_file(const char *name);
+
+    // Flush results and close file.
+    ~fst_trace_file();
+
+protected:
+
+    // These are all virtual functions in sc_trace_file and
+    // they need to be defined here.
+
+    // Trace sc_time, sc_event
+    virtual void trace(const sc_time& object, const std::string& name);
+    virtual void trace(const sc_event& object, const std::string& name);
+
+    // Trace a boolean object (single bit)
+    void trace(const bool& object, const std::string& name);
+
+    // Trace a sc_bit object (single bit)
+    void trace(const sc_dt::sc_bit& object, const std::string& name);
+
+    // Trace a sc_logic object (single bit)
+    void trace(const sc_dt::sc_logic& object, const std::string& name);
+
+    // Trace an unsigned char with the given width
+    void trace(const unsigned char& object, const std::string& name,
+        int width);
+
+    // Trace an unsigned short with the given width
+    void trace(const unsigned short& object, const std::string& name,
+        int width);
+
+    // Trace an unsigned int with the given width
+    void trace(const unsigned int& object, const std::string& name,
+        int width);
+
+    // Trace an unsigned long with the given width
+    void trace(const unsigned long& object, const std::string& name,
+        int width);
+
+    // Trace a signed char with the given width
+    void trace(const char& object, const std::string& name, int width);
+
+    // Trace a signed short with the given width
+    void trace(const short& object, const std::string& name, int width);
+
+    // Trace a signed int with the given width
+    void trace(const int& object, const std::string& name, int width);
+
+    // Trace a signed long with the given width
+    void trace(const long& object, const std::string& name, int width);
+
+    // Trace an int64 with a given width
+    void trace(const sc_dt::int64& object, const std::string& name,
+        int width);
+
+    // Trace a uint64 with a given width
+    void trace(const sc_dt::uint64& object, const std::string& name,
+        int width);
+
+    // Trace a float
+    void trace(const float& object, const std::string& name);
+
+    // Trace a double
+    void trace(const double& object, const std::string& name);
+
+    // Trace sc_dt::sc_uint_base
+    void trace(const sc_dt::sc_uint_base& object, const std::string& name);
+
+    // Trace sc_dt::sc_int_base
+    void trace(const sc_dt::sc_int_base& object, const std::string& name);
+
+    // Trace sc_dt::sc_unsigned
+    void trace(const sc_dt::sc_unsigned& object, const std::string& name);
+
+    // Trace sc_dt::sc_signed
+    void trace(const sc_dt::sc_signed& object, const std::string& name);
+
+    // Trace sc_dt::sc_fxval
+    void trace(const sc_dt::sc_fxval& object, const std::string& name);
+
+    // Trace sc_dt::sc_fxval_fast
+    void trace(const sc_dt::sc_fxval_fast& object, const std::string& name);
+
+    // Trace sc_dt::sc_fxnum
+    void trace(const sc_dt::sc_fxnum& object, const std::string& name);
+
+    // Trace sc_dt::sc_fxnum_fast
+    void trace(const sc_dt::sc_fxnum_fast& object, const std::string& name);
+
+    // Trace sc_dt::sc_bv_base (sc_dt::sc_bv)
+    void trace(const sc_dt::sc_bv_base& object, const std::string& name);
+
+    // Trace sc_dt::sc_lv_base (sc_dt::sc_lv)
+    void trace(const sc_dt::sc_lv_base& object, const std::string& name);
+
+    // Trace an enumerated object, as the index of the literal
+    void trace(const unsigned& object, const std::string& name,
+        const char** enum_literals);
+
+    // Output a comment to the trace file, as a comment attribute in the
+    // hierarchy
+    void write_comment(const std::string& comment);
+
+    // Write trace info for cycle.
+    void cycle(bool delta_cycle);
+
+private:
+
+    // avoid hidden overload warnings
+    virtual void trace( sc_trace_file* ) const;
+
+    void add_trace(fst_trace* t, const std::string& name);
+
+    // Initialize the FST tracing
+    virtual void do_initialize();
+
+    // open the file in binary mode
+    virtual void open_fp();
+
+    // current time in trace units
+    sc_dt::uint64 time_in_trace_units() const;
+
+    // start a new time step, and a new block if the block is full
+    void next_time(sc_dt::uint64 now);
+
+    // append the current value of a variable to its changes in the block
+    void record_value(fst_trace* t);
+
+    void start_block();
+    void flush_block();
+    void write_geometry();
+    void write_hierarchy();
+    void write_header();
+
+    std::vector<fst_trace*>    traces;     // traced variables.
+    std::vector<fst_trace*>    vars;       // traces with a handle.
+    std::vector<std::string>   comments;   // for the hierarchy.
+
+    std::vector<char>          values;     // current values of all variables.
+    fst_block*                 block;      // current block.
+    fst_block*                 pending;    // block of the writer thread.
+    std::size_t                block_bytes;// size of the changes in block.
+
+    sc_dt::uint64              start_time; // first time step of the file.
+    sc_dt::uint64              last_time;  // latest time step.
+    sc_dt::uint64              blocks;     // number of blocks written.
+    unsigned                   scopes;     // number of scopes written.
+
+    sc_trace_buffer*           out;        // buffered output of the file.
+    std::thread                writer;     // compresses the pending block.
+};
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_FST_TRACE_H_INCLUDED_
+// Taf!
@@ -50,9 +50,10 @@
 #include <cstdio>
 
 #include "sysc/tracing/sc_trace.h"
+#include "sysc/tracing/sc_trace_file_base.h"
 #include "sysc/tracing/sc_tracing_ids.h"
 
-#include "sysc/communication/sc_signal_ifs.h"
+#include "sysc/communication/sc_signal.h"
 #include "sysc/kernel/sc_event.h"
 #include "sysc/utils/sc_report.h"
 #include "sysc/utils/sc_utils_ids.h"
@@ -92,6 +93,23 @@ sc_trace_file::event_trigger_stamp(const sc_event& ev) const
     return ev.m_trigger_stamp;
 }
 
+SC_API std::size_t
+sc_trace_channel_first( sc_trace_file* tf )
+{
+    const sc_trace_file_base* file = dynamic_cast<sc_trace_file_base*>( tf );
+    return file ? file->trace_count() : 0;
+}
+
+SC_API void
+sc_trace_channel_updates( sc_trace_file* tf, const sc_interface& object,
+                          std::size_t first )
+{
+    const sc_signal_channel* channel =
+      dynamic_cast<const sc_signal_channel*>( &object );
+    if( tf && channel )
+        channel->add_trace_notifier( tf, first );
+}
+
 SC_API void
 sc_trace( sc_trace_file* tf,
 	  const sc_signal_in_if<char>& object,
@@ -99,7 +117,9 @@ sc_trace( sc_trace_file* tf,
 	  int width )
 {
     if( tf ) {
+	std::size_t first = sc_trace_channel_first( tf );
 	tf->trace( object.read(), name, width );
+	sc_trace_channel_updates( tf, object, first );
     }
 }
 
@@ -110,7 +130,9 @@ sc_trace( sc_trace_file* tf,
 	  int width )
 {
     if( tf ) {
+	std::size_t first = sc_trace_channel_first( tf );
 	tf->trace( object.read(), name, width );
+	sc_trace_channel_updates( tf, object, first );
     }
 }
 
@@ -121,7 +143,9 @@ sc_trace( sc_trace_file* tf,
 	  int width )
 {
     if( tf ) {
+	std::size_t first = sc_trace_channel_first( tf );
 	tf->trace( object.read(), name, width );
+	sc_trace_channel_updates( tf, object, first );
     }
 }
 
@@ -132,7 +156,9 @@ sc_trace( sc_trace_file* tf,
 	  int width )
 {
     if( tf ) {
+	std::size_t first = sc_trace_channel_first( tf );
 	tf->trace( object.read(), name, width );
+	sc_trace_channel_updates( tf, object, first );
     }
 }
 
@@ -74,6 +74,7 @@ namespace sc_dt
 namespace sc_core {
 
 class sc_event;
+class sc_interface;
 class sc_time;
 
 template <class T> class sc_signal_in_if;
@@ -259,6 +260,18 @@ DECL_TRACE_FUNC_A( sc_dt::sc_fxnum_fast )
 #undef DECL_TRACE_FUNC_B
 
 
+// The values of the traces added to `tf' since sc_trace_channel_first()
+// returned `first' are read from the channel behind `object'. Primitive
+// channels report their updates, so these traces are only checked for a
+// change after an update (implementation-defined).
+
+SC_API std::size_t
+sc_trace_channel_first( sc_trace_file* tf );
+
+SC_API void
+sc_trace_channel_updates( sc_trace_file* tf, const sc_interface& object,
+                          std::size_t first );
+
 template <class T> 
 inline
 void
@@ -266,7 +279,9 @@ sc_trace( sc_trace_file* tf,
 	  const sc_signal_in_if<T>& object,
 	  const std::string& name )
 {
+    std::size_t first = sc_trace_channel_first( tf );
     sc_trace( tf, object.read(), name );
+    sc_trace_channel_updates( tf, object, first );
 }
 
 template< class T >
@@ -276,7 +291,9 @@ sc_trace( sc_trace_file* tf,
 	  const sc_signal_in_if<T>& object,
 	  const char* name )
 {
+    std::size_t first = sc_trace_channel_first( tf );
     sc_trace( tf, object.read(), name );
+    sc_trace_channel_updates( tf, object, first );
 }
 
 
@@ -362,6 +379,12 @@ extern SC_API void sc_close_vcd_trace_file( sc_trace_file* tf );
 extern SC_API sc_trace_file *sc_create_wif_trace_file(const char *name);
 extern SC_API void sc_close_wif_trace_file( sc_trace_file* tf );
 
+
+// ----------------------------------------------------------------------------
+// Create FST file
+extern SC_API sc_trace_file *sc_create_fst_trace_file(const char *name);
+extern SC_API void sc_close_fst_trace_file( sc_trace_file* tf );
+
 } // namespace sc_core
 
 #endif // SC_TRACE_H
@@ -0,0 +1,302 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_trace_buffer.cpp -- Buffered output of trace files.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/tracing/sc_trace_buffer.h"
+#include "sysc/utils/sc_report.h" // sc_assert
+
+#include <algorithm>
+#include <cstdlib>
+
+#if defined(SC_HAVE_ZLIB)
+#  include <zlib.h>
+#  if defined(_WIN32)
+#    include <io.h>
+#    define SC_TRACE_DUP_( fp ) ::_dup( ::_fileno( fp ) )
+#    define SC_TRACE_CLOSE_     ::_close
+#  else
+#    include <unistd.h>
+#    define SC_TRACE_DUP_( fp ) ::dup( ::fileno( fp ) )
+#    define SC_TRACE_CLOSE_     ::close
+#  endif
+#endif
+
+namespace sc_core {
+
+namespace {
+
+// size of the blocks handed to the writer thread
+const std::size_t block_size = 1 << 20;
+
+// number of blocks, the simulation may be ahead of the writer thread
+const std::size_t max_blocks = 4;
+
+// Trace files are often not closed by the models, the stdio buffers of
+// their files are flushed by exit(). The buffers, which are still open at
+// exit(), are closed by an atexit() handler for the same effect. The list
+// is never destroyed, as the order of the static destructors is unknown.
+
+std::mutex&
+open_buffers_mutex()
+{
+    static std::mutex* mutex_p = new std::mutex();
+    return *mutex_p;
+}
+
+std::vector<sc_trace_buffer*>&
+open_buffers()
+{
+    static std::vector<sc_trace_buffer*>* buffers_p =
+      new std::vector<sc_trace_buffer*>();
+    return *buffers_p;
+}
+
+void
+close_open_buffers()
+{
+    std::vector<sc_trace_buffer*> buffers;
+    {
+        std::lock_guard<std::mutex> lock( open_buffers_mutex() );
+        buffers = open_buffers();
+    }
+    for( std::size_t i = 0; i < buffers.size(); ++i )
+        buffers[i]->close();
+}
+
+} // anonymous namespace
+
+
+sc_trace_buffer::sc_trace_buffer()
+  : m_fp( 0 ), m_gz( 0 )
+  , m_begin( 0 ), m_pos( 0 ), m_end( 0 ), m_block( 0 ), m_flushed( 0 )
+  , m_background( false ), m_writer(), m_mutex(), m_cond()
+  , m_full(), m_free(), m_blocks( 0 ), m_stop( false )
+{}
+
+sc_trace_buffer::~sc_trace_buffer()
+{
+    sc_assert( !m_writer.joinable() );
+    delete m_block;
+    for( std::size_t i = 0; i < m_free.size(); ++i )
+        delete m_free[i];
+}
+
+bool
+sc_trace_buffer::open( FILE* fp, bool background, int gzip_level )
+{
+    sc_assert( !m_fp && fp );
+
+    // The gzip stream writes to a duplicate of the file descriptor, which
+    // is closed by gzclose(), while the caller closes the file itself.
+
+    if( gzip_level > 0 ) {
+#if defined(SC_HAVE_ZLIB)
+        char mode[] = "wb0";
+        mode[2] = static_cast<char>( '0' + std::min( gzip_level, 9 ) );
+        int fd = SC_TRACE_DUP_( fp );
+        if( fd < 0 )
+            return false;
+        m_gz = ::gzdopen( fd, mode );
+        if( !m_gz ) {
+            SC_TRACE_CLOSE_( fd );
+            return false;
+        }
+#else
+        return false;
+#endif
+    }
+
+    m_fp = fp;
+    m_background = background;
+    m_stop = false;
+    if( m_background )
+        m_writer = std::thread( &sc_trace_buffer::run_writer, this );
+
+    static bool at_exit_registered = false;
+    std::lock_guard<std::mutex> lock( open_buffers_mutex() );
+    if( !at_exit_registered ) {
+        std::atexit( &close_open_buffers );
+        at_exit_registered = true;
+    }
+    open_buffers().push_back( this );
+    return true;
+}
+
+void
+sc_trace_buffer::close()
+{
+    if( !m_fp )
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock( open_buffers_mutex() );
+        std::vector<sc_trace_buffer*>& buffers = open_buffers();
+        buffers.erase( std::find( buffers.begin(), buffers.end(), this ) );
+    }
+
+    std::size_t n = m_pos - m_begin;
+    if( !m_background ) {
+        if( n )
+            write_block( *m_block, n );
+    } else {
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            if( n ) {
+                full_block full = { m_block, n };
+                m_full.push_back( full );
+                m_block = 0;
+            }
+            m_stop = true;
+        }
+        m_cond.notify_all();
+        m_writer.join();
+    }
+#if defined(SC_HAVE_ZLIB)
+    if( m_gz ) {
+        ::gzclose( static_cast<gzFile>( m_gz ) );
+        m_gz = 0;
+    }
+#endif
+    std::fflush( m_fp );
+
+    m_flushed += n;
+    m_begin = m_pos = m_end = 0;
+    m_fp = 0;
+}
+
+// hand the current block to the writer and continue in a block with room
+// for at least n bytes
+
+void
+sc_trace_buffer::next_block( std::size_t n )
+{
+    std::size_t used = m_pos - m_begin;
+    sc_assert( m_fp || !used );
+    m_flushed += used;
+
+    if( !m_background ) {
+        if( used )
+            write_block( *m_block, used );
+        if( !m_block )
+            m_block = new block_type();
+    } else {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        if( used ) {
+            full_block full = { m_block, used };
+            m_full.push_back( full );
+            m_block = 0;
+            m_cond.notify_all();
+        }
+        if( !m_block ) {
+            while( m_free.empty() && m_blocks >= max_blocks )
+                m_cond.wait( lock );
+            if( !m_free.empty() ) {
+                m_block = m_free.back();
+                m_free.pop_back();
+            } else {
+                m_block = new block_type();
+                ++m_blocks;
+            }
+        }
+    }
+
+    if( m_block->size() < n || m_block->size() < block_size )
+        m_block->resize( std::max( n, block_size ) );
+    m_begin = m_pos = &(*m_block)[0];
+    m_end = m_begin + m_block->size();
+}
+
+void
+sc_trace_buffer::write_block( const block_type& block, std::size_t n )
+{
+#if defined(SC_HAVE_ZLIB)
+    if( m_gz ) {
+        ::gzwrite( static_cast<gzFile>( m_gz ), &block[0],
+                   static_cast<unsigned>( n ) );
+        return;
+    }
+#endif
+    std::fwrite( &block[0], 1, n, m_fp );
+}
+
+void
+sc_trace_buffer::run_writer()
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    for( ;; ) {
+        while( m_full.empty() && !m_stop )
+            m_cond.wait( lock );
+        if( m_full.empty() )
+            break;
+
+        full_block full = m_full.front();
+        m_full.pop_front();
+        lock.unlock();
+        write_block( *full.block, full.size );
+        lock.lock();
+
+        m_free.push_back( full.block );
+        m_cond.notify_all();
+    }
+}
+
+void
+sc_trace_buffer::put_uint( sc_dt::uint64 value, int min_digits )
+{
+    char digits[24];
+    char* p = digits + sizeof( digits );
+    do {
+        *--p = static_cast<char>( '0' + value % 10 );
+        value /= 10;
+    } while( value );
+
+    int n = static_cast<int>( digits + sizeof( digits ) - p );
+    char* dst = reserve( ( n < min_digits ? min_digits : n ) );
+    for( ; n < min_digits; --min_digits )
+        *dst++ = '0';
+    std::memcpy( dst, p, n );
+    commit( dst + n );
+}
+
+void
+sc_trace_buffer::put_real( double value )
+{
+    char* dst = reserve( 32 );
+    int n = std::snprintf( dst, 32, "%.16g", value );
+    commit( dst + n );
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,165 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_trace_buffer.h -- Buffered output of trace files.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_TRACE_BUFFER_H_INCLUDED_
+#define SC_TRACE_BUFFER_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::vector
+#endif
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_buffer
+//
+//  Output buffer of a trace file. The values are formatted directly into
+//  large blocks of memory, full blocks are written to the file by a host
+//  thread in the background, so the simulation only waits for the file,
+//  if the writer falls behind by several blocks.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_trace_buffer
+{
+public:
+
+    sc_trace_buffer();
+
+    // close() must have been called before
+    ~sc_trace_buffer();
+
+    // start writing to the file, background = false writes each full
+    // block immediately in the simulator thread, gzip_level > 0 writes the
+    // file in the gzip format, returns false if that is not possible
+    // (e.g. SystemC has been built without zlib)
+    bool open( FILE* fp, bool background = true, int gzip_level = 0 );
+
+    // write all buffered data to the file and stop the background thread,
+    // the file itself is closed by the caller
+    void close();
+
+    // number of bytes passed to the buffer so far
+    sc_dt::uint64 size() const
+        { return m_flushed + ( m_pos - m_begin ); }
+
+    // room for n bytes, to be filled and then passed to commit()
+    char* reserve( std::size_t n )
+    {
+        if( SC_UNLIKELY_( static_cast<std::size_t>( m_end - m_pos ) < n ) )
+            next_block( n );
+        return m_pos;
+    }
+
+    void commit( char* end )
+        { m_pos = end; }
+
+    void put( char c )
+        { *reserve( 1 ) = c; ++m_pos; }
+
+    void put( const char* s, std::size_t n )
+        { std::memcpy( reserve( n ), s, n ); m_pos += n; }
+
+    void put( const char* s )
+        { put( s, std::strlen( s ) ); }
+
+    void put( const std::string& s )
+        { put( s.data(), s.size() ); }
+
+    // decimal number, at least min_digits digits with leading zeros
+    void put_uint( sc_dt::uint64 value, int min_digits = 1 );
+
+    // real number in the "%.16g" format
+    void put_real( double value );
+
+private:
+
+    void next_block( std::size_t n );
+    void write_block( const std::vector<char>& block, std::size_t n );
+    void run_writer();
+
+    typedef std::vector<char> block_type;
+
+    struct full_block
+    {
+        block_type*  block;
+        std::size_t  size;
+    };
+
+    FILE*                    m_fp;
+    void*                    m_gz;      // gzFile on fp, if compressed.
+    char*                    m_begin;   // current block.
+    char*                    m_pos;
+    char*                    m_end;
+    block_type*              m_block;
+    sc_dt::uint64            m_flushed; // bytes in previous blocks.
+
+    bool                     m_background;
+    std::thread              m_writer;
+    std::mutex               m_mutex;
+    std::condition_variable  m_cond;
+    std::deque<full_block>   m_full;    // blocks to be written.
+    std::vector<block_type*> m_free;    // blocks written.
+    std::size_t              m_blocks;  // blocks allocated.
+    bool                     m_stop;
+
+private:
+
+    // disabled
+    sc_trace_buffer( const sc_trace_buffer& );
+    sc_trace_buffer& operator = ( const sc_trace_buffer& );
+};
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_TRACE_BUFFER_H_INCLUDED_
+// Taf!
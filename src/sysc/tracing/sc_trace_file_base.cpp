@@ -37,6 +37,7 @@
 
  *****************************************************************************/
 
+#include <algorithm>
 #include <ctime>
 #include <sstream>
 
@@ -67,6 +68,11 @@ sc_trace_file_base::sc_trace_file_base( const char* name, const char* extension
   , filename_()
   , initialized_(false)
   , trace_delta_cycles_(false)
+  , trace_states_()
+  , polled_traces_()
+  , updated_traces_()
+  , checked_traces_()
+  , trace_notifiers_()
 {
     if( !name || !*name ) {
         SC_REPORT_ERROR( SC_ID_TRACING_FOPEN_FAILED_, "no name given" );
@@ -88,6 +94,20 @@ sc_trace_file_base::~sc_trace_file_base()
     if( fp )
         fclose(fp);
 
+    // the channels no longer report their updates to this file
+    for( std::size_t i = 0; i < trace_notifiers_.size(); ++i ) {
+        std::vector<std::pair<sc_trace_file_base*, std::size_t> >& traces =
+          trace_notifiers_[i]->m_traces;
+        for( std::size_t j = 0; j < traces.size(); ) {
+            if( traces[j].first == this ) {
+                traces[j] = traces.back();
+                traces.pop_back();
+            } else {
+                ++j;
+            }
+        }
+    }
+
     // unregister from simcontext
     sc_unregister_stage_callback( *this, SC_PRE_TIMESTEP | SC_POST_UPDATE );
 }
@@ -156,6 +176,16 @@ sc_trace_file_base::initialize()
     // initialize derived tracing implementation class (VCD/WIF)
     do_initialize();
 
+    // all values have been written, only the traces without notifier
+    // need to be checked in each cycle
+    for( std::size_t i = 0; i < trace_states_.size(); ++i ) {
+        if( trace_states_[i] == state_polled )
+            polled_traces_.push_back( i );
+        else
+            trace_states_[i] = state_notified;
+    }
+    updated_traces_.clear();
+
     return initialized_;
 }
 
@@ -208,9 +238,12 @@ sc_trace_file_base::set_time_unit( double v, sc_time_unit tu )
 }
 
 bool
-sc_trace_file_base::add_trace_check( const std::string & name ) const
+sc_trace_file_base::add_trace_check( const std::string & name )
 {
-    if( !initialized_ ) return true;
+    if( !initialized_ ) {
+        trace_states_.push_back( state_polled );
+        return true;
+    }
 
     std::stringstream ss;
     ss << "sc_trace() failed:\n"
@@ -224,6 +257,96 @@ sc_trace_file_base::add_trace_check( const std::string & name ) const
     return false;
 }
 
+void
+sc_trace_file_base::add_trace_notifier( sc_trace_notifier& notifier
+                                      , std::size_t first )
+{
+    // no trace has been added for the channel, e.g. by an empty sc_trace()
+    // of a user-defined type
+    if( initialized_ || first >= trace_states_.size() )
+        return;
+
+    bool added = false;
+    for( std::size_t index = first; index < trace_states_.size(); ++index ) {
+        if( trace_states_[index] != state_polled )
+            continue;
+        trace_states_[index] = state_notified;
+        notifier.m_traces.push_back( std::make_pair( this, index ) );
+        added = true;
+    }
+    if( added )
+        trace_notifiers_.push_back( &notifier );
+}
+
+void
+sc_trace_file_base::remove_trace_notifier( sc_trace_notifier* notifier )
+{
+    trace_notifiers_.erase( std::remove( trace_notifiers_.begin()
+                                       , trace_notifiers_.end(), notifier )
+                          , trace_notifiers_.end() );
+
+    // the traces of the channel are polled again
+    std::vector<std::pair<sc_trace_file_base*, std::size_t> >& traces =
+      notifier->m_traces;
+    for( std::size_t i = 0; i < traces.size(); ++i ) {
+        if( traces[i].first != this )
+            continue;
+        std::size_t index = traces[i].second;
+        updated_traces_.erase( std::remove( updated_traces_.begin()
+                                          , updated_traces_.end(), index )
+                             , updated_traces_.end() );
+        if( initialized_ ) {
+            polled_traces_.insert( std::lower_bound( polled_traces_.begin()
+                                                   , polled_traces_.end()
+                                                   , index )
+                                 , index );
+        }
+        trace_states_[index] = state_polled;
+    }
+}
+
+// The updated traces are merged into the polled ones, so the values are
+// written in the same order as if all traces were polled.
+
+const std::vector<std::size_t>&
+sc_trace_file_base::traces_to_check()
+{
+    if( updated_traces_.empty() )
+        return polled_traces_;
+
+    std::sort( updated_traces_.begin(), updated_traces_.end() );
+    checked_traces_.resize( polled_traces_.size() + updated_traces_.size() );
+    std::merge( polled_traces_.begin(), polled_traces_.end()
+              , updated_traces_.begin(), updated_traces_.end()
+              , checked_traces_.begin() );
+
+    for( std::size_t i = 0; i < updated_traces_.size(); ++i )
+        trace_states_[updated_traces_[i]] = state_notified;
+    updated_traces_.clear();
+    return checked_traces_;
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_notifier
+// ----------------------------------------------------------------------------
+
+sc_trace_notifier::~sc_trace_notifier()
+{
+    while( !m_traces.empty() ) {
+        sc_trace_file_base* file = m_traces.back().first;
+        file->remove_trace_notifier( this );
+        // remove the entries of the file
+        std::vector<std::pair<sc_trace_file_base*, std::size_t> >::iterator
+          it = m_traces.begin();
+        while( it != m_traces.end() ) {
+            if( it->first == file )
+                it = m_traces.erase( it );
+            else
+                ++it;
+        }
+    }
+}
+
 
 bool
 sc_trace_file_base::has_low_units() const {
@@ -41,6 +41,8 @@
 #define SC_TRACE_FILE_BASE_H_INCLUDED_
 
 #include <cstdio>
+#include <utility>
+#include <vector>
 
 #  include "sysc/kernel/sc_stage_callback_if.h"
 #include "sysc/tracing/sc_trace.h"
@@ -53,6 +55,40 @@
 
 namespace sc_core {
 
+class sc_trace_file_base;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_trace_notifier (implementation-defined)
+//
+//  Reports the updates of a primitive channel to the trace files, which
+//  trace its value. Such traces are only checked for a change after an
+//  update of the channel, instead of in every cycle of the trace file.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_trace_notifier
+{
+    friend class sc_trace_file_base;
+
+public:
+
+    sc_trace_notifier() : m_traces() {}
+
+    // the trace files fall back to polling
+    ~sc_trace_notifier();
+
+    // called in the update of the channel
+    void notify() const;
+
+private:
+
+    // trace files and indices of the traces
+    std::vector<std::pair<sc_trace_file_base*, std::size_t> > m_traces;
+
+private: // disabled
+    sc_trace_notifier( const sc_trace_notifier& ) /* = delete */;
+    sc_trace_notifier& operator=( const sc_trace_notifier& ) /* = delete */;
+};
+
 // shared implementation of trace files
 class SC_API sc_trace_file_base
   : public sc_trace_file
@@ -73,6 +109,15 @@ public:
     // set a user-define timescale unit for the trace file
     virtual void set_time_unit( double v, sc_time_unit tu);
 
+    // number of traces added so far
+    std::size_t trace_count() const
+      { return trace_states_.size(); }
+
+    // The traces added from index `first' on are the value of a primitive
+    // channel, which reports its updates to the notifier
+    // (implementation-defined).
+    void add_trace_notifier( sc_trace_notifier& notifier, std::size_t first );
+
 protected:
     sc_trace_file_base( const char* name, const char* extension );
 
@@ -81,13 +126,19 @@ protected:
     // returns true, iff initialization has been performed in this call
     bool initialize();
     // ensure that file has been opened (needed for early write_comment())
-    void open_fp();
+    virtual void open_fp();
     // perform format specific initialization
     virtual void do_initialize() = 0;
 
     // returns true, if new trace objects can still be added
-    // (i.e. trace file is not yet initialized)
-    bool add_trace_check( const std::string& name ) const;
+    // (i.e. trace file is not yet initialized), each successful
+    // check must be followed by the addition of a trace
+    bool add_trace_check( const std::string& name );
+
+    // indices of the traces to be checked for changes in this cycle, in
+    // the order of their addition: the traces without a notifier, and
+    // the ones of channels, which have been updated since the last call
+    const std::vector<std::size_t>& traces_to_check();
 
     // tracefile time unit < kernel unit, extra units will be placed in low part
     bool has_low_units() const;
@@ -108,6 +159,20 @@ protected:
 private:
     virtual void stage_callback(const sc_stage & stage);
 
+    friend class sc_trace_notifier;
+
+    void trace_updated( std::size_t index )
+    {
+        if( trace_states_[index] == state_notified ) {
+            trace_states_[index] = state_updated;
+            updated_traces_.push_back( index );
+        }
+    }
+
+    void remove_trace_notifier( sc_trace_notifier* notifier );
+
+    enum trace_state { state_polled, state_notified, state_updated };
+
 protected:
     FILE* fp;                          // pointer to the trace file
 
@@ -120,6 +185,12 @@ private:
     bool        initialized_;          // tracing started?
     bool        trace_delta_cycles_;   // also trace delta transitions?
 
+    std::vector<unsigned char>      trace_states_;    // of all traces
+    std::vector<std::size_t>        polled_traces_;   // without notifier
+    std::vector<std::size_t>        updated_traces_;  // since last check
+    std::vector<std::size_t>        checked_traces_;  // in this cycle
+    std::vector<sc_trace_notifier*> trace_notifiers_; // of the channels
+
     static bool tracing_initialized_;  // shared setup of tracing implementation
 
 private: // disabled
@@ -130,6 +201,15 @@ private: // disabled
 
 // -----------------------------------------------------------------------
 
+inline void
+sc_trace_notifier::notify() const
+{
+    for( std::size_t i = 0; i < m_traces.size(); ++i )
+        m_traces[i].first->trace_updated( m_traces[i].second );
+}
+
+// -----------------------------------------------------------------------
+
 
 // obtain formatted time string
 SC_API std::string localtime_string();
@@ -66,7 +66,9 @@ SC_DEFINE_MESSAGE( SC_ID_TRACING_REVERSED_TIME_,        714,
  "tracing cycle with duplicate or reversed time detected" )
 SC_DEFINE_MESSAGE( SC_ID_TRACING_CLOSE_EMPTY_FILE_,     715,
  "trace file closed before any cycles were traced, file not written" )
-/* unused IDs 716-719 */
+SC_DEFINE_MESSAGE( SC_ID_TRACING_VCD_COMPRESSION_IGNORED_, 716,
+ "unknown compression of VCD file ignored" )
+/* unused IDs 717-719 */
 SC_DEFINE_MESSAGE( SC_ID_TRACING_ALREADY_INITIALIZED_,  720,
                    "sc_trace_file already initialized" )
 
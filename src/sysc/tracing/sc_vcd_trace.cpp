@@ -51,6 +51,7 @@
  *****************************************************************************/
 
 
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <limits>
@@ -71,6 +72,7 @@
 #include "sysc/datatypes/int/sc_signed_ops.h"
 #include "sysc/datatypes/int/sc_unsigned_inlines.h"
 #include "sysc/datatypes/fx/fx.h"
+#include "sysc/tracing/sc_trace_buffer.h"
 #include "sysc/tracing/sc_vcd_trace.h"
 #include "sysc/utils/sc_report.h" // sc_assert
 #include "sysc/utils/sc_string_view.h"
@@ -109,20 +111,29 @@ public:
 
     // Needs to be pure virtual as has to be defined by the particular
     // type being traced
-    virtual void write(FILE* f) = 0;
+    virtual void write(sc_trace_buffer& out) = 0;
 
     virtual void set_width();
 
-    static const char* strip_leading_bits(const char* originalbuf);
+    static const char* strip_leading_bits(const char* begin, const char* end);
 
     // Comparison function needs to be pure virtual too
     virtual bool changed() = 0;
 
     // Make this virtual as some derived classes may overwrite
-    virtual void print_variable_declaration_line(FILE* f, const char* scoped_name);
+    virtual void print_variable_declaration_line(sc_trace_buffer& out,
+                                                 const char* scoped_name);
 
-    void compose_data_line(char* rawdata, char* compdata, int compdata_n);
-    std::string compose_line(const std::string& data);
+    // The value of a vector is formatted in place: begin_value() returns
+    // room for bit_width characters, end_value() strips the leading bits
+    // and appends the VCD name.
+    char* begin_value(sc_trace_buffer& out);
+    void end_value(sc_trace_buffer& out, char* bits);
+
+    // value of up to 64 bits, all bits are 'x' if it does not fit
+    void write_value(sc_trace_buffer& out, sc_dt::uint64 value, bool fits);
+
+    void write_real(sc_trace_buffer& out, double value);
 
     virtual ~vcd_trace();
 
@@ -142,43 +153,67 @@ vcd_trace::vcd_trace(const std::string& name_, const std::string& vcd_name_)
     /* Intentionally blank */
 }
 
+char*
+vcd_trace::begin_value(sc_trace_buffer& out)
+{
+    // 'b', the bits, ' ' and the name
+    return out.reserve(bit_width + vcd_name.size() + 2) + 1;
+}
+
 void
-vcd_trace::compose_data_line(char* rawdata, char* compdata, int compdata_n)
+vcd_trace::end_value(sc_trace_buffer& out, char* bits)
 {
-    sc_assert(rawdata != compdata);
+    char* p = bits - 1;
 
     if(bit_width == 0)
+        return;
+
+    if(bit_width == 1)
     {
-        compdata[0] = '\0';
+        *p++ = bits[0];
     }
     else
     {
-        if(bit_width == 1)
-        {
-            compdata[0] = rawdata[0];
-            strcpy(&(compdata[1]), vcd_name.c_str());
-        }
-        else
-        {
-            const char* effective_begin = strip_leading_bits(rawdata);
-            std::snprintf(compdata, compdata_n, "b%s %s", effective_begin, vcd_name.c_str());
+        const char* effective_begin = strip_leading_bits(bits, bits + bit_width);
+        std::size_t n = bits + bit_width - effective_begin;
+        *p++ = 'b';
+        std::memmove(p, effective_begin, n);
+        p += n;
+        *p++ = ' ';
+    }
+    std::memcpy(p, vcd_name.data(), vcd_name.size());
+    out.commit(p + vcd_name.size());
+}
+
+void
+vcd_trace::write_value(sc_trace_buffer& out, sc_dt::uint64 value, bool fits)
+{
+    char* bits = begin_value(out);
+    char* p = bits;
+
+    if (!fits) {
+        std::memset(bits, 'x', bit_width);
+    }
+    else {
+        for (int bitindex = bit_width - 1; bitindex >= 0; --bitindex) {
+            *p++ = (bitindex < 64 && ((value >> bitindex) & 1)) ? '1' : '0';
         }
     }
+    end_value(out, bits);
 }
 
-// same as above but not that ugly
-std::string
-vcd_trace::compose_line(const std::string& data)
+void
+vcd_trace::write_real(sc_trace_buffer& out, double value)
 {
-  if(bit_width == 0)
-    return "";
-  if(bit_width == 1)
-    return data + vcd_name;
-  return std::string("b")+strip_leading_bits(data.c_str())+" "+vcd_name;
+    out.put('r');
+    out.put_real(value);
+    out.put(' ');
+    out.put(vcd_name);
 }
 
 void
-vcd_trace::print_variable_declaration_line(FILE* f, const char* scoped_name)
+vcd_trace::print_variable_declaration_line(sc_trace_buffer& out,
+                                           const char* scoped_name)
 {
     char buf[2000];
 
@@ -208,7 +243,7 @@ vcd_trace::print_variable_declaration_line(FILE* f, const char* scoped_name)
                      bit_width-1);
     }
 
-    std::fputs(buf, f);
+    out.put(buf);
 }
 
 void
@@ -218,7 +253,7 @@ vcd_trace::set_width()
 }
 
 const char*
-vcd_trace::strip_leading_bits(const char* originalbuf)
+vcd_trace::strip_leading_bits(const char* begin, const char* end)
 {
     //*********************************************************************
     // - Remove multiple leading 0,z,x, and replace by only one
@@ -231,20 +266,20 @@ vcd_trace::strip_leading_bits(const char* originalbuf)
     // - For leading 0's followed by 1, remove all leading 0's
     //    b0000010101 -> b10101
 
-    const char* position = originalbuf;
+    const char* position = begin;
 
-    if( strlen(originalbuf) < 2 ||
-	(originalbuf[0] != 'z' && originalbuf[0] != 'x' &&
-	 originalbuf[0] != '0' ))
-      return originalbuf;
+    if( end - begin < 2 ||
+	(begin[0] != 'z' && begin[0] != 'x' &&
+	 begin[0] != '0' ))
+      return begin;
 
     char first_char = *position;
-    while(*position == first_char)
+    while(position != end && *position == first_char)
     {
         position++;
     }
 
-    if(first_char == '0' && *position == '1')
+    if(first_char == '0' && position != end && *position == '1')
         return position;
     // else
     return position-1;
@@ -273,9 +308,13 @@ class vcd_T_trace : public vcd_trace
         vcd_var_type = type_;
     }
 
-    void write( FILE* f )
+    void write( sc_trace_buffer& out )
     {
-        std::fprintf( f, "%s", compose_line( object.to_string() ).c_str() );
+        char* bits = begin_value( out );
+        char* p = bits;
+        for( int bitindex = bit_width - 1; bitindex >= 0; --bitindex )
+            *p++ = sc_dt::sc_logic::logic_to_char[object.get_bit( bitindex )];
+        end_value( out, bits );
         old_value = object;
     }
 
@@ -317,7 +356,7 @@ public:
     vcd_sc_event_trace(const sc_dt::uint64& trigger_stamp_,
                        const std::string& name_,
                        const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -342,10 +381,11 @@ vcd_sc_event_trace::changed()
 }
 
 void
-vcd_sc_event_trace::write(FILE* f)
+vcd_sc_event_trace::write(sc_trace_buffer& out)
 {
     if(!changed()) return;
-    std::fprintf(f,"1%s", vcd_name.c_str());
+    out.put('1');
+    out.put(vcd_name);
     old_trigger_stamp = trigger_stamp;
 }
 
@@ -356,7 +396,7 @@ public:
     vcd_bool_trace(const bool& object_,
 		   const std::string& name_,
 		   const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -379,13 +419,10 @@ vcd_bool_trace::changed()
 }
 
 void
-vcd_bool_trace::write(FILE* f)
+vcd_bool_trace::write(sc_trace_buffer& out)
 {
-    if (object == true) std::fputc('1', f);
-    else std::fputc('0', f);
-
-    std::fprintf(f,"%s", vcd_name.c_str());
-
+    out.put(object ? '1' : '0');
+    out.put(vcd_name);
     old_value = object;
 }
 
@@ -395,7 +432,7 @@ class vcd_sc_bit_trace : public vcd_trace {
 public:
     vcd_sc_bit_trace(const sc_dt::sc_bit& , const std::string& ,
     	const std::string& );
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -418,13 +455,10 @@ vcd_sc_bit_trace::changed()
 }
 
 void
-vcd_sc_bit_trace::write(FILE* f)
+vcd_sc_bit_trace::write(sc_trace_buffer& out)
 {
-    if (object == true) std::fputc('1', f);
-    else std::fputc('0', f);
-
-    std::fprintf(f,"%s", vcd_name.c_str());
-
+    out.put(object == true ? '1' : '0');
+    out.put(vcd_name);
     old_value = object;
 }
 
@@ -435,7 +469,7 @@ public:
     vcd_sc_logic_trace(const sc_dt::sc_logic& object_,
 		       const std::string& name_,
 		       const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -461,14 +495,10 @@ vcd_sc_logic_trace::changed()
 
 
 void
-vcd_sc_logic_trace::write(FILE* f)
+vcd_sc_logic_trace::write(sc_trace_buffer& out)
 {
-    char out_char;
-    out_char = map_sc_logic_state_to_vcd_state(object.to_char());
-    std::fputc(out_char, f);
-
-    std::fprintf(f,"%s", vcd_name.c_str());
-
+    out.put(map_sc_logic_state_to_vcd_state(object.to_char()));
+    out.put(vcd_name);
     old_value = object;
 }
 
@@ -480,7 +510,7 @@ public:
     vcd_sc_unsigned_trace(const sc_dt::sc_unsigned& object_,
 			  const std::string& name_,
 			  const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
     void set_width();
 
@@ -506,25 +536,17 @@ vcd_sc_unsigned_trace::changed()
 }
 
 void
-vcd_sc_unsigned_trace::write(FILE* f)
+vcd_sc_unsigned_trace::write(sc_trace_buffer& out)
 {
-    static std::vector<char> compdata(1024), rawdata(1024);
-    typedef std::vector<char>::size_type size_t;
-
-    if ( compdata.size() <= static_cast<size_t>(object.length()) ) { // include trailing \0
-        size_t sz = ( static_cast<size_t>(object.length()) + 4096 ) & (~static_cast<size_t>(4096-1));
-        std::vector<char>( sz ).swap( compdata ); // resize without copying values
-        std::vector<char>( sz ).swap( rawdata );
-    }
-    char *rawdata_ptr  = &rawdata[0];
+    const sc_dt::sc_digit* digits = object.get_digits();
+    char* bits = begin_value(out);
+    char* p = bits;
 
-    for (int bitindex = object.length() - 1; bitindex >= 0; --bitindex) {
-        *rawdata_ptr++ = "01"[object[bitindex].to_bool()];
+    for (int bitindex = bit_width - 1; bitindex >= 0; --bitindex) {
+        *p++ = "01"[(digits[bitindex / BITS_PER_DIGIT]
+                     >> (bitindex % BITS_PER_DIGIT)) & 1];
     }
-    *rawdata_ptr = '\0';
-    compose_data_line(&rawdata[0], &compdata[0], 1024);
-
-    std::fputs(&compdata[0], f);
+    end_value(out, bits);
     old_value = object;
 }
 
@@ -542,7 +564,7 @@ public:
     vcd_sc_signed_trace(const sc_dt::sc_signed& object_,
 			const std::string& name_,
 			const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
     void set_width();
 
@@ -567,25 +589,17 @@ vcd_sc_signed_trace::changed()
 }
 
 void
-vcd_sc_signed_trace::write(FILE* f)
+vcd_sc_signed_trace::write(sc_trace_buffer& out)
 {
-    static std::vector<char> compdata(1024), rawdata(1024);
-    typedef std::vector<char>::size_type size_t;
-
-    if ( compdata.size() <= static_cast<size_t>(object.length()) ) { // include trailing \0
-        size_t sz = ( static_cast<size_t>(object.length()) + 4096 ) & (~static_cast<size_t>(4096-1));
-        std::vector<char>( sz ).swap( compdata ); // resize without copying values
-        std::vector<char>( sz ).swap( rawdata );
-    }
-    char *rawdata_ptr  = &rawdata[0];
+    const sc_dt::sc_digit* digits = object.get_digits();
+    char* bits = begin_value(out);
+    char* p = bits;
 
-    for (int bitindex = object.length() - 1; bitindex >= 0; --bitindex) {
-        *rawdata_ptr++ = "01"[object[bitindex].to_bool()];
+    for (int bitindex = bit_width - 1; bitindex >= 0; --bitindex) {
+        *p++ = "01"[(digits[bitindex / BITS_PER_DIGIT]
+                     >> (bitindex % BITS_PER_DIGIT)) & 1];
     }
-    *rawdata_ptr = '\0';
-    compose_data_line(&rawdata[0], &compdata[0], 1024);
-
-    std::fputs(&compdata[0], f);
+    end_value(out, bits);
     old_value = object;
 }
 
@@ -602,7 +616,7 @@ public:
     vcd_sc_uint_base_trace(const sc_dt::sc_uint_base& object_,
 			   const std::string& name_,
 			   const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
     void set_width();
 
@@ -629,19 +643,9 @@ vcd_sc_uint_base_trace::changed()
 }
 
 void
-vcd_sc_uint_base_trace::write(FILE* f)
+vcd_sc_uint_base_trace::write(sc_trace_buffer& out)
 {
-    char rawdata[1000], *rawdata_ptr = rawdata;
-    char compdata[1000];
-
-    int bitindex;
-    for (bitindex = object.length()-1; bitindex >= 0; --bitindex) {
-        *rawdata_ptr++ = "01"[object[bitindex].to_bool()];
-    }
-    *rawdata_ptr = '\0';
-    compose_data_line(rawdata, compdata, 1000);
-
-    std::fputs(compdata, f);
+    write_value(out, object.value(), true);
     old_value = object;
 }
 
@@ -659,7 +663,7 @@ public:
     vcd_sc_int_base_trace(const sc_dt::sc_int_base& object_,
 			  const std::string& name_,
 			  const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
     void set_width();
 
@@ -684,19 +688,9 @@ vcd_sc_int_base_trace::changed()
 }
 
 void
-vcd_sc_int_base_trace::write(FILE* f)
+vcd_sc_int_base_trace::write(sc_trace_buffer& out)
 {
-    char rawdata[1000], *rawdata_ptr = rawdata;
-    char compdata[1000];
-
-    int bitindex;
-    for (bitindex = object.length()-1; bitindex >= 0; --bitindex) {
-        *rawdata_ptr++ = "01"[object[bitindex].to_bool()];
-    }
-    *rawdata_ptr = '\0';
-    compose_data_line(rawdata, compdata, 1000);
-
-    std::fputs(compdata, f);
+    write_value(out, static_cast<sc_dt::uint64>(object.value()), true);
     old_value = object;
 }
 
@@ -716,7 +710,7 @@ public:
     vcd_sc_fxval_trace( const sc_dt::sc_fxval& object_,
 			const std::string& name_,
 			const std::string& vcd_name_ );
-    void write( FILE* f );
+    void write( sc_trace_buffer& out );
     bool changed();
 
 protected:
@@ -743,9 +737,9 @@ vcd_sc_fxval_trace::changed()
 }
 
 void
-vcd_sc_fxval_trace::write( FILE* f )
+vcd_sc_fxval_trace::write( sc_trace_buffer& out )
 {
-    std::fprintf( f, "r%.16g %s", object.to_double(), vcd_name.c_str() );
+    write_real( out, object.to_double() );
     old_value = object;
 }
 
@@ -758,7 +752,7 @@ public:
     vcd_sc_fxval_fast_trace( const sc_dt::sc_fxval_fast& object_,
 			     const std::string& name_,
 			     const std::string& vcd_name_ );
-    void write( FILE* f );
+    void write( sc_trace_buffer& out );
     bool changed();
 
 protected:
@@ -786,9 +780,9 @@ vcd_sc_fxval_fast_trace::changed()
 }
 
 void
-vcd_sc_fxval_fast_trace::write( FILE* f )
+vcd_sc_fxval_fast_trace::write( sc_trace_buffer& out )
 {
-    std::fprintf( f, "r%.16g %s", object.to_double(), vcd_name.c_str() );
+    write_real( out, object.to_double() );
     old_value = object;
 }
 
@@ -801,7 +795,7 @@ public:
     vcd_sc_fxnum_trace( const sc_dt::sc_fxnum& object_,
 			const std::string& name_,
 			const std::string& vcd_name_ );
-    void write( FILE* f );
+    void write( sc_trace_buffer& out );
     bool changed();
     void set_width();
 
@@ -832,26 +826,16 @@ vcd_sc_fxnum_trace::changed()
 }
 
 void
-vcd_sc_fxnum_trace::write( FILE* f )
+vcd_sc_fxnum_trace::write( sc_trace_buffer& out )
 {
-    static std::vector<char> compdata(1024), rawdata(1024);
-    typedef std::vector<char>::size_type size_t;
-
-    if ( compdata.size() <= static_cast<size_t>(object.wl()) ) { // include trailing \0
-        size_t sz = ( static_cast<size_t>(object.wl()) + 4096 ) & (~static_cast<size_t>(4096-1));
-        std::vector<char>( sz ).swap( compdata ); // resize without copying values
-        std::vector<char>( sz ).swap( rawdata );
-    }
-    char *rawdata_ptr  = &rawdata[0];
+    char* bits = begin_value( out );
+    char* p = bits;
 
     for(int bitindex = object.wl() - 1; bitindex >= 0; -- bitindex )
     {
-        *rawdata_ptr ++ = "01"[object[bitindex]];
+        *p ++ = "01"[object[bitindex]];
     }
-    *rawdata_ptr = '\0';
-    compose_data_line( &rawdata[0], &compdata[0], 1024 );
-
-    std::fputs( &compdata[0], f );
+    end_value( out, bits );
     old_value = object;
 }
 
@@ -870,7 +854,7 @@ public:
     vcd_sc_fxnum_fast_trace( const sc_dt::sc_fxnum_fast& object_,
 			     const std::string& name_,
 			     const std::string& vcd_name_ );
-    void write( FILE* f );
+    void write( sc_trace_buffer& out );
     bool changed();
     void set_width();
 
@@ -902,26 +886,16 @@ vcd_sc_fxnum_fast_trace::changed()
 }
 
 void
-vcd_sc_fxnum_fast_trace::write( FILE* f )
+vcd_sc_fxnum_fast_trace::write( sc_trace_buffer& out )
 {
-    static std::vector<char> compdata(1024), rawdata(1024);
-    typedef std::vector<char>::size_type size_t;
-
-    if ( compdata.size() <= static_cast<size_t>(object.wl()) ) { // include trailing \0
-        size_t sz = ( static_cast<size_t>(object.wl()) + 4096 ) & (~static_cast<size_t>(4096-1));
-        std::vector<char>( sz ).swap( compdata ); // resize without copying values
-        std::vector<char>( sz ).swap( rawdata );
-    }
-    char *rawdata_ptr  = &rawdata[0];
+    char* bits = begin_value( out );
+    char* p = bits;
 
     for(int bitindex = object.wl() - 1; bitindex >= 0; -- bitindex )
     {
-        *rawdata_ptr ++ = "01"[object[bitindex]];
+        *p ++ = "01"[object[bitindex]];
     }
-    *rawdata_ptr = '\0';
-    compose_data_line( &rawdata[0], &compdata[0], 1024 );
-
-    std::fputs( &compdata[0], f );
+    end_value( out, bits );
     old_value = object;
 }
 
@@ -940,7 +914,7 @@ public:
 			   const std::string& name_,
 			   const std::string& vcd_name_,
 			   int width_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -971,28 +945,10 @@ vcd_unsigned_int_trace::changed()
 
 
 void
-vcd_unsigned_int_trace::write(FILE* f)
+vcd_unsigned_int_trace::write(sc_trace_buffer& out)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
     // Check for overflow
-    if ((object & mask) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else {
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata, 1000);
-    std::fputs(compdata, f);
+    write_value(out, object, (object & mask) == object);
     old_value = object;
 }
 
@@ -1004,7 +960,7 @@ public:
 			     const std::string& name_,
 			     const std::string& vcd_name_,
 			     int width_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -1034,28 +990,10 @@ vcd_unsigned_short_trace::changed()
 
 
 void
-vcd_unsigned_short_trace::write(FILE* f)
+vcd_unsigned_short_trace::write(sc_trace_buffer& out)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
     // Check for overflow
-    if ((object & mask) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else {
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata, 1000);
-    std::fputs(compdata, f);
+    write_value(out, object, (object & mask) == object);
     old_value = object;
 }
 
@@ -1067,7 +1005,7 @@ public:
 			    const std::string& name_,
 			    const std::string& vcd_name_,
 			    int width_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -1095,28 +1033,10 @@ bool vcd_unsigned_char_trace::changed()
 }
 
 
-void vcd_unsigned_char_trace::write(FILE* f)
+void vcd_unsigned_char_trace::write(sc_trace_buffer& out)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
     // Check for overflow
-    if ((object & mask) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else {
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata, 1000);
-    std::fputs(compdata, f);
+    write_value(out, object, (object & mask) == object);
     old_value = object;
 }
 
@@ -1128,7 +1048,7 @@ public:
 			    const std::string& name_,
 			    const std::string& vcd_name_,
 			    int width_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -1158,28 +1078,10 @@ bool vcd_unsigned_long_trace::changed()
 }
 
 
-void vcd_unsigned_long_trace::write(FILE* f)
+void vcd_unsigned_long_trace::write(sc_trace_buffer& out)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
     // Check for overflow
-    if ((object & mask) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++){
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else {
-        unsigned long bit_mask = 1ul << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata, 1000);
-    std::fputs(compdata, f);
+    write_value(out, object, (object & mask) == object);
     old_value = object;
 }
 
@@ -1191,7 +1093,7 @@ public:
 			 const std::string& name_,
 			 const std::string& vcd_name_,
 			 int width_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -1218,28 +1120,11 @@ bool vcd_signed_int_trace::changed()
 }
 
 
-void vcd_signed_int_trace::write(FILE* f)
+void vcd_signed_int_trace::write(sc_trace_buffer& out)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
     // Check for overflow
-    if (((object << rem_bits) >> rem_bits) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else {
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata, 1000);
-    std::fputs(compdata, f);
+    write_value(out, static_cast<sc_dt::uint64>(object),
+                ((object << rem_bits) >> rem_bits) == object);
     old_value = object;
 }
 
@@ -1251,7 +1136,7 @@ public:
 			   const std::string& name_,
 			   const std::string& vcd_name_,
 			   int width_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -1278,28 +1163,11 @@ bool vcd_signed_short_trace::changed()
 }
 
 
-void vcd_signed_short_trace::write(FILE* f)
+void vcd_signed_short_trace::write(sc_trace_buffer& out)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
     // Check for overflow
-    if (((object << rem_bits) >> rem_bits) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else {
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata, 1000);
-    std::fputs(compdata, f);
+    write_value(out, static_cast<sc_dt::uint64>(object),
+                ((object << rem_bits) >> rem_bits) == object);
     old_value = object;
 }
 
@@ -1311,7 +1179,7 @@ public:
 			  const std::string& name_,
 			  const std::string& vcd_name_,
 			  int width_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -1337,28 +1205,11 @@ bool vcd_signed_char_trace::changed()
 }
 
 
-void vcd_signed_char_trace::write(FILE* f)
+void vcd_signed_char_trace::write(sc_trace_buffer& out)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
     // Check for overflow
-    if (((object << rem_bits) >> rem_bits) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else {
-        unsigned bit_mask = 1 << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata, 1000);
-    std::fputs(compdata, f);
+    write_value(out, static_cast<sc_dt::uint64>(object),
+                ((object << rem_bits) >> rem_bits) == object);
     old_value = object;
 }
 
@@ -1370,7 +1221,7 @@ public:
 			  const std::string& name_,
 			  const std::string& vcd_name_,
 			  int width_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -1397,31 +1248,11 @@ bool vcd_int64_trace::changed()
 }
 
 
-void vcd_int64_trace::write(FILE* f)
+void vcd_int64_trace::write(sc_trace_buffer& out)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
     // Check for overflow
-    if (((object << rem_bits) >> rem_bits) != object)
-    {
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else
-    {
-        sc_dt::uint64 bit_mask = 1;
-        bit_mask = bit_mask << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata, 1000);
-    std::fputs(compdata, f);
+    write_value(out, static_cast<sc_dt::uint64>(object),
+                ((object << rem_bits) >> rem_bits) == object);
     old_value = object;
 }
 
@@ -1434,7 +1265,7 @@ public:
 		     const std::string& name_,
 		     const std::string& vcd_name_,
 		     int width_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -1462,31 +1293,10 @@ bool vcd_uint64_trace::changed()
 }
 
 
-void vcd_uint64_trace::write(FILE* f)
+void vcd_uint64_trace::write(sc_trace_buffer& out)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
     // Check for overflow
-    if ((object & mask) != object)
-    {
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else
-    {
-        sc_dt::uint64 bit_mask = 1;
-        bit_mask = bit_mask << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata, 1000);
-    std::fputs(compdata, f);
+    write_value(out, object, (object & mask) == object);
     old_value = object;
 }
 
@@ -1529,7 +1339,7 @@ public:
 			  const std::string& name_,
 			  const std::string& vcd_name_,
 			  int width_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -1556,28 +1366,11 @@ bool vcd_signed_long_trace::changed()
 }
 
 
-void vcd_signed_long_trace::write(FILE* f)
+void vcd_signed_long_trace::write(sc_trace_buffer& out)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
     // Check for overflow
-    if (((object << rem_bits) >> rem_bits) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = 'x';
-        }
-    }
-    else {
-        unsigned long bit_mask = 1ul << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata, 1000);
-    std::fputs(compdata, f);
+    write_value(out, static_cast<sc_dt::uint64>(object),
+                ((object << rem_bits) >> rem_bits) == object);
     old_value = object;
 }
 
@@ -1589,7 +1382,7 @@ public:
     vcd_float_trace(const float& object_,
 		    const std::string& name_,
 		    const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -1612,9 +1405,9 @@ bool vcd_float_trace::changed()
     return object != old_value;
 }
 
-void vcd_float_trace::write(FILE* f)
+void vcd_float_trace::write(sc_trace_buffer& out)
 {
-    std::fprintf(f, "r%.16g %s", object, vcd_name.c_str());
+    write_real(out, object);
     old_value = object;
 }
 
@@ -1625,7 +1418,7 @@ public:
     vcd_double_trace(const double& object_,
 		     const std::string& name_,
 		     const std::string& vcd_name_);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -1647,9 +1440,9 @@ bool vcd_double_trace::changed()
     return object != old_value;
 }
 
-void vcd_double_trace::write(FILE* f)
+void vcd_double_trace::write(sc_trace_buffer& out)
 {
-    std::fprintf(f, "r%.16g %s", object, vcd_name.c_str());
+    write_real(out, object);
     old_value = object;
 }
 
@@ -1662,7 +1455,7 @@ public:
 		   const std::string& name_,
 		   const std::string& vcd_name_,
 		   const char** enum_literals);
-    void write(FILE* f);
+    void write(sc_trace_buffer& out);
     bool changed();
 
 protected:
@@ -1705,27 +1498,10 @@ bool vcd_enum_trace::changed()
     return object != old_value;
 }
 
-void vcd_enum_trace::write(FILE* f)
+void vcd_enum_trace::write(sc_trace_buffer& out)
 {
-    char rawdata[1000];
-    char compdata[1000];
-    int bitindex;
-
     // Check for overflow
-    if ((object & mask) != object) {
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = 'x';
-        }
-    } else {
-        unsigned long bit_mask = 1ul << (bit_width-1);
-        for (bitindex = 0; bitindex < bit_width; bitindex++) {
-            rawdata[bitindex] = (object & bit_mask)? '1' : '0';
-            bit_mask = bit_mask >> 1;
-        }
-    }
-    rawdata[bitindex] = '\0';
-    compose_data_line(rawdata, compdata, 1000);
-    std::fputs(compdata, f);
+    write_value(out, object, (object & mask) == object);
     old_value = object;
 }
 
@@ -1736,7 +1512,7 @@ void vcd_enum_trace::write(FILE* f)
 struct vcd_scope {
 
     void add_trace(vcd_trace *trace, bool with_scopes);
-    void print(FILE *fp, const char *scope_name = "SystemC");
+    void print(sc_trace_buffer& out, const char *scope_name = "SystemC");
 
     ~vcd_scope();
 private:
@@ -1780,18 +1556,20 @@ void vcd_scope::add_trace_rec(std::stringstream &ss, const std::string &cur_name
     }
 }
 
-void vcd_scope::print(FILE *fp, const char *scope_name) {
-    fprintf(fp,"$scope module %s $end\n", scope_name);
+void vcd_scope::print(sc_trace_buffer& out, const char *scope_name) {
+    out.put("$scope module ");
+    out.put(scope_name);
+    out.put(" $end\n");
 
     for (std::vector<std::pair<std::string,vcd_trace*> >::iterator it = m_traces.begin(); it != m_traces.end(); ++it) {
         it->second->set_width();
-        it->second->print_variable_declaration_line(fp, it->first.c_str());
+        it->second->print_variable_declaration_line(out, it->first.c_str());
     }
 
     for (std::map<std::string, vcd_scope*>::iterator it = m_scopes.begin(); it != m_scopes.end(); ++it)
-        it->second->print(fp,it->first.c_str());
+        it->second->print(out,it->first.c_str());
 
-    fprintf(fp,"$upscope $end\n");
+    out.put("$upscope $end\n");
 }
 
 #ifdef SC_DISABLE_VCD_SCOPES
@@ -1800,7 +1578,7 @@ void vcd_scope::print(FILE *fp, const char *scope_name) {
 #  define VCD_SCOPES_DEFAULT_ true
 #endif
 
-void vcd_print_scopes(FILE *fp, std::vector<vcd_trace*>& traces) {
+void vcd_print_scopes(sc_trace_buffer& out, std::vector<vcd_trace*>& traces) {
 
     vcd_scope top_scope;
 
@@ -1814,7 +1592,7 @@ void vcd_print_scopes(FILE *fp, std::vector<vcd_trace*>& traces) {
     for (std::vector<vcd_trace*>::iterator it = traces.begin(); it != traces.end(); ++it)
         top_scope.add_trace(*it, with_scopes);
 
-    top_scope.print(fp);
+    top_scope.print(out);
 }
 
 
@@ -1822,30 +1600,93 @@ void vcd_print_scopes(FILE *fp, std::vector<vcd_trace*>& traces) {
            vcd_trace_file functions
  *****************************************************************************/
 
+// Compression of the VCD file, selected via the environment variable
+// SC_VCD_COMPRESS. The file is compressed with zlib by the background
+// writer of the output buffer, in parallel to the simulation.
+
+struct vcd_compressor
+{
+    const char* name;       // value of SC_VCD_COMPRESS
+    const char* extension;  // of the file name
+    int         gzip_level; // passed to sc_trace_buffer::open()
+};
+
+static const vcd_compressor vcd_compressors[] = {
+#if defined(SC_HAVE_ZLIB)
+    { "gzip", "vcd.gz",  1 },
+#endif
+    { 0,      "vcd",     0 } // uncompressed
+};
+
+static const vcd_compressor*
+vcd_selected_compressor()
+{
+    const char*    compress_p = std::getenv("SC_VCD_COMPRESS");
+    sc_string_view compress_s = (compress_p) ? compress_p : "";
+
+    const vcd_compressor* c = vcd_compressors;
+    while (c->name && compress_s != c->name)
+        ++c;
+    return c;
+}
+
 vcd_trace_file::vcd_trace_file(const char *name)
-  : sc_trace_file_base( name, "vcd" )
+  : sc_trace_file_base( name, vcd_selected_compressor()->extension )
   , vcd_name_index(0)
   , previous_time_units_low(0)
   , previous_time_units_high(0)
+  , out(new sc_trace_buffer())
   , traces()
 {}
 
+void
+vcd_trace_file::open_fp()
+{
+    const char* compress_p = std::getenv("SC_VCD_COMPRESS");
+    const vcd_compressor* c = vcd_selected_compressor();
+
+    if( !c->name && compress_p && *compress_p ) {
+        std::stringstream ss;
+        ss << "SC_VCD_COMPRESS=" << compress_p
+#if defined(SC_HAVE_ZLIB)
+           << " (use gzip), "
+#else
+           << " (SystemC has been built without zlib), "
+#endif
+           << filename();
+        SC_REPORT_WARNING( SC_ID_TRACING_VCD_COMPRESSION_IGNORED_
+                         , ss.str().c_str() );
+    }
+
+    sc_trace_file_base::open_fp();
+    if( !out->open( fp, true, c->gzip_level ) ) {
+        SC_REPORT_ERROR( SC_ID_TRACING_FOPEN_FAILED_, filename() );
+        sc_abort(); // can't recover from here
+    }
+}
+
 
 void
 vcd_trace_file::do_initialize()
 {
     //date:
-    std::fprintf(fp, "$date\n     %s\n$end\n\n", localtime_string().c_str() );
+    out->put("$date\n     ");
+    out->put(localtime_string());
+    out->put("\n$end\n\n");
 
     //version:
-    std::fprintf(fp, "$version\n %s\n$end\n\n", sc_version());
+    out->put("$version\n ");
+    out->put(sc_version());
+    out->put("\n$end\n\n");
 
     //timescale:
-    std::fprintf(fp,"$timescale\n     %s\n$end\n\n", fs_unit_to_str(trace_unit_fs).c_str());
+    out->put("$timescale\n     ");
+    out->put(fs_unit_to_str(trace_unit_fs));
+    out->put("\n$end\n\n");
 
-    vcd_print_scopes(fp, traces);
+    vcd_print_scopes(*out, traces);
 
-    std::fputs("$enddefinitions  $end\n\n", fp);
+    out->put("$enddefinitions  $end\n\n");
 
     timestamp_in_trace_units(previous_time_units_high, previous_time_units_low);
 
@@ -1861,12 +1702,12 @@ vcd_trace_file::do_initialize()
 
     write_comment(ss.str());
 
-    std::fputs("$dumpvars\n",fp);
+    out->put("$dumpvars\n");
     for (int i = 0; i < (int)traces.size(); i++) {
-        traces[i]->write(fp);
-        std::fputc('\n', fp);
+        traces[i]->write(*out);
+        out->put('\n');
     }
-    std::fputs("$end\n\n", fp);
+    out->put("$end\n\n");
 }
 
 void vcd_trace_file::trace( sc_trace_file* ) const {
@@ -1995,9 +1836,9 @@ vcd_trace_file::write_comment(const std::string& comment)
 {
     if(!fp) open_fp();
     //no newline in comments allowed, as some viewers may crash
-    std::fputs("$comment\n", fp);
-    std::fputs(comment.c_str(), fp);
-    std::fputs("\n$end\n\n", fp);
+    out->put("$comment\n");
+    out->put(comment);
+    out->put("\n$end\n\n");
 }
 
 void
@@ -2058,9 +1899,11 @@ vcd_trace_file::cycle(bool this_is_a_delta_cycle)
 
     // Now do the actual printing
     bool time_printed = false;
+    // only the traces of updated channels and the polled ones
+    const std::vector<std::size_t>& l_check = traces_to_check();
     vcd_trace* const* const l_traces = &traces[0];
-    for (int i = 0; i < (int)traces.size(); i++) {
-        vcd_trace* t = l_traces[i];
+    for (std::size_t i = 0; i < l_check.size(); i++) {
+        vcd_trace* t = l_traces[l_check[i]];
         if(t->changed()) {
             if(!time_printed){
                 print_time_stamp(now_units_high, now_units_low);
@@ -2069,12 +1912,12 @@ vcd_trace_file::cycle(bool this_is_a_delta_cycle)
             }
 
             // Write the variable
-            t->write(fp);
-            std::fputc('\n', fp);
+            t->write(*out);
+            out->put('\n');
         }
     }
     // Put another newline after all values are printed
-    if(time_printed) std::fputc('\n', fp);
+    if(time_printed) out->put('\n');
 }
 
 bool vcd_trace_file::get_time_stamp(sc_trace_file_base::unit_type &now_units_high,
@@ -2090,15 +1933,11 @@ bool vcd_trace_file::get_time_stamp(sc_trace_file_base::unit_type &now_units_hig
 void vcd_trace_file::print_time_stamp(sc_trace_file_base::unit_type now_units_high,
                                       sc_trace_file_base::unit_type now_units_low) const
 {
-
-    std::stringstream ss;
+    out->put('#');
+    out->put_uint(now_units_high);
     if(has_low_units())
-        ss << "#" << now_units_high << std::setfill('0') << std::setw(low_units_len()) << now_units_low;
-    else
-        ss << "#" << now_units_high;
-
-    fputs(ss.str().c_str(), fp);
-    fputc('\n', fp);
+        out->put_uint(now_units_low, low_units_len());
+    out->put('\n');
 }
 
 
@@ -2147,6 +1986,9 @@ vcd_trace_file::~vcd_trace_file()
         vcd_trace* t = traces[i];
         delete t;
     }
+
+    out->close();
+    delete out;
 }
 
 
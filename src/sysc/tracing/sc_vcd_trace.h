@@ -54,6 +54,7 @@
 namespace sc_core {
 
 class sc_time;
+class sc_trace_buffer;
 
 class vcd_trace;  // defined in sc_vcd_trace.cpp
 template<class T> class vcd_T_trace;
@@ -216,6 +217,9 @@ private:
 
     // Initialize the VCD tracing
     virtual void do_initialize();
+
+    // open the file and its output buffer, compressed if selected
+    virtual void open_fp();
     void print_time_stamp(unit_type now_units_high, unit_type now_units_low) const;
     bool get_time_stamp(unit_type &now_units_high, unit_type &now_units_low) const;
 
@@ -224,6 +228,8 @@ private:
     unit_type previous_time_units_low;
     unit_type previous_time_units_high;
 
+    sc_trace_buffer* out;              // buffered output of the file
+
 public:
 
     // Array to store the variables traced
@@ -1815,9 +1815,11 @@ wif_trace_file::cycle(bool this_is_a_delta_cycle)
     }
 
     bool time_printed = false;
+    // only the traces of updated channels and the polled ones
+    const std::vector<std::size_t>& l_check = traces_to_check();
     wif_trace* const* const l_traces = &traces[0];
-    for (int i = 0; i < (int)traces.size(); i++) {
-        wif_trace* t = l_traces[i];
+    for (std::size_t i = 0; i < l_check.size(); i++) {
+        wif_trace* t = l_traces[l_check[i]];
         if(t->changed()){
             if(time_printed == false) {
 
@@ -34,8 +34,10 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
 
 #include "sysc/kernel/sc_process.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
 #include "sysc/kernel/sc_simcontext_int.h"
 #include "sysc/utils/sc_stop_here.h"
 #include "sysc/utils/sc_report.h"
@@ -197,6 +199,15 @@ void sc_report_handler::report(sc_severity severity_,
 			       const char* file_,
 			       int         line_ )
 {
+    // A report of a method evaluated in parallel is filtered under a lock
+    // and passed to the handler after the batch:
+
+    const bool deferred = sc_parallel_evaluator::evaluating();
+    std::unique_lock<std::mutex> lock( sc_parallel_evaluator::report_mutex(),
+                                       std::defer_lock );
+    if ( SC_UNLIKELY_( deferred ) )
+	lock.lock();
+
     sc_msg_def * md = sc_report_handler::mdlookup(id_);
 
     if ( !md )
@@ -209,6 +220,17 @@ void sc_report_handler::report(sc_severity severity_,
 	severity_ = SC_ERROR;
 
     sc_actions actions = execute(md, severity_);
+    if ( SC_UNLIKELY_( deferred ) ) {
+	if ( severity_ == SC_ERROR )
+	    actions |= SC_THROW;
+	else if ( severity_ == SC_FATAL )
+	    actions |= SC_ABORT;
+	if ( actions != SC_DO_NOTHING )
+	    sc_parallel_evaluator::defer_report(
+		sc_report(severity_, md, msg_, file_, line_), actions );
+	return;
+    }
+
     sc_report rep(severity_, md, msg_, file_, line_);
 
     if ( actions & SC_CACHE_REPORT )
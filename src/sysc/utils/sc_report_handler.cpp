@@ -31,8 +31,10 @@
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <mutex>
 
 #include "sysc/kernel/sc_process.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
 #include "sysc/kernel/sc_simcontext_int.h"
 #include "sysc/utils/sc_stop_here.h"
 #include "sysc/utils/sc_report_handler.h"
@@ -331,20 +333,37 @@ void sc_report_handler::report( sc_severity severity_,
 				const char* file_, 
 				int line_ )
 {
-    sc_msg_def * md = mdlookup(msg_type_);
-
     // If the severity of the report is SC_INFO and the specified verbosity 
     // level is greater than the maximum verbosity level of the simulator then 
     // return without any action.
 
     if ( (severity_ == SC_INFO) && (verbosity_ > verbosity_level) ) return;
 
+    // A report of a method evaluated in parallel is filtered under a lock
+    // and passed to the handler after the batch:
+
+    const bool deferred = sc_parallel_evaluator::evaluating();
+    std::unique_lock<std::mutex> lock( sc_parallel_evaluator::report_mutex(),
+                                       std::defer_lock );
+    if ( SC_UNLIKELY_( deferred ) )
+	lock.lock();
+
+    sc_msg_def * md = mdlookup(msg_type_);
+
     // Process the report:
 
     if ( !md )
 	md = add_msg_type(msg_type_);
 
     sc_actions actions = execute(md, severity_);
+    if ( SC_UNLIKELY_( deferred ) ) {
+	if ( actions != SC_DO_NOTHING )
+	    sc_parallel_evaluator::defer_report(
+		sc_report(severity_, md, msg_, file_, line_, verbosity_),
+		actions );
+	return;
+    }
+
     sc_report rep(severity_, md, msg_, file_, line_, verbosity_);
 
     if ( actions & SC_CACHE_REPORT )
@@ -359,20 +378,35 @@ void sc_report_handler::report(sc_severity severity_,
 			       const char * file_,
 			       int line_)
 {
-    sc_msg_def * md = mdlookup(msg_type_);
-
     // If the severity of the report is SC_INFO and the maximum verbosity
     // level is less than SC_MEDIUM return without any action.
 
     if ( (severity_ == SC_INFO) && (SC_MEDIUM > verbosity_level) ) return;
 
-    // Process the report:
+    // A report of a method evaluated in parallel is filtered under a lock
+    // and passed to the handler after the batch:
+
+    const bool deferred = sc_parallel_evaluator::evaluating();
+    std::unique_lock<std::mutex> lock( sc_parallel_evaluator::report_mutex(),
+                                       std::defer_lock );
+    if ( SC_UNLIKELY_( deferred ) )
+	lock.lock();
+
+    sc_msg_def * md = mdlookup(msg_type_);
 
+    // Process the report:
 
     if ( !md )
 	md = add_msg_type(msg_type_);
 
     sc_actions actions = execute(md, severity_);
+    if ( SC_UNLIKELY_( deferred ) ) {
+	if ( actions != SC_DO_NOTHING )
+	    sc_parallel_evaluator::defer_report(
+		sc_report(severity_, md, msg_, file_, line_), actions );
+	return;
+    }
+
     sc_report rep(severity_, md, msg_, file_, line_);
 
     if ( actions & SC_CACHE_REPORT )
@@ -161,6 +161,7 @@ protected:
 private: // backward compatibility with 2.0+
 
     friend class sc_report;
+    friend class sc_parallel_evaluator; // passes deferred reports to handler
     static sc_msg_def* mdlookup(int id);
 
 public:
@@ -0,0 +1,312 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_timing_wheel.cpp - Timing wheel implementation of a priority queue.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/utils/sc_timing_wheel.h"
+#include "sysc/utils/sc_report.h"  // sc_assert
+
+#include <algorithm>
+
+namespace sc_core {
+
+namespace {
+
+typedef sc_timing_wheel_base::key_type key_type;
+
+const unsigned bits_per_word = 64;
+
+// index of the lowest set bit of a non-zero word
+inline unsigned
+lowest_bit( key_type word )
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>( __builtin_ctzll( word ) );
+#else
+    unsigned n = 0;
+    while( !( word & 1 ) ) {
+        word >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+} // anonymous namespace
+
+
+sc_timing_wheel_base::sc_timing_wheel_base( key_fn_t key,
+                                            unsigned slot_bits,
+                                            unsigned wheel_bits )
+  : m_key( key )
+  , m_slot_bits( slot_bits )
+  , m_slot_mask( 0 )
+  , m_buckets()
+  , m_occupied()
+  , m_cur( 0 )
+  , m_min( 0 )
+  , m_order( 0 )
+  , m_min_valid( false )
+  , m_wheel_size( 0 )
+  , m_size( 0 )
+  , m_overflow()
+{
+    // the wheel needs to fill at least one word of the occupied slot set
+    if( wheel_bits < 6 ) {
+        wheel_bits = 6;
+    }
+    m_slot_mask = ( key_type(1) << wheel_bits ) - 1;
+    m_buckets.resize( m_slot_mask + 1 );
+    m_occupied.resize( ( m_slot_mask + 1 ) / bits_per_word, 0 );
+}
+
+sc_timing_wheel_base::~sc_timing_wheel_base()
+{}
+
+void*
+sc_timing_wheel_base::extract_top()
+{
+    sc_assert( m_size > 0 );
+    entry e;
+
+    if( m_wheel_size ) {
+        bucket& b = min_bucket();
+        key_type slot = m_min;
+
+        e = b.entries[b.head++];
+        if( b.head == b.entries.size() ) {
+            b.entries.clear();
+            b.head = 0;
+            b.sorted = true;
+            key_type idx = slot & m_slot_mask;
+            m_occupied[idx / bits_per_word] &=
+              ~( key_type(1) << ( idx % bits_per_word ) );
+            m_min_valid = false;
+        }
+        m_wheel_size --;
+        turn( slot );
+    } else {
+        e = pop_overflow();
+        turn( e.key >> m_slot_bits );
+    }
+
+    m_size --;
+    return e.elem;
+}
+
+void
+sc_timing_wheel_base::insert( void* elem )
+{
+    entry e;
+    e.key   = m_key( elem );
+    e.order = m_order++;
+    e.elem  = elem;
+    key_type slot = e.key >> m_slot_bits;
+
+    if( m_size == 0 ) {
+        m_cur = slot;
+    } else if( slot < m_cur ) {
+        rewind( slot );
+    }
+
+    if( slot - m_cur > m_slot_mask ) {
+        push_overflow( e );
+    } else {
+        push_wheel( slot, e );
+    }
+    m_size ++;
+}
+
+// returns the bucket holding the smallest time stamp, sorted on demand
+
+sc_timing_wheel_base::bucket&
+sc_timing_wheel_base::min_bucket()
+{
+    if( !m_min_valid ) {
+        find_min();
+    }
+    bucket& b = m_buckets[m_min & m_slot_mask];
+    if( !b.sorted ) {
+        sc_assert( b.head == 0 );
+        std::stable_sort( b.entries.begin(), b.entries.end(),
+                          []( const entry& a, const entry& c )
+                            { return a.key < c.key; } );
+        b.sorted = true;
+    }
+    return b;
+}
+
+// scan the occupied slot set for the first non-empty slot of the wheel
+
+void
+sc_timing_wheel_base::find_min()
+{
+    sc_assert( m_wheel_size > 0 );
+    const key_type n_slots = m_slot_mask + 1;
+    const key_type start   = m_cur & m_slot_mask;
+    const std::size_t n_words = m_occupied.size();
+
+    std::size_t w = static_cast<std::size_t>( start / bits_per_word );
+    key_type word = m_occupied[w] &
+      ( ~key_type(0) << ( start % bits_per_word ) );
+
+    for( std::size_t i = 0; word == 0; ++i ) {
+        sc_assert( i < n_words );
+        w = ( w + 1 ) % n_words;
+        word = m_occupied[w];
+    }
+
+    key_type idx = w * bits_per_word + lowest_bit( word );
+    m_min = m_cur + ( ( idx + n_slots - start ) & m_slot_mask );
+    m_min_valid = true;
+}
+
+// advance the start of the wheel to the given slot and move elements,
+// which are no longer beyond the end of the wheel, out of the overflow heap
+
+void
+sc_timing_wheel_base::turn( key_type slot )
+{
+    sc_assert( slot >= m_cur );
+    m_cur = slot;
+    while( !m_overflow.empty() &&
+           ( m_overflow.front().key >> m_slot_bits ) - m_cur <= m_slot_mask ) {
+        entry e = pop_overflow();
+        push_wheel( e.key >> m_slot_bits, e );
+    }
+}
+
+// move the start of the wheel back to the given slot, elements beyond the
+// new end of the wheel are moved to the overflow heap
+
+void
+sc_timing_wheel_base::rewind( key_type slot )
+{
+    sc_assert( slot < m_cur );
+    key_type distance = m_cur - slot;
+
+    if( m_wheel_size ) {
+        if( distance > m_slot_mask ) {
+            for( key_type idx = 0; idx <= m_slot_mask; ++idx ) {
+                evict( idx );
+            }
+        } else {
+            for( key_type s = slot + m_slot_mask + 1; s <= m_cur + m_slot_mask;
+                 ++s ) {
+                evict( s & m_slot_mask );
+            }
+        }
+    }
+    m_cur = slot;
+    m_min_valid = false;
+}
+
+void
+sc_timing_wheel_base::evict( key_type idx )
+{
+    if( !( m_occupied[idx / bits_per_word] &
+           ( key_type(1) << ( idx % bits_per_word ) ) ) ) {
+        return;
+    }
+
+    bucket& b = m_buckets[idx];
+    for( std::size_t i = b.head; i < b.entries.size(); ++i ) {
+        push_overflow( b.entries[i] );
+        m_wheel_size --;
+    }
+    b.entries.clear();
+    b.head = 0;
+    b.sorted = true;
+    m_occupied[idx / bits_per_word] &=
+      ~( key_type(1) << ( idx % bits_per_word ) );
+}
+
+void
+sc_timing_wheel_base::push_wheel( key_type slot, const entry& e )
+{
+    key_type idx = slot & m_slot_mask;
+    bucket& b = m_buckets[idx];
+
+    if( b.entries.empty() ) {
+        b.entries.push_back( e );
+        m_occupied[idx / bits_per_word] |=
+          key_type(1) << ( idx % bits_per_word );
+    } else if( !b.sorted || e.key >= b.entries.back().key ) {
+        b.entries.push_back( e );
+    } else if( b.head != 0 ) {
+        // partially extracted bucket, keep it sorted
+        std::vector<entry>::iterator it =
+          std::upper_bound( b.entries.begin() + b.head, b.entries.end(), e,
+                            []( const entry& a, const entry& c )
+                              { return a.key < c.key; } );
+        b.entries.insert( it, e );
+    } else {
+        b.entries.push_back( e );
+        b.sorted = false;
+    }
+
+    if( m_wheel_size == 0 ) {
+        m_min = slot;
+        m_min_valid = true;
+    } else if( m_min_valid && slot < m_min ) {
+        m_min = slot;
+    }
+    m_wheel_size ++;
+}
+
+void
+sc_timing_wheel_base::push_overflow( const entry& e )
+{
+    m_overflow.push_back( e );
+    std::push_heap( m_overflow.begin(), m_overflow.end(), later );
+}
+
+// heap order of the overflow, earlier insertions first for equal keys
+bool
+sc_timing_wheel_base::later( const entry& a, const entry& b )
+{
+    return a.key != b.key ? a.key > b.key : a.order > b.order;
+}
+
+sc_timing_wheel_base::entry
+sc_timing_wheel_base::pop_overflow()
+{
+    std::pop_heap( m_overflow.begin(), m_overflow.end(), later );
+    entry e = m_overflow.back();
+    m_overflow.pop_back();
+    return e;
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
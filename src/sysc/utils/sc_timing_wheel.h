@@ -0,0 +1,200 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_timing_wheel.h -- A timing wheel (calendar queue), which can be used
+                       as a drop-in replacement of sc_ppq for elements
+                       ordered by an integer time stamp.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_TIMING_WHEEL_H_INCLUDED_
+#define SC_TIMING_WHEEL_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+
+#include <cstddef>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::vector
+#endif
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timing_wheel_base
+//
+//  Timing wheel base class.
+//
+//  The time line is divided into slots of 2^slot_bits time units. The wheel
+//  holds 2^wheel_bits consecutive slots, starting at the slot of the last
+//  extracted element. Each slot is a bucket, which is only sorted once its
+//  elements are about to be extracted. Elements beyond the end of the wheel
+//  are kept in an overflow heap and are moved into the wheel as it turns.
+//
+//  Insertion into the wheel is O(1) amortized, extraction of all elements
+//  with the same time stamp is O(1) per element, once the bucket is sorted.
+//  Elements with the same time stamp are extracted in insertion order.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_timing_wheel_base
+{
+public:
+
+    typedef sc_dt::uint64 key_type;
+    typedef key_type (*key_fn_t)( const void* );
+
+    sc_timing_wheel_base( key_fn_t key, unsigned slot_bits = 10,
+                          unsigned wheel_bits = 12 );
+
+    ~sc_timing_wheel_base();
+
+    void* top()
+        { return m_wheel_size ? min_bucket().front()
+                              : m_overflow.front().elem; }
+
+    void* extract_top();
+
+    void insert( void* elem );
+
+    int size() const
+        { return m_size; }
+
+    bool empty() const
+        { return (m_size == 0); }
+
+protected:
+
+    struct entry
+    {
+        key_type key;
+        key_type order;   // insertion count, orders equal time stamps
+        void*    elem;
+    };
+
+    struct bucket
+    {
+        bucket() : entries(), head(0), sorted(true) {}
+
+        void* front() const
+            { return entries[head].elem; }
+
+        std::vector<entry> entries; // elements of this slot
+        std::size_t        head;    // first not yet extracted element
+        bool               sorted;  // entries are ordered by time stamp
+    };
+
+    bucket& min_bucket();
+    void    find_min();
+    void    turn( key_type slot );
+    void    rewind( key_type slot );
+    void    push_wheel( key_type slot, const entry& e );
+    void    push_overflow( const entry& e );
+    static bool later( const entry& a, const entry& b );
+    entry   pop_overflow();
+    void    evict( key_type slot );
+
+private:
+
+    key_fn_t              m_key;         // time stamp of an element.
+    unsigned              m_slot_bits;   // log2 of the slot width.
+    key_type              m_slot_mask;   // # of slots - 1.
+    std::vector<bucket>   m_buckets;     // the wheel.
+    std::vector<key_type> m_occupied;    // bit set of non-empty slots.
+    key_type              m_cur;         // first slot of the wheel.
+    key_type              m_min;         // first non-empty slot.
+    key_type              m_order;       // # of insertions so far.
+    bool                  m_min_valid;   // m_min is up to date.
+    int                   m_wheel_size;  // # of elements in the wheel.
+    int                   m_size;        // # of elements in total.
+    std::vector<entry>    m_overflow;    // heap of far future elements.
+
+private:
+
+    // disabled
+    sc_timing_wheel_base( const sc_timing_wheel_base& );
+    sc_timing_wheel_base& operator = ( const sc_timing_wheel_base& );
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS TEMPLATE : sc_timing_wheel<T>
+//
+//  This class is a timing wheel with the interface of sc_ppq<T>. The class
+//  is templatized on its data type. A function returning the time stamp
+//  of an element needs to be supplied.
+// ----------------------------------------------------------------------------
+
+template <class T>
+class sc_timing_wheel
+    : public sc_timing_wheel_base
+{
+public:
+
+    // constructor - give the time stamp function and optionally the
+    // width of a slot and the number of slots (both as log2).
+
+    explicit sc_timing_wheel( key_fn_t key, unsigned slot_bits = 10,
+                              unsigned wheel_bits = 12 )
+        : sc_timing_wheel_base( key, slot_bits, wheel_bits )
+	{}
+
+    ~sc_timing_wheel()
+	{}
+
+    // returns the element with the smallest time stamp.
+    T top()
+	{ return (T) sc_timing_wheel_base::top(); }
+
+    // pops the element with the smallest time stamp.
+
+    T extract_top()
+	{ return (T) sc_timing_wheel_base::extract_top(); }
+
+    // insert a new element.
+
+    void insert( T elem )
+	{ sc_timing_wheel_base::insert( (void*) elem ); }
+
+    // size() and empty() are inherited.
+};
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#endif // SC_TIMING_WHEEL_H_INCLUDED_
+// Taf!
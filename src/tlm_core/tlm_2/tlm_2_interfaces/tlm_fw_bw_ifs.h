@@ -20,6 +20,7 @@
 #ifndef __TLM_FW_BW_IFS_H__
 #define __TLM_FW_BW_IFS_H__
 
+#include <cstddef>
 #include <systemc>
 #include "tlm_core/tlm_2/tlm_generic_payload/tlm_generic_payload.h"
 #include "tlm_core/tlm_2/tlm_2_interfaces/tlm_dmi.h"
@@ -54,6 +55,18 @@ class tlm_blocking_transport_if : public virtual sc_core::sc_interface {
 public:
   virtual void b_transport(TRANS& trans,
                            sc_core::sc_time& t) = 0;
+
+  // Vectored transport of n transactions, which are executed in order, as
+  // if b_transport was called for each of them with the same 't'. Targets
+  // and interconnects, which can share work between the transactions, e.g.
+  // address decoding or locking, override this loop.
+  virtual void b_transport_batch(TRANS** trans,
+                                 std::size_t n,
+                                 sc_core::sc_time& t)
+  {
+    for (std::size_t i = 0; i < n; ++i)
+      b_transport(*trans[i], t);
+  }
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,273 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+#ifndef __TLM_DMI_CACHE_H__
+#define __TLM_DMI_CACHE_H__
+
+#include "tlm_core/tlm_2/tlm_2_interfaces/tlm_fw_bw_ifs.h"
+#include "tlm_core/tlm_2/tlm_2_interfaces/tlm_dmi.h"
+#include "tlm_utils/tlm_quantumkeeper.h"
+
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+namespace tlm_utils {
+
+  //
+  // dmi_cache class
+  //
+  // Keeps the DMI regions, which an initiator got through one socket, and
+  // performs accesses through them:
+  //
+  //   dmi_cache<> m_dmi(initiator_socket, m_quantum_keeper);
+  //   ...
+  //   unsigned int data = m_dmi.read<unsigned int>(address);
+  //   m_dmi.write(address + 4, data);
+  //
+  // An access, which is covered by a DMI region, copies the data and adds
+  // the DMI latency to the quantum keeper. Otherwise the access is done with
+  // b_transport, and if the target allows DMI for it, the region is
+  // requested for the following accesses. In both cases, the quantum keeper
+  // is synchronized when needed, so the accesses must be made from an
+  // SC_THREAD.
+  //
+  // The regions are kept sorted by address and do not overlap. The
+  // initiator must forward invalidate_direct_mem_ptr calls to invalidate().
+  //
+  template <typename TYPES = tlm::tlm_base_protocol_types>
+  class dmi_cache
+  {
+  public:
+    typedef typename TYPES::tlm_payload_type               transaction_type;
+    typedef tlm::tlm_fw_transport_if<TYPES>                fw_interface_type;
+    typedef sc_core::sc_port_b<fw_interface_type>          port_type;
+
+    dmi_cache(port_type& port, tlm_quantumkeeper& quantum_keeper)
+      : m_port(port)
+      , m_quantum_keeper(quantum_keeper)
+      , m_last(0)
+    {
+    }
+
+    //
+    // Read or write a value of type T at the given address, in host byte
+    // order.
+    //
+    template <typename T>
+    T read(sc_dt::uint64 address)
+    {
+      T data;
+      access(tlm::TLM_READ_COMMAND, address,
+             reinterpret_cast<unsigned char*>(&data), sizeof(T));
+      return data;
+    }
+
+    template <typename T>
+    void write(sc_dt::uint64 address, const T& data)
+    {
+      T tmp(data);
+      access(tlm::TLM_WRITE_COMMAND, address,
+             reinterpret_cast<unsigned char*>(&tmp), sizeof(T));
+    }
+
+    //
+    // Read or write length bytes at the given address. Errors of the
+    // transport are reported and returned.
+    //
+    tlm::tlm_response_status access(tlm::tlm_command command,
+                                    sc_dt::uint64 address,
+                                    unsigned char* data,
+                                    unsigned int length)
+    {
+      const tlm::tlm_dmi* dmi = find(address, length, command);
+      if (dmi)
+      {
+        unsigned char* p =
+          dmi->get_dmi_ptr() + (address - dmi->get_start_address());
+        if (command == tlm::TLM_READ_COMMAND)
+        {
+          std::memcpy(data, p, length);
+          m_quantum_keeper.inc(dmi->get_read_latency());
+        }
+        else
+        {
+          std::memcpy(p, data, length);
+          m_quantum_keeper.inc(dmi->get_write_latency());
+        }
+        if (m_quantum_keeper.need_sync())
+          m_quantum_keeper.sync();
+        return tlm::TLM_OK_RESPONSE;
+      }
+      return transport(command, address, data, length);
+    }
+
+    //
+    // The DMI region, which allows the access, or 0
+    //
+    const tlm::tlm_dmi* find(sc_dt::uint64 address,
+                             unsigned int length,
+                             tlm::tlm_command command) const
+    {
+      if (m_regions.empty() || length == 0)
+        return 0;
+
+      // most accesses hit the region of the previous one
+      std::size_t i = m_last;
+      if (i >= m_regions.size() || !contains(m_regions[i], address))
+      {
+        i = lookup(address);
+        if (i == m_regions.size())
+          return 0;
+        m_last = i;
+      }
+
+      const tlm::tlm_dmi& dmi = m_regions[i];
+      if (length - 1 > dmi.get_end_address() - address)
+        return 0;
+      if (command == tlm::TLM_READ_COMMAND ? !dmi.is_read_allowed()
+                                           : !dmi.is_write_allowed())
+        return 0;
+      return &dmi;
+    }
+
+    //
+    // Add a region, which replaces the regions it overlaps
+    //
+    void insert(const tlm::tlm_dmi& dmi)
+    {
+      if (!dmi.get_dmi_ptr() || dmi.is_none_allowed() ||
+          dmi.get_end_address() < dmi.get_start_address())
+        return;
+
+      invalidate(dmi.get_start_address(), dmi.get_end_address());
+      std::size_t i = first_ending_after(dmi.get_start_address());
+      m_regions.insert(m_regions.begin() + i, dmi);
+    }
+
+    //
+    // Drop all regions, which overlap the given address range
+    //
+    void invalidate(sc_dt::uint64 start_range, sc_dt::uint64 end_range)
+    {
+      typename std::vector<tlm::tlm_dmi>::iterator first =
+        m_regions.begin() + first_ending_after(start_range);
+      typename std::vector<tlm::tlm_dmi>::iterator last = first;
+      while (last != m_regions.end() &&
+             last->get_start_address() <= end_range)
+        ++last;
+      m_regions.erase(first, last);
+      m_last = 0;
+    }
+
+    void clear()
+    {
+      m_regions.clear();
+      m_last = 0;
+    }
+
+    std::size_t size() const { return m_regions.size(); }
+
+  private:
+    static bool contains(const tlm::tlm_dmi& dmi, sc_dt::uint64 address)
+    {
+      return dmi.get_start_address() <= address &&
+             address <= dmi.get_end_address();
+    }
+
+    // index of the first region, which does not end before the address
+    std::size_t first_ending_after(sc_dt::uint64 address) const
+    {
+      std::size_t low = 0, high = m_regions.size();
+      while (low < high)
+      {
+        std::size_t mid = low + (high - low) / 2;
+        if (m_regions[mid].get_end_address() < address)
+          low = mid + 1;
+        else
+          high = mid;
+      }
+      return low;
+    }
+
+    // index of the region containing the address, or m_regions.size()
+    std::size_t lookup(sc_dt::uint64 address) const
+    {
+      std::size_t i = first_ending_after(address);
+      if (i < m_regions.size() && contains(m_regions[i], address))
+        return i;
+      return m_regions.size();
+    }
+
+    tlm::tlm_response_status transport(tlm::tlm_command command,
+                                       sc_dt::uint64 address,
+                                       unsigned char* data,
+                                       unsigned int length)
+    {
+      transaction_type& trans = m_payload;
+      trans.set_command(command);
+      trans.set_address(address);
+      trans.set_data_ptr(data);
+      trans.set_data_length(length);
+      trans.set_streaming_width(length);
+      trans.set_byte_enable_ptr(0);
+      trans.set_dmi_allowed(false);
+      trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+
+      sc_core::sc_time delay = m_quantum_keeper.get_local_time();
+      m_port->b_transport(trans, delay);
+      m_quantum_keeper.set(delay);
+
+      tlm::tlm_response_status status = trans.get_response_status();
+      if (trans.is_response_error())
+      {
+        std::stringstream s;
+        s << m_port.name() << ": " << trans.get_response_string()
+          << " for address 0x" << std::hex << address;
+        SC_REPORT_ERROR("/OSCI_TLM-2/dmi_cache", s.str().c_str());
+      }
+      else if (trans.is_dmi_allowed())
+      {
+        tlm::tlm_dmi dmi;
+        trans.set_address(address);
+        if (m_port->get_direct_mem_ptr(trans, dmi))
+          insert(dmi);
+      }
+
+      if (m_quantum_keeper.need_sync())
+        m_quantum_keeper.sync();
+      return status;
+    }
+
+  private:
+    port_type&                m_port;
+    tlm_quantumkeeper&        m_quantum_keeper;
+    std::vector<tlm::tlm_dmi> m_regions;    // sorted, not overlapping
+    mutable std::size_t       m_last;       // region of the last access
+    transaction_type          m_payload;    // for the transport fallback
+
+  private:
+    // disabled
+    dmi_cache(const dmi_cache&);
+    dmi_cache& operator=(const dmi_cache&);
+  };
+
+} // namespace tlm_utils
+
+#endif // __TLM_DMI_CACHE_H__
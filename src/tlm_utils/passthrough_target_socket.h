@@ -68,6 +68,15 @@ public:
     m_process.set_b_transport_ptr(mod, cb);
   }
 
+  // optional, in addition to the blocking callback
+  void register_b_transport_batch(MODULE* mod,
+                                  void (MODULE::*cb)(transaction_type**,
+                                                     std::size_t,
+                                                     sc_core::sc_time&))
+  {
+    m_process.set_b_transport_batch_ptr(mod, cb);
+  }
+
   void register_transport_dbg(MODULE* mod,
                               unsigned int (MODULE::*cb)(transaction_type&))
   {
@@ -92,6 +101,9 @@ private:
                                                      sc_core::sc_time&);
     typedef void (MODULE::*BTransportPtr)(transaction_type&,
                                             sc_core::sc_time&);
+    typedef void (MODULE::*BTransportBatchPtr)(transaction_type**,
+                                                 std::size_t,
+                                                 sc_core::sc_time&);
     typedef unsigned int (MODULE::*TransportDbgPtr)(transaction_type&);
     typedef bool (MODULE::*GetDirectMem_ptr)(transaction_type&,
                                                tlm::tlm_dmi&);
@@ -100,6 +112,7 @@ private:
       : convenience_socket_cb_holder(owner), m_mod(0)
       , m_nb_transport_ptr(0)
       , m_b_transport_ptr(0)
+      , m_b_transport_batch_ptr(0)
       , m_transport_dbg_ptr(0)
       , m_get_direct_mem_ptr(0)
     {
@@ -127,6 +140,17 @@ private:
       m_b_transport_ptr = p;
     }
 
+    void set_b_transport_batch_ptr(MODULE* mod, BTransportBatchPtr p)
+    {
+      if (m_b_transport_batch_ptr) {
+        display_warning("blocking batch callback already registered");
+        return;
+      }
+      sc_assert(!m_mod || m_mod == mod);
+      m_mod = mod;
+      m_b_transport_batch_ptr = p;
+    }
+
     void set_transport_dbg_ptr(MODULE* mod, TransportDbgPtr p)
     {
       if (m_transport_dbg_ptr) {
@@ -172,6 +196,18 @@ private:
       display_error("no blocking callback registered");
     }
 
+    void b_transport_batch(transaction_type** trans, std::size_t n,
+                           sc_core::sc_time& t)
+    {
+      if (m_b_transport_batch_ptr) {
+        // forward call
+        sc_assert(m_mod);
+        return (m_mod->*m_b_transport_batch_ptr)(trans, n, t);
+      }
+      for (std::size_t i = 0; i < n; ++i)
+        b_transport(*trans[i], t);
+    }
+
     unsigned int transport_dbg(transaction_type& trans)
     {
       if (m_transport_dbg_ptr) {
@@ -202,6 +238,7 @@ private:
     MODULE* m_mod;
     NBTransportPtr m_nb_transport_ptr;
     BTransportPtr m_b_transport_ptr;
+    BTransportBatchPtr m_b_transport_batch_ptr;
     TransportDbgPtr m_transport_dbg_ptr;
     GetDirectMem_ptr m_get_direct_mem_ptr;
   };
@@ -284,6 +321,18 @@ public:
     m_process.set_b_transport_user_id(id);
   }
 
+  // optional, in addition to the blocking callback
+  void register_b_transport_batch(MODULE* mod,
+                                  void (MODULE::*cb)(int id,
+                                                     transaction_type**,
+                                                     std::size_t,
+                                                     sc_core::sc_time&),
+                                  int id)
+  {
+    m_process.set_b_transport_batch_ptr(mod, cb);
+    m_process.set_b_transport_batch_user_id(id);
+  }
+
   void register_transport_dbg(MODULE* mod,
                               unsigned int (MODULE::*cb)(int id,
                                                          transaction_type&),
@@ -316,6 +365,10 @@ private:
     typedef void (MODULE::*BTransportPtr)(int id,
                                           transaction_type&,
                                           sc_core::sc_time&);
+    typedef void (MODULE::*BTransportBatchPtr)(int id,
+                                               transaction_type**,
+                                               std::size_t,
+                                               sc_core::sc_time&);
     typedef unsigned int (MODULE::*TransportDbgPtr)(int id,
                                                     transaction_type&);
     typedef bool (MODULE::*GetDirectMem_ptr)(int id,
@@ -326,10 +379,12 @@ private:
       : convenience_socket_cb_holder(owner), m_mod(0)
       , m_nb_transport_ptr(0)
       , m_b_transport_ptr(0)
+      , m_b_transport_batch_ptr(0)
       , m_transport_dbg_ptr(0)
       , m_get_direct_mem_ptr(0)
       , m_nb_transport_user_id(0)
       , m_b_transport_user_id(0)
+      , m_b_transport_batch_user_id(0)
       , m_transport_dbg_user_id(0)
       , m_get_dmi_user_id(0)
     {
@@ -337,6 +392,7 @@ private:
 
     void set_nb_transport_user_id(int id) { m_nb_transport_user_id = id; }
     void set_b_transport_user_id(int id) { m_b_transport_user_id = id; }
+    void set_b_transport_batch_user_id(int id) { m_b_transport_batch_user_id = id; }
     void set_transport_dbg_user_id(int id) { m_transport_dbg_user_id = id; }
     void set_get_dmi_user_id(int id) { m_get_dmi_user_id = id; }
 
@@ -362,6 +418,17 @@ private:
       m_b_transport_ptr = p;
     }
 
+    void set_b_transport_batch_ptr(MODULE* mod, BTransportBatchPtr p)
+    {
+      if (m_b_transport_batch_ptr) {
+        display_warning("blocking batch callback already registered");
+        return;
+      }
+      sc_assert(!m_mod || m_mod == mod);
+      m_mod = mod;
+      m_b_transport_batch_ptr = p;
+    }
+
     void set_transport_dbg_ptr(MODULE* mod, TransportDbgPtr p)
     {
       if (m_transport_dbg_ptr) {
@@ -407,6 +474,18 @@ private:
       display_error("no blocking callback registered");
     }
 
+    void b_transport_batch(transaction_type** trans, std::size_t n,
+                           sc_core::sc_time& t)
+    {
+      if (m_b_transport_batch_ptr) {
+        // forward call
+        sc_assert(m_mod);
+        return (m_mod->*m_b_transport_batch_ptr)(m_b_transport_batch_user_id, trans, n, t);
+      }
+      for (std::size_t i = 0; i < n; ++i)
+        b_transport(*trans[i], t);
+    }
+
     unsigned int transport_dbg(transaction_type& trans)
     {
       if (m_transport_dbg_ptr) {
@@ -437,10 +516,12 @@ private:
     MODULE* m_mod;
     NBTransportPtr m_nb_transport_ptr;
     BTransportPtr m_b_transport_ptr;
+    BTransportBatchPtr m_b_transport_batch_ptr;
     TransportDbgPtr m_transport_dbg_ptr;
     GetDirectMem_ptr m_get_direct_mem_ptr;
     int m_nb_transport_user_id;
     int m_b_transport_user_id;
+    int m_b_transport_batch_user_id;
     int m_transport_dbg_user_id;
     int m_get_dmi_user_id;
   };
@@ -0,0 +1,385 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+#ifndef __TLM_PAYLOAD_POOL_H__
+#define __TLM_PAYLOAD_POOL_H__
+
+#include "tlm_core/tlm_2/tlm_generic_payload/tlm_gp.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace tlm_utils {
+
+  //
+  // payload_pool class
+  //
+  // A memory manager for generic payloads, which recycles the payloads
+  // instead of allocating them for every transaction:
+  //
+  //   tlm::tlm_generic_payload* trans = pool.allocate(4);
+  //   trans->acquire();
+  //   ...
+  //   trans->release();   // returns the payload to the pool
+  //
+  // The payloads are created in blocks, each with its extension array and
+  // a data buffer of inline_data_size bytes, which allocate(length) uses
+  // for short accesses. Longer buffers are allocated once per payload and
+  // kept for later transactions.
+  //
+  // Each host thread keeps its own free list for up to max_local_lists
+  // pools, so allocate() and free() only take the lock of the pool to
+  // exchange a batch of payloads. Other pools use the shared free list.
+  // The free lists carry the generation of their pool, a thread reuses a
+  // list whose pool has since been reset or destroyed. The free list of a
+  // thread, which exits, is only reclaimed by reset().
+  //
+  // When a payload is returned, its extensions are treated like by
+  // tlm_generic_payload::reset(), and the attributes are restored to the
+  // values of a newly constructed payload.
+  //
+  class payload_pool : public tlm::tlm_mm_interface
+  {
+  public:
+    enum { inline_data_size = 64 };
+
+    explicit payload_pool(unsigned int preallocate = 0)
+      : m_state(std::make_shared<pool_state>())
+      , m_free(0)
+      , m_size(0)
+      , m_resetting(false)
+    {
+      if (preallocate)
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        grow(preallocate);
+      }
+    }
+
+    ~payload_pool()
+    {
+      m_state->generation.store(0);   // invalidates the free lists
+      release_local_list();
+      for (std::size_t i = 0; i < m_blocks.size(); ++i)
+        delete[] m_blocks[i];
+    }
+
+    //
+    // Get a payload without a data buffer. The reference count of the
+    // payload is zero, the caller acquires it as usual.
+    //
+    tlm::tlm_generic_payload* allocate()
+    {
+      return pop();
+    }
+
+    //
+    // Get a payload with a data buffer of the given length, which is also
+    // set as the streaming width.
+    //
+    tlm::tlm_generic_payload* allocate(unsigned int length)
+    {
+      payload* trans = pop();
+      trans->set_data_ptr(trans->buffer(length));
+      trans->set_data_length(length);
+      trans->set_streaming_width(length);
+      return trans;
+    }
+
+    //
+    // Called by tlm_generic_payload::release(), when the last reference is
+    // released.
+    //
+    virtual void free(tlm::tlm_generic_payload* trans)
+    {
+      if (m_resetting)
+        return;
+      payload* p = static_cast<payload*>(trans);
+      p->clear();
+      push(p);
+    }
+
+    //
+    // Return all payloads to the pool at once, e.g. at the end of a test,
+    // in which transactions were abandoned. No payload must be in use, and
+    // no other thread must use the pool meanwhile.
+    //
+    void reset()
+    {
+      ++m_state->generation;          // invalidates the free lists
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_resetting = true;
+      m_free = 0;
+      for (std::size_t i = m_blocks.size(); i-- > 0; )
+      {
+        for (unsigned int j = m_block_sizes[i]; j-- > 0; )
+        {
+          payload* p = &m_blocks[i][j];
+          while (p->get_ref_count())
+            p->release();
+          p->clear();
+          p->m_next = m_free;
+          m_free = p;
+        }
+      }
+      m_resetting = false;
+    }
+
+    //
+    // The number of payloads created by the pool.
+    //
+    std::size_t size() const
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_size;
+    }
+
+  private:
+    enum
+    {
+      max_local_lists = 4,      // pools with a free list per thread
+      local_limit     = 256,    // payloads kept in a free list of a thread
+      batch_size      = 32      // payloads moved to or from the shared list
+    };
+
+    class payload : public tlm::tlm_generic_payload
+    {
+    public:
+      payload()
+        : m_next(0)
+        , m_heap_data(0)
+        , m_heap_size(0)
+      {
+      }
+
+      ~payload()
+      {
+        delete[] m_heap_data;
+      }
+
+      unsigned char* buffer(unsigned int length)
+      {
+        if (length <= inline_data_size)
+          return m_data;
+        if (length > m_heap_size)
+        {
+          delete[] m_heap_data;
+          m_heap_data = new unsigned char[length];
+          m_heap_size = length;
+        }
+        return m_heap_data;
+      }
+
+      void clear()
+      {
+        reset();
+        set_command(tlm::TLM_IGNORE_COMMAND);
+        set_address(0);
+        set_data_ptr(0);
+        set_data_length(0);
+        set_streaming_width(0);
+        set_byte_enable_ptr(0);
+        set_byte_enable_length(0);
+        set_dmi_allowed(false);
+        set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+      }
+
+      payload*       m_next;
+      unsigned char* m_heap_data;
+      unsigned int   m_heap_size;
+      alignas(8) unsigned char m_data[inline_data_size];
+    };
+
+    // shared with the free lists of the threads, which may outlive the pool
+    struct pool_state
+    {
+      pool_state() : generation(1) {}
+
+      std::atomic<unsigned long long> generation;   // 0 once destroyed
+    };
+
+    struct local_list
+    {
+      local_list() : generation(0), head(0), count(0) {}
+
+      bool stale() const
+      {
+        return !state
+            || generation != state->generation.load(std::memory_order_relaxed);
+      }
+
+      std::shared_ptr<pool_state> state;      // of the pool, 0 if unused
+      unsigned long long          generation; // of the pool, when started
+      payload*                    head;
+      unsigned int                count;
+    };
+
+    static local_list* local_lists()
+    {
+      static thread_local local_list lists[max_local_lists];
+      return lists;
+    }
+
+    // the free list of the calling thread, 0 if all are used by other pools
+    local_list* local()
+    {
+      local_list* lists = local_lists();
+      for (int i = 0; i < max_local_lists; ++i)
+      {
+        if (lists[i].state == m_state)
+        {
+          // the payloads of an older generation came back with reset()
+          if (lists[i].stale())
+            start(lists[i]);
+          return &lists[i];
+        }
+      }
+      for (int i = 0; i < max_local_lists; ++i)
+      {
+        if (lists[i].stale())
+        {
+          start(lists[i]);
+          return &lists[i];
+        }
+      }
+      return 0;
+    }
+
+    void start(local_list& list)
+    {
+      list.state = m_state;
+      list.generation = m_state->generation.load(std::memory_order_relaxed);
+      list.head = 0;
+      list.count = 0;
+    }
+
+    // drop the free list of the calling thread; the payloads in the free
+    // lists of other threads only come back with reset()
+    void release_local_list()
+    {
+      local_list* lists = local_lists();
+      for (int i = 0; i < max_local_lists; ++i)
+        if (lists[i].state == m_state)
+          lists[i] = local_list();
+    }
+
+    payload* pop()
+    {
+      local_list* list = local();
+      std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+      payload* p;
+      if (list)
+      {
+        if (!list->head)
+        {
+          lock.lock();
+          if (!m_free)
+            grow(m_size < batch_size ? std::size_t(batch_size) : m_size);
+          for (int i = 0; i < batch_size && m_free; ++i)
+          {
+            p = m_free;
+            m_free = p->m_next;
+            p->m_next = list->head;
+            list->head = p;
+            ++list->count;
+          }
+        }
+        p = list->head;
+        list->head = p->m_next;
+        --list->count;
+      }
+      else
+      {
+        lock.lock();
+        if (!m_free)
+          grow(m_size < batch_size ? std::size_t(batch_size) : m_size);
+        p = m_free;
+        m_free = p->m_next;
+      }
+      p->m_next = 0;
+      return p;
+    }
+
+    void push(payload* p)
+    {
+      local_list* list = local();
+      if (list)
+      {
+        p->m_next = list->head;
+        list->head = p;
+        if (++list->count <= local_limit)
+          return;
+
+        // pass a batch on, so other threads can use it
+        payload* first = list->head;
+        payload* last = first;
+        for (int i = 1; i < batch_size; ++i)
+          last = last->m_next;
+        list->head = last->m_next;
+        list->count -= batch_size;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        last->m_next = m_free;
+        m_free = first;
+      }
+      else
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        p->m_next = m_free;
+        m_free = p;
+      }
+    }
+
+    // called with the lock held
+    void grow(std::size_t n)
+    {
+      payload* block = new payload[n];
+      m_blocks.push_back(block);
+      m_block_sizes.push_back(static_cast<unsigned int>(n));
+      m_size += n;
+      for (std::size_t i = n; i-- > 0; )
+      {
+        block[i].set_mm(this);
+        block[i].m_next = m_free;
+        m_free = &block[i];
+      }
+    }
+
+  private:
+    std::shared_ptr<pool_state> m_state;
+    mutable std::mutex        m_mutex;
+    payload*                  m_free;         // shared free list
+    std::vector<payload*>     m_blocks;
+    std::vector<unsigned int> m_block_sizes;
+    std::size_t               m_size;
+    bool                      m_resetting;    // in reset()
+
+  private:
+    // disabled
+    payload_pool(const payload_pool&);
+    payload_pool& operator=(const payload_pool&);
+  };
+
+} // namespace tlm_utils
+
+#endif // __TLM_PAYLOAD_POOL_H__
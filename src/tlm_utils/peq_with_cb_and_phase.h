@@ -31,6 +31,7 @@
 #include <vector>
 #include <systemc>
 #include <tlm>
+#include "tlm_utils/time_ordered_wheel.h"
 
 namespace tlm_utils {
 
@@ -288,7 +289,7 @@ private:
   OWNER* m_owner;
   cb     m_cb;
 
-  time_ordered_list<PAYLOAD> m_ppq;
+  time_ordered_wheel<PAYLOAD> m_ppq;
   delta_list m_uneven_delta;
   delta_list m_even_delta;
   delta_list m_immediate_yield;
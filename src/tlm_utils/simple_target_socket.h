@@ -96,6 +96,16 @@ public:
     m_fw_process.set_b_transport_ptr(mod, cb);
   }
 
+  // optional, in addition to the blocking callback
+  void register_b_transport_batch(MODULE* mod,
+                                  void (MODULE::*cb)(transaction_type**,
+                                                     std::size_t,
+                                                     sc_core::sc_time&))
+  {
+    elaboration_check("register_b_transport_batch");
+    m_fw_process.set_b_transport_batch_ptr(mod, cb);
+  }
+
   void register_transport_dbg(MODULE* mod,
                               unsigned int (MODULE::*cb)(transaction_type&))
   {
@@ -185,6 +195,9 @@ private:
                                                      sc_core::sc_time&);
     typedef void (MODULE::*BTransportPtr)(transaction_type&,
                                           sc_core::sc_time&);
+    typedef void (MODULE::*BTransportBatchPtr)(transaction_type**,
+                                               std::size_t,
+                                               sc_core::sc_time&);
     typedef unsigned int (MODULE::*TransportDbgPtr)(transaction_type&);
     typedef bool (MODULE::*GetDirectMemPtr)(transaction_type&,
                                             tlm::tlm_dmi&);
@@ -194,6 +207,7 @@ private:
       m_mod(0),
       m_nb_transport_ptr(0),
       m_b_transport_ptr(0),
+      m_b_transport_batch_ptr(0),
       m_transport_dbg_ptr(0),
       m_get_direct_mem_ptr(0),
       m_peq(sc_core::sc_gen_unique_name("m_peq")),
@@ -233,6 +247,17 @@ private:
       m_b_transport_ptr = p;
     }
 
+    void set_b_transport_batch_ptr(MODULE* mod, BTransportBatchPtr p)
+    {
+      if (m_b_transport_batch_ptr) {
+        m_owner->display_warning("blocking batch callback already registered");
+        return;
+      }
+      sc_assert(!m_mod || m_mod == mod);
+      m_mod = mod;
+      m_b_transport_batch_ptr = p;
+    }
+
     void set_transport_dbg_ptr(MODULE* mod, TransportDbgPtr p)
     {
       if (m_transport_dbg_ptr) {
@@ -343,6 +368,21 @@ private:
       m_owner->display_error("no blocking transport callback registered");
     }
 
+    void b_transport_batch(transaction_type** trans, std::size_t n,
+                           sc_core::sc_time& t)
+    {
+      if (m_b_transport_batch_ptr) {
+        // forward call
+        sc_assert(m_mod);
+        (m_mod->*m_b_transport_batch_ptr)(trans, n, t);
+        return;
+      }
+
+      // one call per transaction
+      for (std::size_t i = 0; i < n; ++i)
+        b_transport(*trans[i], t);
+    }
+
     unsigned int transport_dbg(transaction_type& trans)
     {
       if (m_transport_dbg_ptr) {
@@ -537,6 +577,7 @@ private:
     MODULE* m_mod;
     NBTransportPtr m_nb_transport_ptr;
     BTransportPtr m_b_transport_ptr;
+    BTransportBatchPtr m_b_transport_batch_ptr;
     TransportDbgPtr m_transport_dbg_ptr;
     GetDirectMemPtr m_get_direct_mem_ptr;
     peq_with_get<transaction_type> m_peq;
@@ -634,6 +675,19 @@ public:
     m_fw_process.set_b_transport_user_id(id);
   }
 
+  // optional, in addition to the blocking callback
+  void register_b_transport_batch(MODULE* mod,
+                                  void (MODULE::*cb)(int id,
+                                                     transaction_type**,
+                                                     std::size_t,
+                                                     sc_core::sc_time&),
+                                  int id)
+  {
+    elaboration_check("register_b_transport_batch");
+    m_fw_process.set_b_transport_batch_ptr(mod, cb);
+    m_fw_process.set_b_transport_batch_user_id(id);
+  }
+
   void register_transport_dbg(MODULE* mod,
                               unsigned int (MODULE::*cb)(int id,
                                                          transaction_type&),
@@ -729,6 +783,10 @@ private:
     typedef void (MODULE::*BTransportPtr)(int id,
                                           transaction_type&,
                                           sc_core::sc_time&);
+    typedef void (MODULE::*BTransportBatchPtr)(int id,
+                                               transaction_type**,
+                                               std::size_t,
+                                               sc_core::sc_time&);
     typedef unsigned int (MODULE::*TransportDbgPtr)(int id,
                                                     transaction_type&);
     typedef bool (MODULE::*GetDirectMemPtr)(int id,
@@ -740,10 +798,12 @@ private:
       m_mod(0),
       m_nb_transport_ptr(0),
       m_b_transport_ptr(0),
+      m_b_transport_batch_ptr(0),
       m_transport_dbg_ptr(0),
       m_get_direct_mem_ptr(0),
       m_nb_transport_user_id(0),
       m_b_transport_user_id(0),
+      m_b_transport_batch_user_id(0),
       m_transport_dbg_user_id(0),
       m_get_dmi_user_id(0),
       m_peq(sc_core::sc_gen_unique_name("m_peq")),
@@ -763,6 +823,7 @@ private:
 
     void set_nb_transport_user_id(int id) { m_nb_transport_user_id = id; }
     void set_b_transport_user_id(int id) { m_b_transport_user_id = id; }
+    void set_b_transport_batch_user_id(int id) { m_b_transport_batch_user_id = id; }
     void set_transport_dbg_user_id(int id) { m_transport_dbg_user_id = id; }
     void set_get_dmi_user_id(int id) { m_get_dmi_user_id = id; }
 
@@ -788,6 +849,17 @@ private:
       m_b_transport_ptr = p;
     }
 
+    void set_b_transport_batch_ptr(MODULE* mod, BTransportBatchPtr p)
+    {
+      if (m_b_transport_batch_ptr) {
+        m_owner->display_warning("blocking batch callback already registered");
+        return;
+      }
+      sc_assert(!m_mod || m_mod == mod);
+      m_mod = mod;
+      m_b_transport_batch_ptr = p;
+    }
+
     void set_transport_dbg_ptr(MODULE* mod, TransportDbgPtr p)
     {
       if (m_transport_dbg_ptr) {
@@ -896,6 +968,21 @@ private:
       m_owner->display_error("no transport callback registered");
     }
 
+    void b_transport_batch(transaction_type** trans, std::size_t n,
+                           sc_core::sc_time& t)
+    {
+      if (m_b_transport_batch_ptr) {
+        // forward call
+        sc_assert(m_mod);
+        (m_mod->*m_b_transport_batch_ptr)(m_b_transport_batch_user_id, trans, n, t);
+        return;
+      }
+
+      // one call per transaction
+      for (std::size_t i = 0; i < n; ++i)
+        b_transport(*trans[i], t);
+    }
+
     unsigned int transport_dbg(transaction_type& trans)
     {
       if (m_transport_dbg_ptr) {
@@ -1088,10 +1175,12 @@ private:
     MODULE* m_mod;
     NBTransportPtr m_nb_transport_ptr;
     BTransportPtr m_b_transport_ptr;
+    BTransportBatchPtr m_b_transport_batch_ptr;
     TransportDbgPtr m_transport_dbg_ptr;
     GetDirectMemPtr m_get_direct_mem_ptr;
     int m_nb_transport_user_id;
     int m_b_transport_user_id;
+    int m_b_transport_batch_user_id;
     int m_transport_dbg_user_id;
     int m_get_dmi_user_id;
     peq_with_get<transaction_type> m_peq;
@@ -0,0 +1,155 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+#ifndef __TLM_TIME_ORDERED_WHEEL_H__
+#define __TLM_TIME_ORDERED_WHEEL_H__
+
+#include <systemc>
+#include "sysc/utils/sc_timing_wheel.h"
+#include <vector>
+
+namespace tlm_utils {
+
+  //
+  // time_ordered_wheel class
+  //
+  // Time ordered queue of the payload event queues, with the interface of
+  // time_ordered_list. The elements are kept in an sc_core::sc_timing_wheel
+  // with slots of about a nanosecond, so that a notification for the near
+  // future is inserted in constant time. Notifications for the same time
+  // come out in the order they were inserted. The elements are recycled.
+  //
+  template <typename PAYLOAD>
+  class time_ordered_wheel
+  {
+  public:
+    time_ordered_wheel()
+      : m_wheel(0)
+      , m_empties(0)
+    {
+    }
+
+    ~time_ordered_wheel()
+    {
+      delete m_wheel;
+      for (std::size_t i = 0; i < m_blocks.size(); ++i)
+        delete[] m_blocks[i];
+    }
+
+    void insert(const PAYLOAD& p, const sc_core::sc_time& t)
+    {
+      if (!m_wheel)
+        create();
+
+      element* e = allocate();
+      e->p = p;
+      e->t = t.value();
+      m_wheel->insert(e);
+    }
+
+    void delete_top()
+    {
+      if (get_size())
+        release(m_wheel->extract_top());
+    }
+
+    void reset()
+    {
+      while (get_size())
+        delete_top();
+    }
+
+    unsigned int get_size() const
+    {
+      return m_wheel ? m_wheel->size() : 0;
+    }
+
+    PAYLOAD& top()
+    {
+      return m_wheel->top()->p;
+    }
+
+    sc_core::sc_time top_time()
+    {
+      return get_size() ? sc_core::sc_time::from_value(m_wheel->top()->t)
+                        : sc_core::SC_ZERO_TIME;
+    }
+
+  private:
+    enum { wheel_bits = 10, block_size = 64 };
+
+    struct element
+    {
+      element*       next;       // in the list of empties
+      PAYLOAD        p;
+      sc_dt::uint64  t;          // in time resolution units
+    };
+
+    static sc_dt::uint64 key(const void* e)
+    {
+      return static_cast<const element*>(e)->t;
+    }
+
+    // the wheel is created for the first notification, when the time
+    // resolution has been fixed
+    void create()
+    {
+      double ns = sc_core::sc_time(1, sc_core::SC_NS) /
+                  sc_core::sc_get_time_resolution();
+      unsigned slot_bits = 0;
+      while ((2 << slot_bits) <= ns)
+        ++slot_bits;
+      m_wheel = new sc_core::sc_timing_wheel<element*>(&key, slot_bits,
+                                                       wheel_bits);
+    }
+
+    element* allocate()
+    {
+      if (!m_empties)
+      {
+        element* block = new element[block_size];
+        m_blocks.push_back(block);
+        for (int i = 0; i < block_size; ++i)
+          release(block + i);
+      }
+      element* e = m_empties;
+      m_empties = e->next;
+      return e;
+    }
+
+    void release(element* e)
+    {
+      e->next = m_empties;
+      m_empties = e;
+    }
+
+  private:
+    sc_core::sc_timing_wheel<element*>* m_wheel;
+    element*                            m_empties;
+    std::vector<element*>               m_blocks;
+
+  private:
+    // disabled
+    time_ordered_wheel(const time_ordered_wheel&);
+    time_ordered_wheel& operator=(const time_ordered_wheel&);
+  };
+
+} // namespace tlm_utils
+
+#endif // __TLM_TIME_ORDERED_WHEEL_H__
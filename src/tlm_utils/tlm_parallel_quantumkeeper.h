@@ -0,0 +1,299 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+#ifndef __TLM_PARALLEL_QUANTUMKEEPER_H__
+#define __TLM_PARALLEL_QUANTUMKEEPER_H__
+
+#include "tlm_utils/tlm_quantumkeeper.h"
+#include <systemc>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace tlm_utils {
+
+  //
+  // tlm_parallel_quantumkeeper class
+  //
+  // A quantum keeper, whose initiator runs each quantum on a host thread of
+  // its own, in parallel to the other initiators with a parallel quantum
+  // keeper. The initiator is an SC_THREAD, which calls run() with the
+  // function to execute on the host thread. This function uses the quantum
+  // keeper like a tlm_quantumkeeper.
+  //
+  // While a host thread runs, the SC_THREAD keeps the kernel from advancing
+  // the time (sc_suspend_all), so the initiators synchronize at the quantum
+  // boundaries: sync() blocks the host thread until the SC_THREAD has
+  // waited for the local time. Other processes still run at the current
+  // time, so the host thread must not access the simulation directly.
+  // Transactions to shared targets use one of two protocols:
+  //
+  //   - execute() hands a function over to the SC_THREAD, e.g. a
+  //     b_transport call, and blocks the host thread until it returns. The
+  //     function may wait, in this case the local time is relative to the
+  //     new simulation time when execute() returns.
+  //   - execute_locked() runs a function on the host thread, while it holds
+  //     a lock shared by all parallel quantum keepers. The function must not
+  //     use the kernel, and the target must not be used by other processes
+  //     without holding the lock (see lock()).
+  //
+  // The order of the transactions of different initiators within a quantum
+  // is not deterministic. Reports must not be issued from the host thread.
+  // If the quantum keeper is used by the SC_THREAD itself, outside of run(),
+  // it behaves like a tlm_quantumkeeper.
+  //
+  // The quantum keeper contains a primitive channel, so it has to be created
+  // during elaboration.
+  //
+  class tlm_parallel_quantumkeeper : public tlm_quantumkeeper
+  {
+  public:
+    tlm_parallel_quantumkeeper(const char* name =
+                     sc_core::sc_gen_unique_name("parallel_quantumkeeper")) :
+      m_mailbox(name),
+      m_request(no_request),
+      m_call(0),
+      m_suspended(false),
+      m_shutdown(false)
+    {
+    }
+
+    virtual ~tlm_parallel_quantumkeeper()
+    {
+      stop_worker();
+    }
+
+    //
+    // Run the function on the host thread. This method has to be called by
+    // an SC_THREAD, it returns when the function has returned. Exceptions
+    // are passed on to the SC_THREAD.
+    //
+    void run(const std::function<void()>& f)
+    {
+      sc_assert(!m_worker.joinable());
+      guard g(*this);
+      m_function = f;
+      m_exception = nullptr;
+      m_request = no_request;
+      m_shutdown = false;
+      suspend();
+      {
+        // the host thread must see m_worker for on_host_thread()
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_worker = std::thread(&tlm_parallel_quantumkeeper::worker, this);
+      }
+
+      for (;;) {
+        sc_core::wait(m_mailbox.m_event);
+        request r;
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          r = m_request;
+        }
+        if (r == no_request)
+          continue;
+        unsuspend();
+
+        if (r == done_request) {
+          m_worker.join();
+          if (m_exception)
+            std::rethrow_exception(m_exception);
+          return;
+        }
+        if (r == sync_request)
+          tlm_quantumkeeper::sync();
+        else
+          (*m_call)();
+
+        suspend();
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          m_request = no_request;
+        }
+        m_cond.notify_one();
+      }
+    }
+
+    //
+    // Synchronize to SystemC. On the host thread, this waits until the
+    // SC_THREAD has synchronized, and the next quantum begins.
+    //
+    virtual void sync()
+    {
+      if (on_host_thread())
+        post(sync_request);
+      else
+        tlm_quantumkeeper::sync();
+    }
+
+    //
+    // Execute the function in the context of the SC_THREAD.
+    //
+    void execute(const std::function<void()>& f)
+    {
+      if (on_host_thread()) {
+        m_call = &f;
+        post(call_request);
+      } else {
+        f();
+      }
+    }
+
+    //
+    // Execute the function while holding the lock of the parallel quantum
+    // keepers.
+    //
+    void execute_locked(const std::function<void()>& f)
+    {
+      std::lock_guard<std::mutex> lock(tlm_parallel_quantumkeeper::lock());
+      f();
+    }
+
+    //
+    // The lock of execute_locked(), for other processes which use the
+    // same targets.
+    //
+    static std::mutex& lock()
+    {
+      static std::mutex m;
+      return m;
+    }
+
+    bool on_host_thread() const
+    {
+      return std::this_thread::get_id() == m_worker.get_id();
+    }
+
+  private:
+    enum request { no_request, sync_request, call_request, done_request };
+
+    // thrown on the host thread, if the quantum keeper is destroyed
+    struct shutdown_exception {};
+
+    // wakes up the SC_THREAD from the host thread
+    class mailbox : public sc_core::sc_prim_channel
+    {
+    public:
+      explicit mailbox(const char* name) :
+        sc_core::sc_prim_channel(name), m_event("event") {}
+
+      void post() { async_request_update(); }
+      void attach() { async_attach_suspending(); }
+      void detach() { async_detach_suspending(); }
+
+      sc_core::sc_event m_event;
+
+    private:
+      virtual void update() { m_event.notify(sc_core::SC_ZERO_TIME); }
+    };
+
+    // stops the host thread if the SC_THREAD leaves run() by an exception
+    struct guard
+    {
+      explicit guard(tlm_parallel_quantumkeeper& qk) : m_qk(qk) {}
+      ~guard()
+      {
+        if (m_qk.m_suspended)
+          m_qk.unsuspend();
+        m_qk.stop_worker();
+      }
+      tlm_parallel_quantumkeeper& m_qk;
+    };
+
+    // the kernel must neither advance the time nor run out of events,
+    // while the host thread runs
+    void suspend()
+    {
+      sc_core::sc_suspend_all();
+      m_mailbox.attach();
+      m_suspended = true;
+    }
+
+    void unsuspend()
+    {
+      m_suspended = false;
+      m_mailbox.detach();
+      sc_core::sc_unsuspend_all();
+    }
+
+    void worker()
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+      }
+      try {
+        m_function();
+      } catch (const shutdown_exception&) {
+        return;
+      } catch (...) {
+        m_exception = std::current_exception();
+      }
+      try {
+        post(done_request);
+      } catch (const shutdown_exception&) {
+      }
+    }
+
+    // pass the request to the SC_THREAD and wait for its completion
+    void post(request r)
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      if (m_shutdown)
+        throw shutdown_exception();
+      m_request = r;
+      m_mailbox.post();
+      if (r == done_request)
+        return;
+      m_cond.wait(lock, [this] { return m_request == no_request ||
+                                        m_shutdown; });
+      if (m_shutdown)
+        throw shutdown_exception();
+    }
+
+    void stop_worker()
+    {
+      if (!m_worker.joinable())
+        return;
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+      }
+      m_cond.notify_one();
+      m_worker.join();
+    }
+
+  private:
+    mailbox                      m_mailbox;
+    std::thread                  m_worker;
+    std::function<void()>        m_function;
+    std::exception_ptr           m_exception;
+
+    std::mutex                   m_mutex;    // guards the fields below
+    std::condition_variable      m_cond;     // request completed
+    request                      m_request;
+    const std::function<void()>* m_call;
+    bool                         m_suspended;
+    bool                         m_shutdown;
+  };
+
+} // namespace tlm_utils
+
+#endif